@@ -13,8 +13,9 @@ import Foundation
 /// Audio instances are created by decoding audio data and can be registered as global assets
 /// with a worker, allowing them to be provided dynamically at runtime.
 ///
-/// Lifetime: Audio instances are guaranteed to exist while registered as a global asset with a worker.
-/// When not used as a global asset, you must maintain a strong reference to the instance to keep it alive.
+/// Lifetime: you must maintain a strong reference to the instance to keep it alive. Once a registered
+/// audio is released, the worker's global asset registry owns the decoded audio, and may evict it when it is
+/// not referenced by a loaded file; see `Worker.globalAssetMemoryBudget`.
 public final class Audio: Equatable {
     /// The underlying type for the audio handle identifier.
     ///
@@ -25,6 +26,9 @@ public final class Audio: Equatable {
     typealias AudioHandle = UInt64
 
     let handle: AudioHandle
+    /// The data the audio was decoded from, shared rather than copied, so that it can be decoded
+    /// again if it is evicted after being registered as a global asset.
+    let encodedData: Data?
     private let dependencies: Dependencies
     
     /// Creates an audio source by decoding the provided audio data.
@@ -38,13 +42,14 @@ public final class Audio: Equatable {
         RiveLog.debug(tag: .audio, "[Audio] Initializing audio from data (\(data.count) bytes)")
         let handle = try await dependencies.audioService.decodeAudio(from: data)
         RiveLog.debug(tag: .audio, "[Audio (\(handle))] Initialized audio")
-        self.init(handle: handle, dependencies: dependencies)
+        self.init(handle: handle, dependencies: dependencies, encodedData: data)
     }
 
     @MainActor
-    init(handle: AudioHandle, dependencies: Dependencies) {
+    init(handle: AudioHandle, dependencies: Dependencies, encodedData: Data? = nil) {
         self.handle = handle
         self.dependencies = dependencies
+        self.encodedData = encodedData
     }
 
     deinit {
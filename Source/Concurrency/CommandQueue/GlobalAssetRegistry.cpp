@@ -0,0 +1,370 @@
+//
+//  GlobalAssetRegistry.cpp
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#include "GlobalAssetRegistry.hpp"
+
+#include <algorithm>
+
+namespace rive
+{
+
+constexpr static size_t kDefaultMemoryBudget = 128 * 1024 * 1024;
+
+GlobalAssetRegistry::GlobalAssetRegistry(rcp<CommandQueue> commandQueue) :
+    m_commandQueue(std::move(commandQueue)),
+    m_memoryBudget(kDefaultMemoryBudget)
+{}
+
+std::string GlobalAssetRegistry::keyFor(AssetType type, const std::string& name)
+{
+    // Images, fonts and audio are registered in separate namespaces.
+    return std::to_string(static_cast<int>(type)) + ":" + name;
+}
+
+size_t GlobalAssetRegistry::memoryBudget() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_memoryBudget;
+}
+
+void GlobalAssetRegistry::setMemoryBudget(size_t budget)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_memoryBudget = budget;
+    evictUntil(m_memoryBudget);
+}
+
+size_t GlobalAssetRegistry::residentByteCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_residentByteCount;
+}
+
+void GlobalAssetRegistry::add(AssetType type,
+                              const std::string& name,
+                              uint64_t handle,
+                              EncodedBytesSource encodedBytes,
+                              size_t byteCount,
+                              uint64_t requestId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto key = keyFor(type, name);
+    auto existing = m_entries.find(key);
+    if (existing != m_entries.end())
+    {
+        // Registering replaces the previous asset on the server.
+        if (existing->second.resident)
+        {
+            m_residentByteCount -= existing->second.byteCount;
+        }
+        releaseHandle(existing->second);
+        // Files loaded so far bound the previous asset, not this one.
+        releaseFileReferences(key);
+        m_entries.erase(existing);
+    }
+
+    Entry entry;
+    entry.type = type;
+    entry.name = name;
+    entry.handle = handle;
+    entry.encodedBytes = std::move(encodedBytes);
+    entry.byteCount = byteCount;
+    entry.lastUse = ++m_useClock;
+    registerWithServer(entry, requestId);
+    m_residentByteCount += entry.byteCount;
+    m_entries.emplace(key, std::move(entry));
+    evictUntil(m_memoryBudget);
+}
+
+void GlobalAssetRegistry::remove(AssetType type,
+                                 const std::string& name,
+                                 uint64_t requestId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto key = keyFor(type, name);
+    auto found = m_entries.find(key);
+    if (found == m_entries.end())
+    {
+        // Not registered through the registry; forward as is.
+        Entry entry;
+        entry.type = type;
+        entry.name = name;
+        unregisterFromServer(entry, requestId);
+        return;
+    }
+    Entry& entry = found->second;
+    if (entry.resident)
+    {
+        unregisterFromServer(entry, requestId);
+        m_residentByteCount -= entry.byteCount;
+    }
+    releaseHandle(entry);
+    releaseFileReferences(key);
+    m_entries.erase(found);
+}
+
+bool GlobalAssetRegistry::takeOwnershipOfDeletedHandle(AssetType type,
+                                                       uint64_t handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    bool registered = false;
+    for (auto& pair : m_entries)
+    {
+        Entry& entry = pair.second;
+        if (entry.type == type && entry.resident && !entry.ownsHandle &&
+            entry.handle == handle)
+        {
+            entry.ownsHandle = true;
+            m_ownedHandleUses[handle]++;
+            registered = true;
+        }
+    }
+    if (registered)
+    {
+        // The asset may have just become evictable.
+        evictUntil(m_memoryBudget);
+    }
+    return registered;
+}
+
+void GlobalAssetRegistry::willLoadFile()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& pair : m_entries)
+    {
+        if (!pair.second.resident)
+        {
+            redecode(pair.second);
+        }
+    }
+}
+
+void GlobalAssetRegistry::didLoadFile(uint64_t fileHandle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& references = m_fileReferences[fileHandle];
+    references.loadCount++;
+    for (auto& pair : m_entries)
+    {
+        Entry& entry = pair.second;
+        entry.lastUse = ++m_useClock;
+        if (references.keys.insert(pair.first).second)
+        {
+            entry.fileReferenceCount++;
+        }
+    }
+}
+
+void GlobalAssetRegistry::didDeleteFile(uint64_t fileHandle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_fileReferences.find(fileHandle);
+    if (found == m_fileReferences.end() || --found->second.loadCount > 0)
+    {
+        return;
+    }
+    for (const auto& key : found->second.keys)
+    {
+        auto entry = m_entries.find(key);
+        if (entry != m_entries.end() && entry->second.fileReferenceCount > 0)
+        {
+            entry->second.fileReferenceCount--;
+        }
+    }
+    m_fileReferences.erase(found);
+    evictUntil(m_memoryBudget);
+}
+
+size_t GlobalAssetRegistry::trim()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return evictUntil(0);
+}
+
+std::vector<GlobalAssetRegistry::AssetStatistics> GlobalAssetRegistry::
+    statistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<AssetStatistics> statistics;
+    statistics.reserve(m_entries.size());
+    for (const auto& pair : m_entries)
+    {
+        const Entry& entry = pair.second;
+        statistics.push_back({entry.name,
+                              entry.type,
+                              entry.byteCount,
+                              entry.resident,
+                              entry.resident && !entry.ownsHandle,
+                              entry.fileReferenceCount,
+                              entry.redecodeCount,
+                              entry.lastUse});
+    }
+    std::sort(statistics.begin(),
+              statistics.end(),
+              [](const AssetStatistics& a, const AssetStatistics& b) {
+                  return a.lastUse > b.lastUse;
+              });
+    return statistics;
+}
+
+bool GlobalAssetRegistry::isEvictable(const Entry& entry) const
+{
+    return entry.resident && entry.ownsHandle &&
+           entry.fileReferenceCount == 0 && entry.encodedBytes != nullptr;
+}
+
+void GlobalAssetRegistry::releaseFileReferences(const std::string& key)
+{
+    for (auto& file : m_fileReferences)
+    {
+        file.second.keys.erase(key);
+    }
+}
+
+void GlobalAssetRegistry::releaseHandle(Entry& entry)
+{
+    if (!entry.ownsHandle)
+    {
+        // The client still holds the handle, and deletes it.
+        entry.handle = 0;
+        return;
+    }
+    auto uses = m_ownedHandleUses.find(entry.handle);
+    if (uses != m_ownedHandleUses.end() && --uses->second == 0)
+    {
+        m_ownedHandleUses.erase(uses);
+        switch (entry.type)
+        {
+            case AssetType::image:
+                m_commandQueue->deleteImage(
+                    reinterpret_cast<RenderImageHandle>(entry.handle));
+                break;
+            case AssetType::font:
+                m_commandQueue->deleteFont(
+                    reinterpret_cast<FontHandle>(entry.handle));
+                break;
+            case AssetType::audio:
+                m_commandQueue->deleteAudio(
+                    reinterpret_cast<AudioSourceHandle>(entry.handle));
+                break;
+        }
+    }
+    entry.handle = 0;
+    entry.ownsHandle = false;
+}
+
+void GlobalAssetRegistry::evict(Entry& entry)
+{
+    unregisterFromServer(entry, 0);
+    releaseHandle(entry);
+    entry.resident = false;
+    m_residentByteCount -= entry.byteCount;
+}
+
+void GlobalAssetRegistry::redecode(Entry& entry)
+{
+    auto bytes = entry.encodedBytes();
+    switch (entry.type)
+    {
+        case AssetType::image:
+            entry.handle = reinterpret_cast<uint64_t>(
+                m_commandQueue->decodeImage(std::move(bytes)));
+            break;
+        case AssetType::font:
+            entry.handle = reinterpret_cast<uint64_t>(
+                m_commandQueue->decodeFont(std::move(bytes)));
+            break;
+        case AssetType::audio:
+            entry.handle = reinterpret_cast<uint64_t>(
+                m_commandQueue->decodeAudio(std::move(bytes)));
+            break;
+    }
+    entry.ownsHandle = true;
+    m_ownedHandleUses[entry.handle]++;
+    entry.resident = true;
+    entry.redecodeCount++;
+    m_residentByteCount += entry.byteCount;
+    registerWithServer(entry, 0);
+}
+
+size_t GlobalAssetRegistry::evictUntil(size_t targetByteCount)
+{
+    if (m_residentByteCount <= targetByteCount)
+    {
+        return 0;
+    }
+    std::vector<Entry*> candidates;
+    for (auto& pair : m_entries)
+    {
+        if (isEvictable(pair.second))
+        {
+            candidates.push_back(&pair.second);
+        }
+    }
+    std::sort(candidates.begin(),
+              candidates.end(),
+              [](const Entry* a, const Entry* b) {
+                  return a->lastUse < b->lastUse;
+              });
+
+    size_t freed = 0;
+    for (Entry* entry : candidates)
+    {
+        if (m_residentByteCount <= targetByteCount)
+        {
+            break;
+        }
+        freed += entry->byteCount;
+        evict(*entry);
+    }
+    return freed;
+}
+
+void GlobalAssetRegistry::registerWithServer(const Entry& entry,
+                                             uint64_t requestId)
+{
+    switch (entry.type)
+    {
+        case AssetType::image:
+            m_commandQueue->addGlobalImageAsset(
+                entry.name,
+                reinterpret_cast<RenderImageHandle>(entry.handle),
+                requestId);
+            break;
+        case AssetType::font:
+            m_commandQueue->addGlobalFontAsset(
+                entry.name,
+                reinterpret_cast<FontHandle>(entry.handle),
+                requestId);
+            break;
+        case AssetType::audio:
+            m_commandQueue->addGlobalAudioAsset(
+                entry.name,
+                reinterpret_cast<AudioSourceHandle>(entry.handle),
+                requestId);
+            break;
+    }
+}
+
+void GlobalAssetRegistry::unregisterFromServer(const Entry& entry,
+                                               uint64_t requestId)
+{
+    switch (entry.type)
+    {
+        case AssetType::image:
+            m_commandQueue->removeGlobalImageAsset(entry.name, requestId);
+            break;
+        case AssetType::font:
+            m_commandQueue->removeGlobalFontAsset(entry.name, requestId);
+            break;
+        case AssetType::audio:
+            m_commandQueue->removeGlobalAudioAsset(entry.name, requestId);
+            break;
+    }
+}
+
+} // namespace rive
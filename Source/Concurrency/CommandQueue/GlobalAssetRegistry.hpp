@@ -0,0 +1,157 @@
+//
+//  GlobalAssetRegistry.hpp
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#ifndef GlobalAssetRegistry_hpp
+#define GlobalAssetRegistry_hpp
+
+#include "rive/command_queue.hpp"
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace rive
+{
+
+/**
+ * The global images, fonts and audio registered on a worker, shared by every
+ * file the worker loads.
+ *
+ * Each asset is accounted at the size it occupies once decoded: images at
+ * four bytes per pixel, fonts and audio at the size of their encoded bytes,
+ * which the runtime keeps. An asset is referenced while the client still
+ * holds its handle, or while a file loaded after it was registered is alive,
+ * since that file may have bound it. Once the client releases a registered
+ * handle, the registry takes ownership of it instead of deleting it.
+ *
+ * When resident assets exceed the memory budget, unreferenced assets are
+ * evicted, least recently used first: they are unregistered and their
+ * handles deleted, but their encoded bytes are kept. Evicted assets are
+ * decoded and registered again before the next file is loaded, which is the
+ * first point at which they can be needed again. Encoded bytes are kept only
+ * for registered assets, through a source that shares the client's bytes
+ * rather than copying them; they are copied only to decode again.
+ *
+ * Every method other than statistics() and the byte count accessors must be
+ * called on the thread that owns the command queue.
+ */
+class GlobalAssetRegistry
+{
+public:
+    enum class AssetType
+    {
+        image,
+        font,
+        audio,
+    };
+
+    struct AssetStatistics
+    {
+        std::string name;
+        AssetType type;
+        size_t byteCount;
+        bool resident;
+        bool heldByClient;
+        uint32_t fileReferenceCount;
+        /// The number of times the asset was decoded again after eviction.
+        uint32_t redecodeCount;
+        /// Orders assets by last use; larger is more recent.
+        uint64_t lastUse;
+    };
+
+    explicit GlobalAssetRegistry(rcp<CommandQueue> commandQueue);
+
+    size_t memoryBudget() const;
+    void setMemoryBudget(size_t budget);
+    /// The accounted size of every resident asset.
+    size_t residentByteCount() const;
+
+    /// Returns a copy of an asset's encoded bytes, to decode it again.
+    using EncodedBytesSource = std::function<std::vector<uint8_t>()>;
+
+    /// Registers a client handle under name, replacing any asset registered
+    /// under the same name and type. encodedBytes may be null when the asset
+    /// cannot be decoded again, in which case it is never evicted.
+    void add(AssetType type,
+             const std::string& name,
+             uint64_t handle,
+             EncodedBytesSource encodedBytes,
+             size_t byteCount,
+             uint64_t requestId);
+    void remove(AssetType type, const std::string& name, uint64_t requestId);
+
+    /// Called when the client deletes a handle. Returns true if the handle is
+    /// registered, in which case the registry takes ownership of it and the
+    /// delete must not be forwarded to the command queue.
+    bool takeOwnershipOfDeletedHandle(AssetType type, uint64_t handle);
+
+    /// Decodes evicted assets again. Must be called before a file is loaded,
+    /// so that the server registers them before it imports the file.
+    void willLoadFile();
+    /// Marks every registered asset as referenced by the file. A handle
+    /// loaded more than once is counted once per load, and releases its
+    /// references once every load has been deleted.
+    void didLoadFile(uint64_t fileHandle);
+    void didDeleteFile(uint64_t fileHandle);
+
+    /// Evicts every unreferenced asset. Returns the number of bytes freed.
+    size_t trim();
+
+    std::vector<AssetStatistics> statistics() const;
+
+private:
+    struct Entry
+    {
+        AssetType type;
+        std::string name;
+        uint64_t handle = 0;
+        // Whether the registry, rather than the client, deletes the handle.
+        bool ownsHandle = false;
+        EncodedBytesSource encodedBytes;
+        size_t byteCount = 0;
+        bool resident = true;
+        uint32_t fileReferenceCount = 0;
+        uint32_t redecodeCount = 0;
+        uint64_t lastUse = 0;
+    };
+
+    struct FileReferences
+    {
+        // The number of loads of the file not yet deleted.
+        uint32_t loadCount = 0;
+        std::unordered_set<std::string> keys;
+    };
+
+    static std::string keyFor(AssetType type, const std::string& name);
+    void releaseFileReferences(const std::string& key);
+    bool isEvictable(const Entry& entry) const;
+    void releaseHandle(Entry& entry);
+    void evict(Entry& entry);
+    void redecode(Entry& entry);
+    size_t evictUntil(size_t targetByteCount);
+    void registerWithServer(const Entry& entry, uint64_t requestId);
+    void unregisterFromServer(const Entry& entry, uint64_t requestId);
+
+    rcp<CommandQueue> m_commandQueue;
+    // Guards the members below against statistics reads from other threads.
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+    // The number of entries using each handle the registry owns.
+    std::unordered_map<uint64_t, uint32_t> m_ownedHandleUses;
+    // The entries each live file may have bound.
+    std::unordered_map<uint64_t, FileReferences> m_fileReferences;
+    size_t m_memoryBudget;
+    size_t m_residentByteCount = 0;
+    uint64_t m_useClock = 0;
+};
+
+} // namespace rive
+
+#endif /* GlobalAssetRegistry_hpp */
@@ -120,6 +120,19 @@ NS_SWIFT_NAME(CommandQueueProtocol)
  */
 - (void)requestArtboardNames:(uint64_t)fileHandle requestID:(uint64_t)requestID;
 
+/**
+ * Requests a metadata index of a loaded file: its artboards with their sizes,
+ * animations and state machine inputs, and its view model schemas. The index
+ * is built on the server from the file's definitions, without instantiating
+ * anything.
+ *
+ * @param fileHandle The file handle of the file to query
+ * @param requestID The request ID for this operation
+ * @note The response will be delivered via the file listener observer's
+ *       onFileMetadataListed:requestID:metadata: method
+ */
+- (void)requestFileMetadata:(uint64_t)fileHandle requestID:(uint64_t)requestID;
+
 /**
  * Requests the names of all view models defined in a Rive file.
  *
@@ -795,6 +808,79 @@ NS_SWIFT_NAME(CommandQueueProtocol)
 - (void)requestViewModelInstanceName:(uint64_t)viewModelInstanceHandle
                            requestID:(uint64_t)requestID;
 
+/**
+ * Requests a snapshot of a view model instance: the values of its number,
+ * string, boolean, color and enum properties, and of its nested view model
+ * instances, recursively, captured in a single server call.
+ *
+ * @param viewModelInstanceHandle The handle of the view model instance
+ * @param requestID The request ID for correlating the response
+ * @note The snapshot is delivered as an opaque binary blob via
+ *       onViewModelInstanceSnapshotReceived:requestID:snapshot:. Triggers,
+ *       lists, images and artboards are not captured. If nested instances
+ *       are chained more than 32 levels deep, onViewModelInstanceError is
+ *       called instead.
+ */
+- (void)requestViewModelInstanceSnapshot:(uint64_t)viewModelInstanceHandle
+                               requestID:(uint64_t)requestID;
+
+/**
+ * Applies a snapshot to a view model instance in a single server call.
+ *
+ * @param viewModelInstanceHandle The handle of the view model instance
+ * @param snapshot A snapshot from requestViewModelInstanceSnapshot:requestID:,
+ *        of an instance of the same view model
+ * @param requestID The request ID for correlating the response
+ * @note The snapshot is applied atomically: if it is malformed, any of its
+ *       properties does not exist on the instance with the same type, or it
+ *       would nest instances more than 32 levels deep, no value is changed
+ *       and onViewModelInstanceError is called. Otherwise
+ *       onViewModelInstanceRestored:requestID: is called.
+ */
+- (void)restoreViewModelInstance:(uint64_t)viewModelInstanceHandle
+                    fromSnapshot:(NSData*)snapshot
+                       requestID:(uint64_t)requestID;
+
+/**
+ * Applies the fields of a JSON document to a view model instance in a single
+ * server call.
+ *
+ * The document is read in one pass, without building a tree of it. Fields are
+ * identified by their path from the root, with object keys joined by "/",
+ * and bind to the property at the same path, so nested objects set the
+ * properties of nested view model instances. Values are converted to the type
+ * of their property where no information is lost, e.g. "#RRGGBB" strings to
+ * colors, except that numbers are rounded to the nearest float. Strings
+ * convert to numbers only if they are exactly a JSON number.
+ *
+ * @param viewModelInstanceHandle The handle of the view model instance
+ * @param json The UTF-8 JSON document
+ * @param mapping Optional JSON field paths to property paths. When given, only
+ *        the fields it names are bound; an entry for an object binds that
+ *        object's fields to the nested instance it names.
+ * @param requestID The request ID for correlating the response
+ * @note If the document is not valid JSON, no value is changed and
+ *       onViewModelInstanceError is called. Otherwise
+ *       onViewModelInstanceJSONApplied:requestID:appliedCount:skippedFields:
+ *       missingFields: is called. Nulls and arrays are not bound.
+ */
+- (void)applyViewModelInstanceJSON:(uint64_t)viewModelInstanceHandle
+                              json:(NSData*)json
+                           mapping:
+                               (nullable NSDictionary<NSString*, NSString*>*)
+                                   mapping
+                         requestID:(uint64_t)requestID
+    NS_SWIFT_NAME(applyViewModelInstanceJSON(_:json:mapping:requestID:));
+
+/*
+ * Writes to string, number, boolean, color and enum properties are coalesced.
+ * They are buffered on the client, keyed by instance and path, and only the
+ * latest value written to each property is sent to the server. Buffered
+ * writes are sent when messages are processed, once per frame, and before any
+ * other command is queued, so triggers, list operations, reads and advances
+ * are applied after every write made before them.
+ */
+
 /**
  * Sets the string value of a view model property.
  *
@@ -1056,6 +1142,32 @@ NS_SWIFT_NAME(CommandQueueProtocol)
                               requestID:(uint64_t)requestID
     NS_SWIFT_NAME(swapViewModelInstanceListValues(_:path:atIndex:withIndex:requestID:));
 
+/**
+ * Makes a list property hold exactly the given view model instances, in order.
+ *
+ * The list is diffed against the target on the server, keyed by view model
+ * instance: items missing from the target are removed, new instances are
+ * inserted, and the items that remain keep their bindings and are swapped
+ * into order in place.
+ * All mutations are applied together, so the artboard lays out the list once
+ * instead of once per item.
+ *
+ * @param viewModelInstanceHandle The handle of the parent view model instance
+ * @param path The property path to the list (e.g., "items")
+ * @param values The handles of the view model instances the list should hold,
+ * in order
+ * @param requestID The request ID for this operation
+ * @note The property must be of type list. Changes are applied asynchronously.
+ *       If the list or any of the handles is invalid, the list is left
+ *       unchanged and the error is delivered to the observer's
+ *       onViewModelInstanceError:requestID:message: method.
+ */
+- (void)applyViewModelInstanceListDiff:(uint64_t)viewModelInstanceHandle
+                                  path:(NSString*)path
+                                values:(NSArray<NSNumber*>*)values
+                             requestID:(uint64_t)requestID
+    NS_SWIFT_NAME(applyViewModelInstanceListDiff(_:path:values:requestID:));
+
 /**
  * Deletes a view model instance and frees its resources.
  *
@@ -1133,8 +1245,9 @@ NS_SWIFT_NAME(CommandQueueProtocol)
  *
  * @param renderImage The handle of the image to delete
  * @param requestID The request ID for this operation
- * @note This operation is irreversible. Make sure to remove the image from
- *       any global assets before deleting it.
+ * @note If the image is registered as a global asset, the global asset
+ *       registry takes ownership of it instead, and deletes it once it is
+ *       removed or evicted. The delete is still confirmed to the listener.
  */
 - (void)deleteImage:(uint64_t)renderImage requestID:(uint64_t)requestID;
 
@@ -1151,11 +1264,16 @@ NS_SWIFT_NAME(CommandQueueProtocol)
  *
  * @param name The asset name to use (must match the name in the Rive file)
  * @param imageHandle The handle of the decoded image
+ * @param data The bytes the image was decoded from, kept to decode it again
+ *             after eviction, or nil if it cannot be evicted
  * @param requestID The request ID for this operation
  * @note If an asset with the same name already exists, it will be replaced.
+ *       Once the handle is deleted, the asset is owned by the global asset
+ *       registry, which may evict it when it is not referenced.
  */
 - (void)addGlobalImageAsset:(NSString*)name
                 imageHandle:(uint64_t)imageHandle
+                encodedData:(nullable NSData*)data
                   requestID:(uint64_t)requestID;
 
 /**
@@ -1228,8 +1346,9 @@ NS_SWIFT_NAME(CommandQueueProtocol)
  *
  * @param font The handle of the font to delete
  * @param requestID The request ID for this operation
- * @note This operation is irreversible. Make sure to remove the font from
- *       any global assets before deleting it.
+ * @note If the font is registered as a global asset, the global asset
+ *       registry takes ownership of it instead, and deletes it once it is
+ *       removed or evicted. The delete is still confirmed to the listener.
  */
 - (void)deleteFont:(uint64_t)font requestID:(uint64_t)requestID;
 
@@ -1246,11 +1365,16 @@ NS_SWIFT_NAME(CommandQueueProtocol)
  *
  * @param name The asset name to use (must match the name in the Rive file)
  * @param fontHandle The handle of the decoded font
+ * @param data The bytes the font was decoded from, kept to decode it again
+ *             after eviction, or nil if it cannot be evicted
  * @param requestID The request ID for this operation
  * @note If an asset with the same name already exists, it will be replaced.
+ *       Once the handle is deleted, the asset is owned by the global asset
+ *       registry, which may evict it when it is not referenced.
  */
 - (void)addGlobalFontAsset:(NSString*)name
                 fontHandle:(uint64_t)fontHandle
+               encodedData:(nullable NSData*)data
                  requestID:(uint64_t)requestID;
 
 /**
@@ -1291,8 +1415,9 @@ NS_SWIFT_NAME(CommandQueueProtocol)
  *
  * @param audio The handle of the audio to delete
  * @param requestID The request ID for this operation
- * @note This operation is irreversible. Make sure to remove the audio from
- *       any global assets before deleting it.
+ * @note If the audio is registered as a global asset, the global asset
+ *       registry takes ownership of it instead, and deletes it once it is
+ *       removed or evicted. The delete is still confirmed to the listener.
  */
 - (void)deleteAudio:(uint64_t)audio requestID:(uint64_t)requestID;
 
@@ -1309,11 +1434,16 @@ NS_SWIFT_NAME(CommandQueueProtocol)
  *
  * @param name The asset name to use (must match the name in the Rive file)
  * @param audioHandle The handle of the decoded audio
+ * @param data The bytes the audio was decoded from, kept to decode it again
+ *             after eviction, or nil if it cannot be evicted
  * @param requestID The request ID for this operation
  * @note If an asset with the same name already exists, it will be replaced.
+ *       Once the handle is deleted, the asset is owned by the global asset
+ *       registry, which may evict it when it is not referenced.
  */
 - (void)addGlobalAudioAsset:(NSString*)name
                 audioHandle:(uint64_t)audioHandle
+                encodedData:(nullable NSData*)data
                   requestID:(uint64_t)requestID;
 
 /**
@@ -1328,6 +1458,43 @@ NS_SWIFT_NAME(CommandQueueProtocol)
  */
 - (void)removeGlobalAudioAsset:(NSString*)name requestID:(uint64_t)requestID;
 
+#pragma mark - Global Assets
+
+/**
+ * The memory budget, in bytes, for global assets.
+ *
+ * Assets are accounted at their decoded size: images at four bytes per pixel,
+ * fonts and audio at the size of their data. When resident assets exceed the
+ * budget, assets that are neither held by the client nor possibly bound by a
+ * live file are evicted, least recently used first, and decoded again before
+ * the next file is loaded.
+ */
+@property(nonatomic) NSUInteger globalAssetMemoryBudget;
+
+/**
+ * The accounted size, in bytes, of every resident global asset.
+ */
+@property(nonatomic, readonly) NSUInteger globalAssetResidentByteCount;
+
+/**
+ * Returns the statistics of every registered global asset, most recently used
+ * first.
+ *
+ * Each dictionary contains "name" and "type" ("image", "font" or "audio")
+ * strings, and "byteCount", "resident", "heldByClient", "fileReferenceCount"
+ * and "redecodeCount" numbers.
+ */
+- (NSArray<NSDictionary<NSString*, id>*>*)globalAssetStatistics;
+
+/**
+ * Evicts every global asset that is not referenced.
+ *
+ * This is called automatically when the system reports memory pressure.
+ *
+ * @return The number of bytes freed
+ */
+- (NSUInteger)trimGlobalAssets;
+
 /**
  * Synchronously drains all pending messages from the command queue.
  *
@@ -1335,6 +1502,10 @@ NS_SWIFT_NAME(CommandQueueProtocol)
  * command server. The call is coalesced by CommandQueueMessageGate so that
  * multiple views sharing the same queue result in a single drain per
  * run-loop turn.
+ *
+ * Results the server computes itself, such as file metadata and view model
+ * instance snapshots, are delivered here too, after the messages the server
+ * sent before them.
  */
 - (void)processMessages;
 
@@ -1361,6 +1532,13 @@ NS_SWIFT_NAME(CommandQueue)
 @interface RiveCommandQueue
     : NSObject <RiveCommandQueueProtocol, _RiveCommandQueueMessagePumpDriver>
 
+/**
+ * The number of property writes replaced by a later write to the same property
+ * before being sent, i.e. the commands that coalescing kept from reaching the
+ * server.
+ */
+@property(nonatomic, readonly) uint64_t coalescedPropertyWriteCount;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -11,6 +11,7 @@
 #import <rive/command_queue.hpp>
 #import <rive/command_server.hpp>
 #import <dispatch/dispatch.h>
+#import <ImageIO/ImageIO.h>
 #import "RiveArtboardListener.h"
 #import "RiveStateMachineListener.h"
 #import "RiveRenderImageListener.h"
@@ -21,12 +22,22 @@
 #import "RivePrivateHeaders.h"
 #import "RiveConcurrency_Private.hh"
 #import "RiveSemanticsDiff.h"
+#include "GlobalAssetRegistry.hpp"
+#include "ViewModelInstanceJSONBinder.hpp"
+#include "ViewModelInstanceListDiff.hpp"
+#include "ViewModelInstanceSnapshot.hpp"
 #include "rive/animation/semantic_listener_group.hpp"
 #include "rive/semantic/semantic_snapshot.hpp"
 #include "rive/semantic/semantic_role.hpp"
 #include "rive/semantic/semantic_trait.hpp"
 #include "rive/semantic/semantic_state.hpp"
 
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 NS_ASSUME_NONNULL_BEGIN
 
 rive::DataType RiveViewModelInstanceDataTypeToCppType(
@@ -113,6 +124,87 @@ RiveViewModelInstanceDataType RiveViewModelInstanceDataTypeFromCpp(
     }
 }
 
+/**
+ * Builds the metadata dictionary delivered to onFileMetadataListed: from the
+ * definitions in a file, without instantiating any artboard, state machine or
+ * view model instance. Artboards are described through RiveFileMetadata, so
+ * that the legacy and Worker APIs index files identically.
+ */
+static NSDictionary<NSString*, id>* RiveFileMetadataDictionary(rive::File* file)
+{
+    RiveFileMetadata* metadata = [[RiveFileMetadata alloc] initWithFile:file];
+
+    NSMutableArray* artboards =
+        [NSMutableArray arrayWithCapacity:metadata.artboards.count];
+    for (RiveArtboardMetadata* artboard in metadata.artboards)
+    {
+        NSMutableArray* stateMachines =
+            [NSMutableArray arrayWithCapacity:artboard.stateMachines.count];
+        for (RiveStateMachineMetadata* stateMachine in artboard.stateMachines)
+        {
+            NSMutableArray* inputs =
+                [NSMutableArray arrayWithCapacity:stateMachine.inputs.count];
+            for (RiveStateMachineInputMetadata* input in stateMachine.inputs)
+            {
+                [inputs addObject:@{
+                    @"name" : input.name,
+                    @"type" : @(input.type)
+                }];
+            }
+            [stateMachines addObject:@{
+                @"name" : stateMachine.name,
+                @"inputs" : inputs
+            }];
+        }
+        [artboards addObject:@{
+            @"name" : artboard.name,
+            @"width" : @(artboard.width),
+            @"height" : @(artboard.height),
+            @"animationNames" : artboard.animationNames,
+            @"stateMachines" : stateMachines
+        }];
+    }
+
+    // View model properties use the Worker's data types, so they are read
+    // from the runtime directly.
+    NSMutableArray* viewModels =
+        [NSMutableArray arrayWithCapacity:file->viewModelCount()];
+    for (size_t i = 0; i < file->viewModelCount(); i++)
+    {
+        auto viewModel = file->viewModelByIndex(i);
+        if (viewModel == nullptr)
+        {
+            continue;
+        }
+        auto properties = viewModel->properties();
+        NSMutableArray* propertyArray =
+            [NSMutableArray arrayWithCapacity:properties.size()];
+        for (const auto& property : properties)
+        {
+            [propertyArray addObject:@{
+                @"type" : @(RiveViewModelInstanceDataTypeFromCpp(property.type)),
+                @"name" : [NSString stringWithUTF8String:property.name.c_str()],
+                @"metaData" : @""
+            }];
+        }
+        auto instanceNames = viewModel->instanceNames();
+        NSMutableArray* instanceNameArray =
+            [NSMutableArray arrayWithCapacity:instanceNames.size()];
+        for (const auto& name : instanceNames)
+        {
+            [instanceNameArray
+                addObject:[NSString stringWithUTF8String:name.c_str()]];
+        }
+        [viewModels addObject:@{
+            @"name" : [NSString stringWithUTF8String:viewModel->name().c_str()],
+            @"properties" : propertyArray,
+            @"instanceNames" : instanceNameArray
+        }];
+    }
+
+    return @{@"artboards" : artboards, @"viewModels" : viewModels};
+}
+
 static rive::Fit RiveConfigurationFitCppValue(RiveConfigurationFit fit)
 {
     switch (fit)
@@ -791,6 +883,11 @@ public:
         uint64_t requestId,
         std::vector<rive::ViewModelEnum> enums) override;
 
+    /**
+     * Returns the Objective-C observer receiving file events.
+     */
+    id<RiveFileListener> observer() const { return _observer; }
+
 private:
     __weak id<RiveFileListener> _observer;
 };
@@ -1002,6 +1099,215 @@ void _FileListener::onViewModelEnumsListed(
 
 namespace
 {
+/**
+ * @class _PropertyWriteBuffer
+ *
+ * Holds the latest value written to each view model property since the last
+ * flush, keyed by instance and path. A write to a property that already has a
+ * pending write replaces it and moves it to the end, so each property is sent
+ * to the server at most once per flush, in the order of its latest write.
+ * Writes through different handles or paths can reach the same property, e.g.
+ * a nested instance's property through its parent, and sending them in the
+ * order of their latest writes leaves the last value written in place.
+ */
+class _PropertyWriteBuffer
+{
+public:
+    enum class Kind
+    {
+        string,
+        number,
+        boolean,
+        color,
+        enumType,
+    };
+
+    struct Write
+    {
+        Kind kind;
+        rive::ViewModelInstanceHandle handle;
+        std::string path;
+        std::string string;
+        float number = 0;
+        bool boolean = false;
+        rive::ColorInt color = 0;
+        uint64_t requestID = 0;
+    };
+
+    void add(Write write)
+    {
+        auto key = std::make_pair(write.handle, write.path);
+        _writes.push_back(std::move(write));
+        auto existing = _indices.find(key);
+        if (existing != _indices.end())
+        {
+            _writes.erase(existing->second);
+            existing->second = std::prev(_writes.end());
+            _coalescedCount++;
+            return;
+        }
+        _indices.emplace(std::move(key), std::prev(_writes.end()));
+    }
+
+    /**
+     * Sends every pending write to the queue. Called when processing
+     * messages, and before any other command so that the server sees writes
+     * and other commands in the order they were made.
+     */
+    void flush(rive::CommandQueue* queue)
+    {
+        if (_writes.empty())
+        {
+            return;
+        }
+        std::list<Write> writes;
+        writes.swap(_writes);
+        _indices.clear();
+        for (const Write& write : writes)
+        {
+            switch (write.kind)
+            {
+                case Kind::string:
+                    queue->setViewModelInstanceString(
+                        write.handle, write.path, write.string, write.requestID);
+                    break;
+                case Kind::number:
+                    queue->setViewModelInstanceNumber(
+                        write.handle, write.path, write.number, write.requestID);
+                    break;
+                case Kind::boolean:
+                    queue->setViewModelInstanceBool(write.handle,
+                                                    write.path,
+                                                    write.boolean,
+                                                    write.requestID);
+                    break;
+                case Kind::color:
+                    queue->setViewModelInstanceColor(
+                        write.handle, write.path, write.color, write.requestID);
+                    break;
+                case Kind::enumType:
+                    queue->setViewModelInstanceEnum(
+                        write.handle, write.path, write.string, write.requestID);
+                    break;
+            }
+        }
+    }
+
+    /** The number of writes replaced before they were sent. */
+    uint64_t coalescedCount() const { return _coalescedCount; }
+
+private:
+    std::list<Write> _writes;
+    std::map<std::pair<rive::ViewModelInstanceHandle, std::string>,
+             std::list<Write>::iterator>
+        _indices;
+    uint64_t _coalescedCount = 0;
+};
+
+/**
+ * @class _ViewModelDataBatch
+ *
+ * Collects the view model data received while processing messages, so that
+ * observers implementing onViewModelDataBatchReceived: receive everything
+ * for a frame in one call rather than one call per property change.
+ */
+class _ViewModelDataBatch
+{
+public:
+    _ViewModelDataBatch() :
+        _pending([NSMapTable strongToStrongObjectsMapTable])
+    {}
+
+    /**
+     * Queues data for the observer until the next flush, adding the instance
+     * handle and request ID that a batch entry carries in place of the
+     * arguments of onViewModelDataReceived:requestID:data:.
+     *
+     * @return false if the observer does not accept batches, in which case
+     *         the data is left unchanged and must be delivered immediately.
+     */
+    bool add(id<RiveViewModelInstanceListener> observer,
+             uint64_t viewModelInstanceHandle,
+             uint64_t requestID,
+             NSMutableDictionary<NSString*, id>* data)
+    {
+        if (![observer respondsToSelector:@selector
+                       (onViewModelDataBatchReceived:)])
+        {
+            return false;
+        }
+        data[@"viewModelInstanceHandle"] = @(viewModelInstanceHandle);
+        data[@"requestID"] = @(requestID);
+        NSMutableArray* batch = [_pending objectForKey:observer];
+        if (batch == nil)
+        {
+            batch = [NSMutableArray array];
+            [_pending setObject:batch forKey:observer];
+        }
+        [batch addObject:data];
+        return true;
+    }
+
+    /**
+     * Delivers all queued data. Called after processing messages, and before
+     * any other view model callback so that observers see callbacks in the
+     * order they were received.
+     */
+    void flush()
+    {
+        if (_pending.count == 0)
+        {
+            return;
+        }
+        // Observers may process messages again from their callbacks.
+        NSMapTable* pending = _pending;
+        _pending = [NSMapTable strongToStrongObjectsMapTable];
+        for (id<RiveViewModelInstanceListener> observer in pending)
+        {
+            [observer onViewModelDataBatchReceived:[pending
+                                                       objectForKey:observer]];
+        }
+    }
+
+private:
+    NSMapTable<id<RiveViewModelInstanceListener>, NSMutableArray*>* _pending;
+};
+
+/**
+ * @class _ServerResults
+ *
+ * Results of requests that the server computes itself through runOnce, such
+ * as file metadata and view model instance snapshots. The server posts them
+ * here rather than to the main queue, and processMessages delivers them to
+ * the listener of their handle, after the messages the server sent before
+ * them, so they arrive the same way as the command queue's own messages.
+ */
+class _ServerResults
+{
+public:
+    using Delivery = void (^)(RiveCommandQueue* queue);
+
+    /** Queues a delivery. Called on the server thread. */
+    void post(Delivery delivery)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending.push_back(delivery);
+    }
+
+    /** Removes and returns the queued deliveries, oldest first. */
+    std::vector<Delivery> take()
+    {
+        std::vector<Delivery> pending;
+        std::lock_guard<std::mutex> lock(_mutex);
+        pending.swap(_pending);
+        return pending;
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<Delivery> _pending;
+};
+
 /**
  * @class _ViewModelInstanceListener
  *
@@ -1023,8 +1329,12 @@ public:
      * @param observer The Objective-C observer that will receive view model
      *                 instance events. The observer is held as a weak reference
      *                 to avoid retain cycles.
+     * @param batch The batch that collects received data, owned by the
+     *              command queue, which outlives its listeners.
      */
-    _ViewModelInstanceListener(id<RiveViewModelInstanceListener> observer)
+    _ViewModelInstanceListener(id<RiveViewModelInstanceListener> observer,
+                               _ViewModelDataBatch* batch) :
+        _batch(batch)
     {
         _observer = observer;
     }
@@ -1101,8 +1411,14 @@ public:
         uint64_t requestId,
         std::string instanceName) override;
 
+    /**
+     * Returns the Objective-C observer receiving view model instance events.
+     */
+    id<RiveViewModelInstanceListener> observer() const { return _observer; }
+
 private:
     __weak id<RiveViewModelInstanceListener> _observer;
+    _ViewModelDataBatch* _batch;
 };
 } // namespace
 
@@ -1111,6 +1427,7 @@ void _ViewModelInstanceListener::onViewModelInstanceError(
     uint64_t requestId,
     std::string error)
 {
+    _batch->flush();
     if (_observer)
     {
         [_observer
@@ -1124,6 +1441,7 @@ void _ViewModelInstanceListener::onViewModelInstanceError(
 void _ViewModelInstanceListener::onViewModelDeleted(
     const rive::ViewModelInstanceHandle handle, uint64_t requestId)
 {
+    _batch->flush();
     if (_observer)
     {
         [_observer onViewModelDeleted:reinterpret_cast<uint64_t>(handle)
@@ -1171,9 +1489,17 @@ void _ViewModelInstanceListener::onViewModelDataReceived(
                 break;
         }
 
-        [_observer onViewModelDataReceived:reinterpret_cast<uint64_t>(handle)
-                                 requestID:requestId
-                                      data:dataDict];
+        id<RiveViewModelInstanceListener> observer = _observer;
+        if (!_batch->add(observer,
+                         reinterpret_cast<uint64_t>(handle),
+                         requestId,
+                         dataDict))
+        {
+            [observer
+                onViewModelDataReceived:reinterpret_cast<uint64_t>(handle)
+                              requestID:requestId
+                                   data:dataDict];
+        }
     }
 }
 
@@ -1183,6 +1509,7 @@ void _ViewModelInstanceListener::onViewModelListSizeReceived(
     std::string path,
     size_t size)
 {
+    _batch->flush();
     if (_observer)
     {
         NSString* nsPath = [NSString stringWithUTF8String:path.c_str()];
@@ -1199,6 +1526,7 @@ void _ViewModelInstanceListener::onViewModelInstanceViewModelNameReceived(
     uint64_t requestId,
     std::string viewModelName)
 {
+    _batch->flush();
     if (_observer)
     {
         NSString* nsName =
@@ -1216,6 +1544,7 @@ void _ViewModelInstanceListener::onViewModelInstanceNameReceived(
     uint64_t requestId,
     std::string instanceName)
 {
+    _batch->flush();
     if (_observer)
     {
         NSString* nsName = [NSString stringWithUTF8String:instanceName.c_str()];
@@ -1392,6 +1721,63 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
     }
 }
 
+/**
+ * Returns the size an encoded image occupies once decoded to RGBA8, read from
+ * its header without decoding it. Returns the encoded size if ImageIO cannot
+ * read the header.
+ */
+static size_t RiveDecodedImageByteCount(NSData* data)
+{
+    size_t byteCount = data.length;
+    CGImageSourceRef source =
+        CGImageSourceCreateWithData((__bridge CFDataRef)data, NULL);
+    if (source == NULL)
+    {
+        return byteCount;
+    }
+    NSDictionary* properties = CFBridgingRelease(
+        CGImageSourceCopyPropertiesAtIndex(source, 0, NULL));
+    CFRelease(source);
+    NSNumber* width = properties[(__bridge NSString*)kCGImagePropertyPixelWidth];
+    NSNumber* height =
+        properties[(__bridge NSString*)kCGImagePropertyPixelHeight];
+    if (width != nil && height != nil)
+    {
+        byteCount = width.unsignedLongValue * height.unsignedLongValue * 4;
+    }
+    return byteCount;
+}
+
+/// Returns a source that shares data, rather than copying it, and copies it
+/// only when a global asset is decoded again. Returns null for empty data.
+static rive::GlobalAssetRegistry::EncodedBytesSource RiveEncodedBytesSource(
+    NSData* _Nullable data)
+{
+    if (data.length == 0)
+    {
+        return nullptr;
+    }
+    NSData* shared = [data copy];
+    return [shared]() {
+        const uint8_t* bytes = static_cast<const uint8_t*>(shared.bytes);
+        return std::vector<uint8_t>(bytes, bytes + shared.length);
+    };
+}
+
+static NSString* RiveGlobalAssetTypeName(
+    rive::GlobalAssetRegistry::AssetType type)
+{
+    switch (type)
+    {
+        case rive::GlobalAssetRegistry::AssetType::image:
+            return @"image";
+        case rive::GlobalAssetRegistry::AssetType::font:
+            return @"font";
+        case rive::GlobalAssetRegistry::AssetType::audio:
+            return @"audio";
+    }
+}
+
 /**
  * A concrete implementation of RiveCommandQueueProtocol that bridges with the
  * C++ command queue.
@@ -1411,6 +1797,14 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
     /** Dictionary mapping view model instance handles to their listeners for
      * proper cleanup */
     NSMutableDictionary<NSNumber*, NSValue*>* _viewModelInstanceListeners;
+    /** View model data received while processing messages, delivered to
+     * observers once processing finishes */
+    std::unique_ptr<_ViewModelDataBatch> _viewModelDataBatch;
+    /** Property writes not yet sent to the server */
+    std::unique_ptr<_PropertyWriteBuffer> _propertyWrites;
+    /** Results posted by runOnce commands, shared with the server since it may
+     * outlive the queue */
+    std::shared_ptr<_ServerResults> _serverResults;
     /** Dictionary mapping render image handles to their listeners for proper
      * cleanup */
     NSMutableDictionary<NSNumber*, NSValue*>* _renderImageListeners;
@@ -1419,6 +1813,10 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
     /** Dictionary mapping audio handles to their listeners for proper cleanup
      */
     NSMutableDictionary<NSNumber*, NSValue*>* _audioListeners;
+    /** The global assets registered on the server, with their accounting */
+    std::unique_ptr<rive::GlobalAssetRegistry> _globalAssets;
+    /** Trims global assets when the system is low on memory */
+    dispatch_source_t _memoryPressureSource;
     /** The next request ID to use when making a request via command queue */
     uint64_t _nextRequestID;
     /** High-frequency polling source used for processing queued messages */
@@ -1448,11 +1846,27 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
         _artboardListeners = [[NSMutableDictionary alloc] init];
         _stateMachineListeners = [[NSMutableDictionary alloc] init];
         _viewModelInstanceListeners = [[NSMutableDictionary alloc] init];
+        _viewModelDataBatch = std::make_unique<_ViewModelDataBatch>();
+        _propertyWrites = std::make_unique<_PropertyWriteBuffer>();
+        _serverResults = std::make_shared<_ServerResults>();
         _renderImageListeners = [[NSMutableDictionary alloc] init];
         _fontListeners = [[NSMutableDictionary alloc] init];
         _audioListeners = [[NSMutableDictionary alloc] init];
+        _globalAssets =
+            std::make_unique<rive::GlobalAssetRegistry>(_commandQueue);
         _nextRequestID = 0;
         _isProcessTimerArmed = NO;
+
+        __weak RiveCommandQueue* weakSelf = self;
+        _memoryPressureSource = dispatch_source_create(
+            DISPATCH_SOURCE_TYPE_MEMORYPRESSURE,
+            0,
+            DISPATCH_MEMORYPRESSURE_WARN | DISPATCH_MEMORYPRESSURE_CRITICAL,
+            dispatch_get_main_queue());
+        dispatch_source_set_event_handler(_memoryPressureSource, ^{
+          [weakSelf trimGlobalAssets];
+        });
+        dispatch_resume(_memoryPressureSource);
     }
     return self;
 }
@@ -1469,6 +1883,12 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
         _isProcessTimerArmed = NO;
     }
 
+    if (_memoryPressureSource != nil)
+    {
+        dispatch_source_cancel(_memoryPressureSource);
+        _memoryPressureSource = nil;
+    }
+
     // Clean up all file listeners
     for (NSValue* listenerValue in _fileListeners.allValues)
     {
@@ -1526,6 +1946,7 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
         delete listener;
     }
 
+    _globalAssets = nullptr;
     _commandQueue = nullptr;
     _fileListeners = nil;
     _artboardListeners = nil;
@@ -1560,6 +1981,7 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 {
     [_RiveMainActor
         assertIsolated:@"Worker calls must be made on the MainActor."];
+    _propertyWrites->flush(_commandQueue.get());
     _commandQueue->disconnect();
 }
 
@@ -1641,13 +2063,17 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
       const uint8_t* bytes = static_cast<const uint8_t*>(data.bytes);
       size_t length = data.length;
 
+      // Restore evicted global assets before the server imports the file.
+      self->_globalAssets->willLoadFile();
       auto handle = self->_commandQueue->loadFile(
           std::vector<uint8_t>(bytes, bytes + length),
           listener.get(),
           requestID);
 
-      // Store the listener so it doesn't get deallocated
       uint64_t fileHandleUInt = reinterpret_cast<uint64_t>(handle);
+      self->_globalAssets->didLoadFile(fileHandleUInt);
+
+      // Store the listener so it doesn't get deallocated
       self->_fileListeners[@(fileHandleUInt)] =
           [NSValue valueWithPointer:listener.release()];
 
@@ -1670,6 +2096,7 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
     [self executeCommand:^{
       auto handle = reinterpret_cast<rive::FileHandle>(file);
       self->_commandQueue->deleteFile(handle, requestID);
+      self->_globalAssets->didDeleteFile(file);
     }];
 }
 
@@ -1695,6 +2122,40 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
     }];
 }
 
+- (void)requestFileMetadata:(uint64_t)fileHandle requestID:(uint64_t)requestID
+{
+    [self executeCommand:^{
+      NSValue* listenerValue = self->_fileListeners[@(fileHandle)];
+      if (listenerValue == nil)
+      {
+          return;
+      }
+      auto handle = reinterpret_cast<rive::FileHandle>(fileHandle);
+      std::shared_ptr<_ServerResults> results = self->_serverResults;
+      self->_commandQueue->runOnce(
+          [handle, fileHandle, requestID, results](
+              rive::CommandServer* server) {
+              rive::File* file = server->getFile(handle);
+              NSDictionary* metadata =
+                  file != nullptr ? RiveFileMetadataDictionary(file) : nil;
+              results->post(^(RiveCommandQueue* queue) {
+                id<RiveFileListener> observer =
+                    [queue fileObserverForHandle:fileHandle];
+                if (metadata == nil)
+                {
+                    [observer onFileError:fileHandle
+                                requestID:requestID
+                                  message:@"Invalid file handle"];
+                    return;
+                }
+                [observer onFileMetadataListed:fileHandle
+                                     requestID:requestID
+                                      metadata:metadata];
+              });
+          });
+    }];
+}
+
 - (void)requestViewModelNames:(uint64_t)fileHandle requestID:(uint64_t)requestID
 {
     [self executeCommand:^{
@@ -2139,7 +2600,8 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 {
     return [self executeCommandWithReturn:^uint64_t {
       // Create a new listener for this specific observer
-      auto listener = std::make_unique<_ViewModelInstanceListener>(observer);
+      auto listener = std::make_unique<_ViewModelInstanceListener>(
+          observer, self->_viewModelDataBatch.get());
 
       rive::ViewModelInstanceHandle handle =
           self->_commandQueue->instantiateBlankViewModelInstance(
@@ -2167,7 +2629,8 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 {
     return [self executeCommandWithReturn:^uint64_t {
       // Create a new listener for this specific observer
-      auto listener = std::make_unique<_ViewModelInstanceListener>(observer);
+      auto listener = std::make_unique<_ViewModelInstanceListener>(
+          observer, self->_viewModelDataBatch.get());
 
       auto stdName = std::string([viewModelName UTF8String]);
       rive::ViewModelInstanceHandle handle =
@@ -2197,7 +2660,8 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 {
     return [self executeCommandWithReturn:^uint64_t {
       // Create a new listener for this specific observer
-      auto listener = std::make_unique<_ViewModelInstanceListener>(observer);
+      auto listener = std::make_unique<_ViewModelInstanceListener>(
+          observer, self->_viewModelDataBatch.get());
 
       rive::ViewModelInstanceHandle handle =
           self->_commandQueue->instantiateDefaultViewModelInstance(
@@ -2225,7 +2689,8 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 {
     return [self executeCommandWithReturn:^uint64_t {
       // Create a new listener for this specific observer
-      auto listener = std::make_unique<_ViewModelInstanceListener>(observer);
+      auto listener = std::make_unique<_ViewModelInstanceListener>(
+          observer, self->_viewModelDataBatch.get());
 
       auto stdName = std::string([viewModelName UTF8String]);
       rive::ViewModelInstanceHandle handle =
@@ -2253,7 +2718,8 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
                                requestID:(uint64_t)requestID
 {
     return [self executeCommandWithReturn:^uint64_t {
-      auto listener = std::make_unique<_ViewModelInstanceListener>(observer);
+      auto listener = std::make_unique<_ViewModelInstanceListener>(
+          observer, self->_viewModelDataBatch.get());
 
       auto stdInstanceName = std::string([instanceName UTF8String]);
       rive::ViewModelInstanceHandle handle =
@@ -2281,7 +2747,8 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
                                requestID:(uint64_t)requestID
 {
     return [self executeCommandWithReturn:^uint64_t {
-      auto listener = std::make_unique<_ViewModelInstanceListener>(observer);
+      auto listener = std::make_unique<_ViewModelInstanceListener>(
+          observer, self->_viewModelDataBatch.get());
 
       auto stdViewModelName = std::string([viewModelName UTF8String]);
       auto stdInstanceName = std::string([instanceName UTF8String]);
@@ -2400,47 +2867,254 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
     }];
 }
 
-- (void)setViewModelInstanceString:(uint64_t)viewModelInstanceHandle
-                              path:(NSString*)path
-                             value:(NSString*)value
-                         requestID:(uint64_t)requestID
+- (void)requestViewModelInstanceSnapshot:(uint64_t)viewModelInstanceHandle
+                               requestID:(uint64_t)requestID
 {
     [self executeCommand:^{
+      NSValue* listenerValue =
+          self->_viewModelInstanceListeners[@(viewModelInstanceHandle)];
+      if (listenerValue == nil)
+      {
+          return;
+      }
       auto handle = reinterpret_cast<rive::ViewModelInstanceHandle>(
           viewModelInstanceHandle);
-      auto stdPath = std::string([path UTF8String]);
-      auto stdValue = std::string([value UTF8String]);
-      self->_commandQueue->setViewModelInstanceString(
-          handle, stdPath, stdValue, requestID);
+      std::shared_ptr<_ServerResults> results = self->_serverResults;
+      self->_commandQueue->runOnce([handle,
+                                    viewModelInstanceHandle,
+                                    requestID,
+                                    results](rive::CommandServer* server) {
+          rive::ViewModelInstanceRuntime* instance =
+              server->getViewModelInstance(handle);
+          NSData* snapshot = nil;
+          std::string error;
+          std::vector<uint8_t> bytes;
+          if (instance == nullptr)
+          {
+              error = "Invalid view model instance handle";
+          }
+          else if (rive::ViewModelInstanceSnapshot::capture(
+                       instance, &bytes, &error))
+          {
+              snapshot = [NSData dataWithBytes:bytes.data()
+                                        length:bytes.size()];
+          }
+          NSString* message = [NSString stringWithUTF8String:error.c_str()];
+          results->post(^(RiveCommandQueue* queue) {
+            id<RiveViewModelInstanceListener> observer =
+                [queue viewModelInstanceObserverForHandle:
+                           viewModelInstanceHandle];
+            if (snapshot == nil)
+            {
+                [observer onViewModelInstanceError:viewModelInstanceHandle
+                                         requestID:requestID
+                                           message:message];
+                return;
+            }
+            [observer
+                onViewModelInstanceSnapshotReceived:viewModelInstanceHandle
+                                          requestID:requestID
+                                           snapshot:snapshot];
+          });
+      });
     }];
 }
 
-- (void)setViewModelInstanceNumber:(uint64_t)viewModelInstanceHandle
-                              path:(NSString*)path
-                             value:(float)value
+- (void)restoreViewModelInstance:(uint64_t)viewModelInstanceHandle
+                    fromSnapshot:(NSData*)snapshot
+                       requestID:(uint64_t)requestID
+{
+    [self executeCommand:^{
+      NSValue* listenerValue =
+          self->_viewModelInstanceListeners[@(viewModelInstanceHandle)];
+      if (listenerValue == nil)
+      {
+          return;
+      }
+      auto handle = reinterpret_cast<rive::ViewModelInstanceHandle>(
+          viewModelInstanceHandle);
+      std::shared_ptr<_ServerResults> results = self->_serverResults;
+      const uint8_t* bytes = static_cast<const uint8_t*>(snapshot.bytes);
+      std::vector<uint8_t> data(bytes, bytes + snapshot.length);
+      self->_commandQueue->runOnce(
+          [handle,
+           viewModelInstanceHandle,
+           requestID,
+           results,
+           data = std::move(data)](rive::CommandServer* server) {
+              rive::ViewModelInstanceRuntime* instance =
+                  server->getViewModelInstance(handle);
+              std::string error;
+              bool restored = false;
+              if (instance == nullptr)
+              {
+                  error = "Invalid view model instance handle";
+              }
+              else
+              {
+                  restored = rive::ViewModelInstanceSnapshot::restore(
+                      instance, data.data(), data.size(), &error);
+              }
+              NSString* message =
+                  [NSString stringWithUTF8String:error.c_str()];
+              results->post(^(RiveCommandQueue* queue) {
+                id<RiveViewModelInstanceListener> observer =
+                    [queue viewModelInstanceObserverForHandle:
+                               viewModelInstanceHandle];
+                if (!restored)
+                {
+                    [observer onViewModelInstanceError:viewModelInstanceHandle
+                                             requestID:requestID
+                                               message:message];
+                    return;
+                }
+                [observer onViewModelInstanceRestored:viewModelInstanceHandle
+                                            requestID:requestID];
+              });
+          });
+    }];
+}
+
+- (void)applyViewModelInstanceJSON:(uint64_t)viewModelInstanceHandle
+                              json:(NSData*)json
+                           mapping:
+                               (nullable NSDictionary<NSString*, NSString*>*)
+                                   mapping
                          requestID:(uint64_t)requestID
 {
     [self executeCommand:^{
+      NSValue* listenerValue =
+          self->_viewModelInstanceListeners[@(viewModelInstanceHandle)];
+      if (listenerValue == nil)
+      {
+          return;
+      }
       auto handle = reinterpret_cast<rive::ViewModelInstanceHandle>(
           viewModelInstanceHandle);
-      auto stdPath = std::string([path UTF8String]);
-      self->_commandQueue->setViewModelInstanceNumber(
-          handle, stdPath, value, requestID);
+      std::shared_ptr<_ServerResults> results = self->_serverResults;
+      const uint8_t* bytes = static_cast<const uint8_t*>(json.bytes);
+      std::vector<uint8_t> data(bytes, bytes + json.length);
+      rive::ViewModelInstanceJSONBinder::Mapping stdMapping;
+      [mapping enumerateKeysAndObjectsUsingBlock:^(
+                   NSString* field, NSString* property, BOOL* stop) {
+        stdMapping.emplace(std::string([field UTF8String]),
+                           std::string([property UTF8String]));
+      }];
+      self->_commandQueue->runOnce(
+          [handle,
+           viewModelInstanceHandle,
+           requestID,
+           results,
+           data = std::move(data),
+           stdMapping = std::move(stdMapping)](rive::CommandServer* server) {
+              rive::ViewModelInstanceRuntime* instance =
+                  server->getViewModelInstance(handle);
+              rive::ViewModelInstanceJSONBinder::Result result;
+              std::string error;
+              bool applied = false;
+              if (instance == nullptr)
+              {
+                  error = "Invalid view model instance handle";
+              }
+              else
+              {
+                  applied = rive::ViewModelInstanceJSONBinder::apply(
+                      instance,
+                      data.data(),
+                      data.size(),
+                      stdMapping,
+                      &result,
+                      &error);
+              }
+              NSString* message =
+                  [NSString stringWithUTF8String:error.c_str()];
+              NSUInteger appliedCount = result.applied;
+              NSMutableArray<NSString*>* skippedFields =
+                  [NSMutableArray arrayWithCapacity:result.skipped.size()];
+              for (const std::string& field : result.skipped)
+              {
+                  // Document keys are not validated as UTF-8, so may not
+                  // convert.
+                  NSString* name =
+                      [NSString stringWithUTF8String:field.c_str()];
+                  if (name != nil)
+                  {
+                      [skippedFields addObject:name];
+                  }
+              }
+              NSMutableArray<NSString*>* missingFields =
+                  [NSMutableArray arrayWithCapacity:result.missing.size()];
+              for (const std::string& field : result.missing)
+              {
+                  [missingFields
+                      addObject:[NSString
+                                    stringWithUTF8String:field.c_str()]];
+              }
+              results->post(^(RiveCommandQueue* queue) {
+                id<RiveViewModelInstanceListener> observer =
+                    [queue viewModelInstanceObserverForHandle:
+                               viewModelInstanceHandle];
+                if (!applied)
+                {
+                    [observer onViewModelInstanceError:viewModelInstanceHandle
+                                             requestID:requestID
+                                               message:message];
+                    return;
+                }
+                [observer
+                    onViewModelInstanceJSONApplied:viewModelInstanceHandle
+                                         requestID:requestID
+                                      appliedCount:appliedCount
+                                     skippedFields:skippedFields
+                                     missingFields:missingFields];
+              });
+          });
     }];
 }
 
+- (void)setViewModelInstanceString:(uint64_t)viewModelInstanceHandle
+                              path:(NSString*)path
+                             value:(NSString*)value
+                         requestID:(uint64_t)requestID
+{
+    _PropertyWriteBuffer::Write write;
+    write.kind = _PropertyWriteBuffer::Kind::string;
+    write.handle =
+        reinterpret_cast<rive::ViewModelInstanceHandle>(viewModelInstanceHandle);
+    write.path = std::string([path UTF8String]);
+    write.string = std::string([value UTF8String]);
+    write.requestID = requestID;
+    [self bufferPropertyWrite:std::move(write)];
+}
+
+- (void)setViewModelInstanceNumber:(uint64_t)viewModelInstanceHandle
+                              path:(NSString*)path
+                             value:(float)value
+                         requestID:(uint64_t)requestID
+{
+    _PropertyWriteBuffer::Write write;
+    write.kind = _PropertyWriteBuffer::Kind::number;
+    write.handle =
+        reinterpret_cast<rive::ViewModelInstanceHandle>(viewModelInstanceHandle);
+    write.path = std::string([path UTF8String]);
+    write.number = value;
+    write.requestID = requestID;
+    [self bufferPropertyWrite:std::move(write)];
+}
+
 - (void)setViewModelInstanceBool:(uint64_t)viewModelInstanceHandle
                             path:(NSString*)path
                            value:(BOOL)value
                        requestID:(uint64_t)requestID
 {
-    [self executeCommand:^{
-      auto handle = reinterpret_cast<rive::ViewModelInstanceHandle>(
-          viewModelInstanceHandle);
-      auto stdPath = std::string([path UTF8String]);
-      self->_commandQueue->setViewModelInstanceBool(
-          handle, stdPath, value, requestID);
-    }];
+    _PropertyWriteBuffer::Write write;
+    write.kind = _PropertyWriteBuffer::Kind::boolean;
+    write.handle =
+        reinterpret_cast<rive::ViewModelInstanceHandle>(viewModelInstanceHandle);
+    write.path = std::string([path UTF8String]);
+    write.boolean = static_cast<bool>(value);
+    write.requestID = requestID;
+    [self bufferPropertyWrite:std::move(write)];
 }
 
 - (void)setViewModelInstanceColor:(uint64_t)viewModelInstanceHandle
@@ -2448,14 +3122,14 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
                             value:(uint32_t)value
                         requestID:(uint64_t)requestID
 {
-    [self executeCommand:^{
-      auto handle = reinterpret_cast<rive::ViewModelInstanceHandle>(
-          viewModelInstanceHandle);
-      auto stdPath = std::string([path UTF8String]);
-      rive::ColorInt colorValue = static_cast<rive::ColorInt>(value);
-      self->_commandQueue->setViewModelInstanceColor(
-          handle, stdPath, colorValue, requestID);
-    }];
+    _PropertyWriteBuffer::Write write;
+    write.kind = _PropertyWriteBuffer::Kind::color;
+    write.handle =
+        reinterpret_cast<rive::ViewModelInstanceHandle>(viewModelInstanceHandle);
+    write.path = std::string([path UTF8String]);
+    write.color = static_cast<rive::ColorInt>(value);
+    write.requestID = requestID;
+    [self bufferPropertyWrite:std::move(write)];
 }
 
 - (void)setViewModelInstanceEnum:(uint64_t)viewModelInstanceHandle
@@ -2463,14 +3137,14 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
                            value:(NSString*)value
                        requestID:(uint64_t)requestID
 {
-    [self executeCommand:^{
-      auto handle = reinterpret_cast<rive::ViewModelInstanceHandle>(
-          viewModelInstanceHandle);
-      auto stdPath = std::string([path UTF8String]);
-      auto stdValue = std::string([value UTF8String]);
-      self->_commandQueue->setViewModelInstanceEnum(
-          handle, stdPath, stdValue, requestID);
-    }];
+    _PropertyWriteBuffer::Write write;
+    write.kind = _PropertyWriteBuffer::Kind::enumType;
+    write.handle =
+        reinterpret_cast<rive::ViewModelInstanceHandle>(viewModelInstanceHandle);
+    write.path = std::string([path UTF8String]);
+    write.string = std::string([value UTF8String]);
+    write.requestID = requestID;
+    [self bufferPropertyWrite:std::move(write)];
 }
 
 - (void)setViewModelInstanceImage:(uint64_t)viewModelInstanceHandle
@@ -2620,6 +3294,24 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 - (void)deleteImage:(uint64_t)renderImage requestID:(uint64_t)requestID
 {
     [self executeCommand:^{
+      if (self->_globalAssets->takeOwnershipOfDeletedHandle(
+              rive::GlobalAssetRegistry::AssetType::image, renderImage))
+      {
+          // The image is still registered; the registry deletes it once it is
+          // removed or evicted.
+          [self notifyDeletedHandle:renderImage
+                          listeners:self->_renderImageListeners
+                          requestID:requestID
+                             notify:^(NSValue* listenerValue) {
+                               static_cast<_RenderImageListener*>(
+                                   listenerValue.pointerValue)
+                                   ->onRenderImageDeleted(
+                                       reinterpret_cast<rive::RenderImageHandle>(
+                                           renderImage),
+                                       requestID);
+                             }];
+          return;
+      }
       auto handle = reinterpret_cast<rive::RenderImageHandle>(renderImage);
       self->_commandQueue->deleteImage(handle, requestID);
     }];
@@ -2641,12 +3333,17 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 
 - (void)addGlobalImageAsset:(NSString*)name
                 imageHandle:(uint64_t)imageHandle
+                encodedData:(nullable NSData*)data
                   requestID:(uint64_t)requestID
 {
     [self executeCommand:^{
       auto stdName = std::string([name UTF8String]);
-      auto handle = reinterpret_cast<rive::RenderImageHandle>(imageHandle);
-      self->_commandQueue->addGlobalImageAsset(stdName, handle, requestID);
+      self->_globalAssets->add(rive::GlobalAssetRegistry::AssetType::image,
+                               stdName,
+                               imageHandle,
+                               RiveEncodedBytesSource(data),
+                               RiveDecodedImageByteCount(data),
+                               requestID);
     }];
 }
 
@@ -2654,7 +3351,8 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 {
     [self executeCommand:^{
       auto stdName = std::string([name UTF8String]);
-      self->_commandQueue->removeGlobalImageAsset(stdName, requestID);
+      self->_globalAssets->remove(
+          rive::GlobalAssetRegistry::AssetType::image, stdName, requestID);
     }];
 }
 
@@ -2709,6 +3407,21 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 - (void)deleteFont:(uint64_t)font requestID:(uint64_t)requestID
 {
     [self executeCommand:^{
+      if (self->_globalAssets->takeOwnershipOfDeletedHandle(
+              rive::GlobalAssetRegistry::AssetType::font, font))
+      {
+          [self notifyDeletedHandle:font
+                          listeners:self->_fontListeners
+                          requestID:requestID
+                             notify:^(NSValue* listenerValue) {
+                               static_cast<_FontListener*>(
+                                   listenerValue.pointerValue)
+                                   ->onFontDeleted(
+                                       reinterpret_cast<rive::FontHandle>(font),
+                                       requestID);
+                             }];
+          return;
+      }
       auto handle = reinterpret_cast<rive::FontHandle>(font);
       self->_commandQueue->deleteFont(handle, requestID);
     }];
@@ -2730,12 +3443,17 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 
 - (void)addGlobalFontAsset:(NSString*)name
                 fontHandle:(uint64_t)fontHandle
+               encodedData:(nullable NSData*)data
                  requestID:(uint64_t)requestID
 {
     [self executeCommand:^{
       auto stdName = std::string([name UTF8String]);
-      auto handle = reinterpret_cast<rive::FontHandle>(fontHandle);
-      self->_commandQueue->addGlobalFontAsset(stdName, handle, requestID);
+      self->_globalAssets->add(rive::GlobalAssetRegistry::AssetType::font,
+                               stdName,
+                               fontHandle,
+                               RiveEncodedBytesSource(data),
+                               data.length,
+                               requestID);
     }];
 }
 
@@ -2743,7 +3461,8 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 {
     [self executeCommand:^{
       auto stdName = std::string([name UTF8String]);
-      self->_commandQueue->removeGlobalFontAsset(stdName, requestID);
+      self->_globalAssets->remove(
+          rive::GlobalAssetRegistry::AssetType::font, stdName, requestID);
     }];
 }
 
@@ -2775,6 +3494,22 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 - (void)deleteAudio:(uint64_t)audio requestID:(uint64_t)requestID
 {
     [self executeCommand:^{
+      if (self->_globalAssets->takeOwnershipOfDeletedHandle(
+              rive::GlobalAssetRegistry::AssetType::audio, audio))
+      {
+          [self notifyDeletedHandle:audio
+                          listeners:self->_audioListeners
+                          requestID:requestID
+                             notify:^(NSValue* listenerValue) {
+                               static_cast<_AudioListener*>(
+                                   listenerValue.pointerValue)
+                                   ->onAudioSourceDeleted(
+                                       reinterpret_cast<rive::AudioSourceHandle>(
+                                           audio),
+                                       requestID);
+                             }];
+          return;
+      }
       auto handle = reinterpret_cast<rive::AudioSourceHandle>(audio);
       self->_commandQueue->deleteAudio(handle, requestID);
     }];
@@ -2796,12 +3531,17 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 
 - (void)addGlobalAudioAsset:(NSString*)name
                 audioHandle:(uint64_t)audioHandle
+                encodedData:(nullable NSData*)data
                   requestID:(uint64_t)requestID
 {
     [self executeCommand:^{
       auto stdName = std::string([name UTF8String]);
-      auto handle = reinterpret_cast<rive::AudioSourceHandle>(audioHandle);
-      self->_commandQueue->addGlobalAudioAsset(stdName, handle, requestID);
+      self->_globalAssets->add(rive::GlobalAssetRegistry::AssetType::audio,
+                               stdName,
+                               audioHandle,
+                               RiveEncodedBytesSource(data),
+                               data.length,
+                               requestID);
     }];
 }
 
@@ -2809,10 +3549,82 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 {
     [self executeCommand:^{
       auto stdName = std::string([name UTF8String]);
-      self->_commandQueue->removeGlobalAudioAsset(stdName, requestID);
+      self->_globalAssets->remove(
+          rive::GlobalAssetRegistry::AssetType::audio, stdName, requestID);
+    }];
+}
+
+#pragma mark - Global Assets
+
+- (NSUInteger)globalAssetMemoryBudget
+{
+    return _globalAssets->memoryBudget();
+}
+
+- (void)setGlobalAssetMemoryBudget:(NSUInteger)globalAssetMemoryBudget
+{
+    [self executeCommand:^{
+      self->_globalAssets->setMemoryBudget(globalAssetMemoryBudget);
+    }];
+}
+
+- (NSUInteger)globalAssetResidentByteCount
+{
+    return _globalAssets->residentByteCount();
+}
+
+- (NSArray<NSDictionary<NSString*, id>*>*)globalAssetStatistics
+{
+    auto statistics = _globalAssets->statistics();
+    NSMutableArray* result =
+        [NSMutableArray arrayWithCapacity:statistics.size()];
+    for (const auto& asset : statistics)
+    {
+        [result addObject:@{
+            @"name" : [NSString stringWithUTF8String:asset.name.c_str()],
+            @"type" : RiveGlobalAssetTypeName(asset.type),
+            @"byteCount" : @(asset.byteCount),
+            @"resident" : @(asset.resident),
+            @"heldByClient" : @(asset.heldByClient),
+            @"fileReferenceCount" : @(asset.fileReferenceCount),
+            @"redecodeCount" : @(asset.redecodeCount),
+        }];
+    }
+    return result;
+}
+
+- (NSUInteger)trimGlobalAssets
+{
+    return [self executeCommandWithReturn:^uint64_t {
+      return self->_globalAssets->trim();
     }];
 }
 
+/**
+ * Delivers a delete the registry absorbed to the handle's listener, as the
+ * server would have, so that the caller's pending request completes. The
+ * delivery is posted from the server, after the commands sent before the
+ * delete, and processMessages hands it to the listener registered at that
+ * point, after the messages those commands produced.
+ */
+- (void)notifyDeletedHandle:(uint64_t)handle
+                  listeners:(NSDictionary<NSNumber*, NSValue*>*)listeners
+                  requestID:(uint64_t)requestID
+                     notify:(void (^)(NSValue*))notify
+{
+    std::shared_ptr<_ServerResults> results = _serverResults;
+    _commandQueue->runOnce(
+        [handle, listeners, notify, results](rive::CommandServer*) {
+            results->post(^(RiveCommandQueue*) {
+              NSValue* listenerValue = listeners[@(handle)];
+              if (listenerValue)
+              {
+                  notify(listenerValue);
+              }
+            });
+        });
+}
+
 - (uint64_t)
     referenceNestedViewModelInstance:(uint64_t)viewModelInstanceHandle
                                 path:(NSString*)path
@@ -2821,7 +3633,8 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
 {
     return [self executeCommandWithReturn:^uint64_t {
       // Create a new listener for this specific observer
-      auto listener = std::make_unique<_ViewModelInstanceListener>(observer);
+      auto listener = std::make_unique<_ViewModelInstanceListener>(
+          observer, self->_viewModelDataBatch.get());
 
       auto stdPath = std::string([path UTF8String]);
       auto vmiHandle = reinterpret_cast<rive::ViewModelInstanceHandle>(
@@ -2847,7 +3660,8 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
                          requestID:(uint64_t)requestID
 {
     return [self executeCommandWithReturn:^uint64_t {
-      auto listener = std::make_unique<_ViewModelInstanceListener>(observer);
+      auto listener = std::make_unique<_ViewModelInstanceListener>(
+          observer, self->_viewModelDataBatch.get());
 
       auto stdPath = std::string([path UTF8String]);
       auto vmiHandle = reinterpret_cast<rive::ViewModelInstanceHandle>(
@@ -2943,8 +3757,116 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
     }];
 }
 
+- (void)applyViewModelInstanceListDiff:(uint64_t)viewModelInstanceHandle
+                                  path:(NSString*)path
+                                values:(NSArray<NSNumber*>*)values
+                             requestID:(uint64_t)requestID
+{
+    [self executeCommand:^{
+      std::shared_ptr<_ServerResults> results = self->_serverResults;
+      auto handle = reinterpret_cast<rive::ViewModelInstanceHandle>(
+          viewModelInstanceHandle);
+      auto stdPath = std::string([path UTF8String]);
+      std::vector<rive::ViewModelInstanceHandle> targetHandles;
+      targetHandles.reserve(values.count);
+      for (NSNumber* value in values)
+      {
+          targetHandles.push_back(
+              reinterpret_cast<rive::ViewModelInstanceHandle>(
+                  value.unsignedLongLongValue));
+      }
+      self->_commandQueue->runOnce(
+          [handle,
+           viewModelInstanceHandle,
+           requestID,
+           results,
+           stdPath,
+           targetHandles =
+               std::move(targetHandles)](rive::CommandServer* server) {
+              std::string error;
+              rive::ViewModelInstanceRuntime* instance =
+                  server->getViewModelInstance(handle);
+              rive::ViewModelInstanceListRuntime* list =
+                  instance != nullptr ? instance->propertyList(stdPath)
+                                      : nullptr;
+              std::vector<rive::ViewModelInstanceRuntime*> target;
+              target.reserve(targetHandles.size());
+              if (instance == nullptr)
+              {
+                  error = "Invalid view model instance handle";
+              }
+              else if (list == nullptr)
+              {
+                  error = "No list property at path '" + stdPath + "'";
+              }
+              else
+              {
+                  for (auto targetHandle : targetHandles)
+                  {
+                      auto item = server->getViewModelInstance(targetHandle);
+                      if (item == nullptr)
+                      {
+                          error = "Invalid view model instance handle in "
+                                  "list values";
+                          break;
+                      }
+                      target.push_back(item);
+                  }
+              }
+              if (error.empty())
+              {
+                  rive::ViewModelInstanceListDiff::apply(
+                      list, target, nullptr, &error);
+              }
+              if (error.empty())
+              {
+                  return;
+              }
+              NSString* message = [NSString stringWithUTF8String:error.c_str()];
+              results->post(^(RiveCommandQueue* queue) {
+                [[queue viewModelInstanceObserverForHandle:
+                            viewModelInstanceHandle]
+                    onViewModelInstanceError:viewModelInstanceHandle
+                                         requestID:requestID
+                                           message:message];
+              });
+          });
+    }];
+}
+
 #pragma mark - Private
 
+/**
+ * Returns the observer of the listener registered for a file, or nil if the
+ * file has none, e.g. because it was deleted.
+ */
+- (nullable id<RiveFileListener>)fileObserverForHandle:(uint64_t)fileHandle
+{
+    NSValue* listenerValue = _fileListeners[@(fileHandle)];
+    if (listenerValue == nil)
+    {
+        return nil;
+    }
+    return static_cast<_FileListener*>(listenerValue.pointerValue)->observer();
+}
+
+/**
+ * Returns the observer of the listener registered for a view model instance,
+ * or nil if the instance has none, e.g. because it was deleted.
+ */
+- (nullable id<RiveViewModelInstanceListener>)
+    viewModelInstanceObserverForHandle:(uint64_t)viewModelInstanceHandle
+{
+    NSValue* listenerValue =
+        _viewModelInstanceListeners[@(viewModelInstanceHandle)];
+    if (listenerValue == nil)
+    {
+        return nil;
+    }
+    return static_cast<_ViewModelInstanceListener*>(listenerValue.pointerValue)
+        ->observer();
+}
+
 /**
  * Returns the underlying C++ command queue instance.
  *
@@ -2958,6 +3880,23 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
     return _commandQueue;
 }
 
+/**
+ * Buffers a property write until messages are next processed or another
+ * command is executed, replacing any pending write to the same property.
+ */
+- (void)bufferPropertyWrite:(_PropertyWriteBuffer::Write)write
+{
+    [_RiveMainActor
+        assertIsolated:@"Worker calls must be made on the MainActor."];
+
+    _propertyWrites->add(std::move(write));
+}
+
+- (uint64_t)coalescedPropertyWriteCount
+{
+    return _propertyWrites->coalescedCount();
+}
+
 /**
  * Executes a command block with proper setup and teardown.
  *
@@ -2973,6 +3912,7 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
     [_RiveMainActor
         assertIsolated:@"Worker calls must be made on the MainActor."];
 
+    _propertyWrites->flush(_commandQueue.get());
     commandBlock();
 }
 
@@ -2993,6 +3933,7 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
     [_RiveMainActor
         assertIsolated:@"Worker calls must be made on the MainActor."];
 
+    _propertyWrites->flush(_commandQueue.get());
     uint64_t result = commandBlock();
 
     return result;
@@ -3010,8 +3951,19 @@ void _AudioListener::onAudioSourceDeleted(const rive::AudioSourceHandle handle,
  */
 - (void)processMessages
 {
+    // Writes buffered since the last frame go out before the frame's messages
+    // are drained and its state machines advance.
+    _propertyWrites->flush(_commandQueue.get());
+    // Take the server's own results before draining, so that every message
+    // the server sent before a result has been queued and is delivered first.
+    std::vector<_ServerResults::Delivery> results = _serverResults->take();
     // Process messages directly since we're already on the main queue
     _commandQueue->processMessages();
+    _viewModelDataBatch->flush();
+    for (_ServerResults::Delivery deliver : results)
+    {
+        deliver(self);
+    }
 }
 
 @end
@@ -0,0 +1,767 @@
+//
+//  ViewModelInstanceJSONBinder.cpp
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#include "ViewModelInstanceJSONBinder.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <unordered_set>
+
+namespace rive
+{
+
+// Objects and arrays nest by recursion, so bound the depth of a document.
+constexpr static int kMaxDepth = 64;
+
+namespace
+{
+enum class ScalarType
+{
+    string,
+    number,
+    boolean,
+};
+
+// A string holds its unescaped value in text, and a number its literal.
+struct Scalar
+{
+    ScalarType type;
+    std::string text;
+    bool boolean = false;
+};
+
+// The property at a path, at most one of which is set.
+struct Target
+{
+    ViewModelInstanceNumberRuntime* number = nullptr;
+    ViewModelInstanceStringRuntime* string = nullptr;
+    ViewModelInstanceBooleanRuntime* boolean = nullptr;
+    ViewModelInstanceColorRuntime* color = nullptr;
+    ViewModelInstanceEnumRuntime* enumProperty = nullptr;
+};
+
+struct Write
+{
+    Target target;
+    float number = 0;
+    std::string string;
+    bool boolean = false;
+    int color = 0;
+};
+
+// Whether the fields of a value bind to properties.
+enum class Binding
+{
+    // Bound to the property path carried alongside.
+    bound,
+    // Not bound, though a mapping entry for a field may bind it.
+    unbound,
+    // Inside an array, where nothing binds.
+    ignored,
+};
+
+const char* skipDigits(const char* c, const char* end)
+{
+    while (c != end && *c >= '0' && *c <= '9')
+    {
+        c++;
+    }
+    return c;
+}
+
+// Whether text is exactly a JSON number: an optional minus sign, an integer
+// part without leading zeros, and optional fraction and exponent. Leading or
+// trailing whitespace, a plus sign, hexadecimal, "inf" and "nan" are not.
+bool isDecimalNumber(const std::string& text)
+{
+    const char* c = text.c_str();
+    const char* end = c + text.size();
+    if (c != end && *c == '-')
+    {
+        c++;
+    }
+    if (c != end && *c == '0')
+    {
+        c++;
+    }
+    else
+    {
+        const char* start = c;
+        c = skipDigits(c, end);
+        if (c == start)
+        {
+            return false;
+        }
+    }
+    if (c != end && *c == '.')
+    {
+        const char* start = ++c;
+        c = skipDigits(c, end);
+        if (c == start)
+        {
+            return false;
+        }
+    }
+    if (c != end && (*c == 'e' || *c == 'E'))
+    {
+        c++;
+        if (c != end && (*c == '+' || *c == '-'))
+        {
+            c++;
+        }
+        const char* start = c;
+        c = skipDigits(c, end);
+        if (c == start)
+        {
+            return false;
+        }
+    }
+    return c == end;
+}
+
+bool parseNumber(const std::string& text, double* value)
+{
+    if (!isDecimalNumber(text))
+    {
+        return false;
+    }
+    // The text is validated above, so strtod consumes all of it.
+    *value = std::strtod(text.c_str(), nullptr);
+    return std::isfinite(*value);
+}
+
+bool parseHex(const char* digits, size_t count, uint32_t* value)
+{
+    *value = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        char c = digits[i];
+        uint32_t digit;
+        if (c >= '0' && c <= '9')
+        {
+            digit = c - '0';
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            digit = c - 'a' + 10;
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            digit = c - 'A' + 10;
+        }
+        else
+        {
+            return false;
+        }
+        *value = (*value << 4) | digit;
+    }
+    return true;
+}
+
+bool toNumber(const Scalar& scalar, float* value)
+{
+    double number;
+    switch (scalar.type)
+    {
+        case ScalarType::number:
+        case ScalarType::string:
+            // Number properties are floats, so the value is rounded to the
+            // nearest float. Values beyond the range of a float are rejected.
+            if (!parseNumber(scalar.text, &number) ||
+                std::fabs(number) > std::numeric_limits<float>::max())
+            {
+                return false;
+            }
+            *value = static_cast<float>(number);
+            return true;
+        case ScalarType::boolean:
+            *value = scalar.boolean ? 1.0f : 0.0f;
+            return true;
+    }
+    return false;
+}
+
+bool toString(const Scalar& scalar, std::string* value)
+{
+    switch (scalar.type)
+    {
+        case ScalarType::number:
+        case ScalarType::string:
+            *value = scalar.text;
+            return true;
+        case ScalarType::boolean:
+            *value = scalar.boolean ? "true" : "false";
+            return true;
+    }
+    return false;
+}
+
+bool toBoolean(const Scalar& scalar, bool* value)
+{
+    double number;
+    switch (scalar.type)
+    {
+        case ScalarType::boolean:
+            *value = scalar.boolean;
+            return true;
+        case ScalarType::number:
+            // Only 0 and 1 convert, so that no other number is lost.
+            if (!parseNumber(scalar.text, &number) ||
+                (number != 0 && number != 1))
+            {
+                return false;
+            }
+            *value = number == 1;
+            return true;
+        case ScalarType::string:
+            if (scalar.text == "true")
+            {
+                *value = true;
+                return true;
+            }
+            if (scalar.text == "false")
+            {
+                *value = false;
+                return true;
+            }
+            return false;
+    }
+    return false;
+}
+
+// Colors are 0xAARRGGBB, as a number or as "#RRGGBB" or "#AARRGGBB".
+bool toColor(const Scalar& scalar, int* value)
+{
+    uint32_t color;
+    double number;
+    switch (scalar.type)
+    {
+        case ScalarType::number:
+            if (!parseNumber(scalar.text, &number) || number < 0 ||
+                number > 0xFFFFFFFF || number != std::floor(number))
+            {
+                return false;
+            }
+            color = static_cast<uint32_t>(number);
+            break;
+        case ScalarType::string:
+        {
+            const std::string& text = scalar.text;
+            if (text.size() == 7 && text[0] == '#' &&
+                parseHex(text.c_str() + 1, 6, &color))
+            {
+                color |= 0xFF000000;
+            }
+            else if (text.size() != 9 || text[0] != '#' ||
+                     !parseHex(text.c_str() + 1, 8, &color))
+            {
+                return false;
+            }
+            break;
+        }
+        case ScalarType::boolean:
+            return false;
+    }
+    *value = static_cast<int>(color);
+    return true;
+}
+
+class Parser
+{
+public:
+    Parser(const uint8_t* bytes,
+           size_t length,
+           ViewModelInstanceRuntime* instance,
+           const ViewModelInstanceJSONBinder::Mapping& mapping,
+           ViewModelInstanceJSONBinder::Result* result) :
+        m_start(bytes),
+        m_bytes(bytes),
+        m_end(bytes + length),
+        m_instance(instance),
+        m_mapping(mapping),
+        m_result(result)
+    {}
+
+    bool parse(std::string* error)
+    {
+        Binding binding = m_mapping.empty() ? Binding::bound : Binding::unbound;
+        bool parsed = value(std::string(), binding, std::string(), 0);
+        skipWhitespace();
+        if (!parsed || m_bytes != m_end)
+        {
+            *error = m_error.empty()
+                         ? "Malformed JSON at offset " +
+                               std::to_string(m_bytes - m_start)
+                         : m_error;
+            return false;
+        }
+        return true;
+    }
+
+    const std::vector<Write>& writes() const { return m_writes; }
+
+    const std::unordered_set<std::string>& mappedFields() const
+    {
+        return m_mappedFields;
+    }
+
+private:
+    void skipWhitespace()
+    {
+        while (m_bytes != m_end && (*m_bytes == ' ' || *m_bytes == '\n' ||
+                                    *m_bytes == '\r' || *m_bytes == '\t'))
+        {
+            m_bytes++;
+        }
+    }
+
+    bool consume(uint8_t byte)
+    {
+        skipWhitespace();
+        if (m_bytes == m_end || *m_bytes != byte)
+        {
+            return false;
+        }
+        m_bytes++;
+        return true;
+    }
+
+    bool value(const std::string& path,
+               Binding binding,
+               const std::string& target,
+               int depth)
+    {
+        if (depth > kMaxDepth)
+        {
+            m_error = "JSON nests deeper than " + std::to_string(kMaxDepth);
+            return false;
+        }
+        skipWhitespace();
+        if (m_bytes == m_end)
+        {
+            return false;
+        }
+        Scalar scalar;
+        switch (*m_bytes)
+        {
+            case '{':
+                return object(path, binding, target, depth);
+            case '[':
+                if (binding == Binding::bound)
+                {
+                    m_result->skipped.push_back(path);
+                }
+                return array(path, depth);
+            case '"':
+                scalar.type = ScalarType::string;
+                if (!string(&scalar.text))
+                {
+                    return false;
+                }
+                break;
+            case 't':
+            case 'f':
+                scalar.type = ScalarType::boolean;
+                scalar.boolean = *m_bytes == 't';
+                if (!literal(scalar.boolean ? "true" : "false"))
+                {
+                    return false;
+                }
+                break;
+            case 'n':
+                // Nulls leave their property as it is.
+                return literal("null");
+            default:
+                scalar.type = ScalarType::number;
+                if (!number(&scalar.text))
+                {
+                    return false;
+                }
+                break;
+        }
+        if (binding == Binding::bound)
+        {
+            bind(path, target, scalar);
+        }
+        return true;
+    }
+
+    bool object(const std::string& path,
+                Binding binding,
+                const std::string& target,
+                int depth)
+    {
+        m_bytes++;
+        if (consume('}'))
+        {
+            return true;
+        }
+        std::string key;
+        do
+        {
+            skipWhitespace();
+            if (!string(&key) || !consume(':'))
+            {
+                return false;
+            }
+            std::string childPath = path.empty() ? key : path + "/" + key;
+            Binding childBinding = Binding::ignored;
+            std::string childTarget;
+            if (binding != Binding::ignored)
+            {
+                auto mapped = m_mapping.find(childPath);
+                if (mapped != m_mapping.end())
+                {
+                    m_mappedFields.insert(childPath);
+                    childBinding = Binding::bound;
+                    childTarget = mapped->second;
+                }
+                else if (binding == Binding::bound)
+                {
+                    childBinding = Binding::bound;
+                    childTarget = target.empty() ? key : target + "/" + key;
+                }
+                else
+                {
+                    childBinding = Binding::unbound;
+                }
+            }
+            if (!value(childPath, childBinding, childTarget, depth + 1))
+            {
+                return false;
+            }
+        } while (consume(','));
+        return consume('}');
+    }
+
+    bool array(const std::string& path, int depth)
+    {
+        m_bytes++;
+        if (consume(']'))
+        {
+            return true;
+        }
+        do
+        {
+            if (!value(path, Binding::ignored, std::string(), depth + 1))
+            {
+                return false;
+            }
+        } while (consume(','));
+        return consume(']');
+    }
+
+    bool literal(const char* text)
+    {
+        for (; *text != '\0'; text++, m_bytes++)
+        {
+            if (m_bytes == m_end || *m_bytes != *text)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool digits()
+    {
+        const uint8_t* start = m_bytes;
+        while (m_bytes != m_end && *m_bytes >= '0' && *m_bytes <= '9')
+        {
+            m_bytes++;
+        }
+        return m_bytes != start;
+    }
+
+    bool number(std::string* text)
+    {
+        const uint8_t* start = m_bytes;
+        if (*m_bytes == '-')
+        {
+            m_bytes++;
+        }
+        if (m_bytes != m_end && *m_bytes == '0')
+        {
+            m_bytes++;
+        }
+        else if (!digits())
+        {
+            return false;
+        }
+        if (m_bytes != m_end && *m_bytes == '.')
+        {
+            m_bytes++;
+            if (!digits())
+            {
+                return false;
+            }
+        }
+        if (m_bytes != m_end && (*m_bytes == 'e' || *m_bytes == 'E'))
+        {
+            m_bytes++;
+            if (m_bytes != m_end && (*m_bytes == '+' || *m_bytes == '-'))
+            {
+                m_bytes++;
+            }
+            if (!digits())
+            {
+                return false;
+            }
+        }
+        text->assign(reinterpret_cast<const char*>(start), m_bytes - start);
+        return true;
+    }
+
+    bool hex4(uint32_t* value)
+    {
+        if (m_end - m_bytes < 4 ||
+            !parseHex(reinterpret_cast<const char*>(m_bytes), 4, value))
+        {
+            return false;
+        }
+        m_bytes += 4;
+        return true;
+    }
+
+    static void appendUTF8(uint32_t codePoint, std::string* text)
+    {
+        if (codePoint < 0x80)
+        {
+            text->push_back(static_cast<char>(codePoint));
+        }
+        else if (codePoint < 0x800)
+        {
+            text->push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+            text->push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+        else if (codePoint < 0x10000)
+        {
+            text->push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+            text->push_back(
+                static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            text->push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+        else
+        {
+            text->push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+            text->push_back(
+                static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+            text->push_back(
+                static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            text->push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+    }
+
+    bool string(std::string* text)
+    {
+        if (m_bytes == m_end || *m_bytes != '"')
+        {
+            return false;
+        }
+        m_bytes++;
+        text->clear();
+        while (true)
+        {
+            // Copy unescaped runs in one go.
+            const uint8_t* run = m_bytes;
+            while (m_bytes != m_end && *m_bytes != '"' && *m_bytes != '\\' &&
+                   *m_bytes >= 0x20)
+            {
+                m_bytes++;
+            }
+            text->append(reinterpret_cast<const char*>(run), m_bytes - run);
+            if (m_bytes == m_end || *m_bytes < 0x20)
+            {
+                return false;
+            }
+            if (*m_bytes++ == '"')
+            {
+                return true;
+            }
+            if (m_bytes == m_end)
+            {
+                return false;
+            }
+            uint32_t codePoint;
+            switch (*m_bytes++)
+            {
+                case '"':
+                    text->push_back('"');
+                    break;
+                case '\\':
+                    text->push_back('\\');
+                    break;
+                case '/':
+                    text->push_back('/');
+                    break;
+                case 'b':
+                    text->push_back('\b');
+                    break;
+                case 'f':
+                    text->push_back('\f');
+                    break;
+                case 'n':
+                    text->push_back('\n');
+                    break;
+                case 'r':
+                    text->push_back('\r');
+                    break;
+                case 't':
+                    text->push_back('\t');
+                    break;
+                case 'u':
+                    if (!hex4(&codePoint) ||
+                        (codePoint >= 0xDC00 && codePoint <= 0xDFFF))
+                    {
+                        return false;
+                    }
+                    if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+                    {
+                        uint32_t low;
+                        if (!literal("\\u") || !hex4(&low) || low < 0xDC00 ||
+                            low > 0xDFFF)
+                        {
+                            return false;
+                        }
+                        codePoint =
+                            0x10000 + ((codePoint - 0xD800) << 10) +
+                            (low - 0xDC00);
+                    }
+                    appendUTF8(codePoint, text);
+                    break;
+                default:
+                    return false;
+            }
+        }
+    }
+
+    const Target& resolve(const std::string& path)
+    {
+        auto cached = m_targets.find(path);
+        if (cached != m_targets.end())
+        {
+            return cached->second;
+        }
+        Target target;
+        if ((target.number = m_instance->propertyNumber(path)) == nullptr &&
+            (target.string = m_instance->propertyString(path)) == nullptr &&
+            (target.boolean = m_instance->propertyBoolean(path)) == nullptr &&
+            (target.color = m_instance->propertyColor(path)) == nullptr)
+        {
+            target.enumProperty = m_instance->propertyEnum(path);
+        }
+        return m_targets.emplace(path, target).first->second;
+    }
+
+    void bind(const std::string& path,
+              const std::string& targetPath,
+              const Scalar& scalar)
+    {
+        Write write;
+        write.target = resolve(targetPath);
+        const Target& target = write.target;
+        bool converted = false;
+        if (target.number != nullptr)
+        {
+            converted = toNumber(scalar, &write.number);
+        }
+        else if (target.string != nullptr)
+        {
+            converted = toString(scalar, &write.string);
+        }
+        else if (target.boolean != nullptr)
+        {
+            converted = toBoolean(scalar, &write.boolean);
+        }
+        else if (target.color != nullptr)
+        {
+            converted = toColor(scalar, &write.color);
+        }
+        else if (target.enumProperty != nullptr &&
+                 scalar.type == ScalarType::string)
+        {
+            auto values = target.enumProperty->values();
+            converted = std::find(values.begin(), values.end(), scalar.text) !=
+                        values.end();
+            write.string = scalar.text;
+        }
+        if (!converted)
+        {
+            m_result->skipped.push_back(path);
+            return;
+        }
+        m_writes.push_back(std::move(write));
+    }
+
+    const uint8_t* m_start;
+    const uint8_t* m_bytes;
+    const uint8_t* m_end;
+    ViewModelInstanceRuntime* m_instance;
+    const ViewModelInstanceJSONBinder::Mapping& m_mapping;
+    ViewModelInstanceJSONBinder::Result* m_result;
+    std::string m_error;
+    std::unordered_map<std::string, Target> m_targets;
+    std::unordered_set<std::string> m_mappedFields;
+    std::vector<Write> m_writes;
+};
+} // namespace
+
+bool ViewModelInstanceJSONBinder::apply(ViewModelInstanceRuntime* instance,
+                                        const uint8_t* json,
+                                        size_t length,
+                                        const Mapping& mapping,
+                                        Result* result,
+                                        std::string* error)
+{
+    Result parsed;
+    Parser parser(json, length, instance, mapping, &parsed);
+    if (!parser.parse(error))
+    {
+        return false;
+    }
+
+    for (const Write& write : parser.writes())
+    {
+        const Target& target = write.target;
+        if (target.number != nullptr)
+        {
+            target.number->value(write.number);
+        }
+        else if (target.string != nullptr)
+        {
+            target.string->value(write.string);
+        }
+        else if (target.boolean != nullptr)
+        {
+            target.boolean->value(write.boolean);
+        }
+        else if (target.color != nullptr)
+        {
+            target.color->value(write.color);
+        }
+        else if (target.enumProperty != nullptr)
+        {
+            target.enumProperty->value(write.string);
+        }
+    }
+    parsed.applied = parser.writes().size();
+
+    for (const auto& entry : mapping)
+    {
+        if (parser.mappedFields().count(entry.first) == 0)
+        {
+            parsed.missing.push_back(entry.first);
+        }
+    }
+    std::sort(parsed.missing.begin(), parsed.missing.end());
+    *result = std::move(parsed);
+    return true;
+}
+
+} // namespace rive
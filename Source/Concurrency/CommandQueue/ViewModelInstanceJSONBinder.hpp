@@ -0,0 +1,73 @@
+//
+//  ViewModelInstanceJSONBinder.hpp
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#ifndef ViewModelInstanceJSONBinder_hpp
+#define ViewModelInstanceJSONBinder_hpp
+
+#include "rive/viewmodel/runtime/viewmodel_instance_runtime.hpp"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rive
+{
+
+/**
+ * Applies the fields of a JSON document to the properties of a view model
+ * instance.
+ *
+ * The document is walked once, front to back, without building a tree of it:
+ * each scalar field is bound as soon as it is read. Fields are identified by
+ * their path from the root, with object keys joined by '/', which matches the
+ * property paths of nested view model instances. Without a mapping, a field
+ * binds to the property at the same path. With a mapping, only the fields it
+ * names are bound. A mapping entry for an object binds the object's fields to
+ * the properties of the instance it names, e.g. {"profile": "Nested"} binds
+ * "profile/name" to "Nested/name".
+ *
+ * Values are converted to the type of their property where no information is
+ * lost: numbers and booleans to strings, booleans to 0 or 1, numbers 0 and 1
+ * and the strings "true" and "false" to booleans, integers and "#RRGGBB" or
+ * "#AARRGGBB" strings to colors, and strings to enums that have them as a
+ * value. Numbers, and strings that are exactly a JSON number, convert to
+ * number properties rounded to the nearest float; values beyond the range of
+ * a float do not convert. Fields that have no property, or that cannot be
+ * converted, are reported as skipped. Nulls and arrays are
+ * not bound. Mapped fields absent from the document are reported as missing,
+ * and their properties keep their values.
+ *
+ * Applying is all or nothing with respect to the document: if it is not valid
+ * JSON, nothing is written. Must be called on the thread that owns the
+ * instance, i.e. from the command server.
+ */
+class ViewModelInstanceJSONBinder
+{
+public:
+    /// JSON field paths to property paths.
+    using Mapping = std::unordered_map<std::string, std::string>;
+
+    struct Result
+    {
+        size_t applied = 0;
+        std::vector<std::string> skipped;
+        std::vector<std::string> missing;
+    };
+
+    /// Returns false, with a description in error, if nothing was applied.
+    static bool apply(ViewModelInstanceRuntime* instance,
+                      const uint8_t* json,
+                      size_t length,
+                      const Mapping& mapping,
+                      Result* result,
+                      std::string* error);
+};
+
+} // namespace rive
+
+#endif /* ViewModelInstanceJSONBinder_hpp */
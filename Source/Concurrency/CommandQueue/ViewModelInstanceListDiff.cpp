@@ -0,0 +1,132 @@
+//
+//  ViewModelInstanceListDiff.cpp
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#include "ViewModelInstanceListDiff.hpp"
+
+#include <deque>
+#include <unordered_map>
+#include <utility>
+
+namespace rive
+{
+
+namespace
+{
+// List items and handles wrap the same instance in different runtime objects,
+// so items are compared by the instance they wrap.
+const void* keyOf(ViewModelInstanceRuntime* runtime)
+{
+    return runtime->instance().get();
+}
+} // namespace
+
+bool ViewModelInstanceListDiff::apply(
+    ViewModelInstanceListRuntime* list,
+    const std::vector<ViewModelInstanceRuntime*>& target,
+    Result* result,
+    std::string* error)
+{
+    // Pair each current item with the first unclaimed target position that
+    // holds the same instance. Unpaired items are removed.
+    std::unordered_map<const void*, std::deque<size_t>> targetPositions;
+    for (size_t i = 0; i < target.size(); i++)
+    {
+        targetPositions[keyOf(target[i])].push_back(i);
+    }
+
+    const size_t size = list->size();
+    std::vector<int> pairedPosition(size, -1);
+    std::vector<bool> claimed(target.size(), false);
+    for (size_t i = 0; i < size; i++)
+    {
+        rcp<ViewModelInstanceRuntime> item =
+            list->instanceAt(static_cast<int>(i));
+        if (item == nullptr)
+        {
+            *error = "Failed to read list item " + std::to_string(i);
+            return false;
+        }
+        auto found = targetPositions.find(keyOf(item.get()));
+        if (found == targetPositions.end() || found->second.empty())
+        {
+            continue;
+        }
+        size_t position = found->second.front();
+        found->second.pop_front();
+        pairedPosition[i] = static_cast<int>(position);
+        claimed[position] = true;
+    }
+
+    Result counts;
+    // Append the instances that are not in the list yet, undoing the appends
+    // if one fails.
+    std::vector<size_t> insertedPositions;
+    for (size_t i = 0; i < target.size(); i++)
+    {
+        if (claimed[i])
+        {
+            continue;
+        }
+        int index = static_cast<int>(size + insertedPositions.size());
+        if (!list->addInstanceAt(target[i], index))
+        {
+            for (size_t j = insertedPositions.size(); j-- > 0;)
+            {
+                list->removeInstanceAt(static_cast<int>(size + j));
+            }
+            *error = "Failed to insert list item at index " +
+                     std::to_string(index);
+            return false;
+        }
+        insertedPositions.push_back(i);
+        counts.insertions++;
+    }
+
+    // Remove unpaired items back to front, so that the indices still to
+    // visit are unaffected. Appended items follow them all.
+    for (size_t i = size; i-- > 0;)
+    {
+        if (pairedPosition[i] < 0)
+        {
+            list->removeInstanceAt(static_cast<int>(i));
+            counts.removals++;
+        }
+    }
+
+    // Every item now has a distinct target position; swap each into place,
+    // one cycle of the permutation at a time.
+    std::vector<size_t> positions;
+    positions.reserve(target.size());
+    for (size_t i = 0; i < size; i++)
+    {
+        if (pairedPosition[i] >= 0)
+        {
+            positions.push_back(static_cast<size_t>(pairedPosition[i]));
+        }
+    }
+    positions.insert(positions.end(),
+                     insertedPositions.begin(),
+                     insertedPositions.end());
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        while (positions[i] != i)
+        {
+            size_t j = positions[i];
+            list->swap(static_cast<uint32_t>(i), static_cast<uint32_t>(j));
+            std::swap(positions[i], positions[j]);
+            counts.moves++;
+        }
+    }
+
+    if (result != nullptr)
+    {
+        *result = counts;
+    }
+    return true;
+}
+
+} // namespace rive
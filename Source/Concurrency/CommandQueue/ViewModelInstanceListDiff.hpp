@@ -0,0 +1,61 @@
+//
+//  ViewModelInstanceListDiff.hpp
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#ifndef ViewModelInstanceListDiff_hpp
+#define ViewModelInstanceListDiff_hpp
+
+#include "rive/viewmodel/runtime/viewmodel_instance_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_list_runtime.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace rive
+{
+
+/**
+ * Changes a list property so that it holds exactly a target sequence of view
+ * model instances.
+ *
+ * Items are keyed by the view model instance they wrap. Every item whose
+ * instance is still in the target keeps its list item, and so its bindings:
+ * items are reordered by swapping them in place, with as few swaps as the
+ * reordering allows. Items whose instance is not in the target are removed,
+ * and target instances that are not in the list are inserted.
+ *
+ * Insertions, the only step that can fail, are made before anything else
+ * changes, and undone if one fails, so a failed diff leaves the list as it
+ * was. Every change happens in one call on the command server, so the
+ * artboard lays out the list once, on its next advance, rather than once per
+ * item.
+ *
+ * Must be called on the thread that owns the list, i.e. from the command
+ * server.
+ */
+class ViewModelInstanceListDiff
+{
+public:
+    struct Result
+    {
+        size_t insertions = 0;
+        /// The number of swaps made to reorder the items.
+        size_t moves = 0;
+        size_t removals = 0;
+    };
+
+    /// Returns false, with a description in error, and the list unchanged, if
+    /// the diff could not be applied. Entries of target must not be null.
+    static bool apply(ViewModelInstanceListRuntime* list,
+                      const std::vector<ViewModelInstanceRuntime*>& target,
+                      Result* result,
+                      std::string* error);
+};
+
+} // namespace rive
+
+#endif /* ViewModelInstanceListDiff_hpp */
@@ -0,0 +1,563 @@
+//
+//  ViewModelInstanceSnapshot.cpp
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#include "ViewModelInstanceSnapshot.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace rive
+{
+
+// Layout, little endian throughout:
+//   magic "RVMS", u8 version, instance
+//   instance: varint property count, then per property
+//     u8 tag, varint name length, name bytes, value
+//   values: number f32, string and enum varint length + bytes, boolean u8,
+//     color u32, view model a nested instance, reference a varint index.
+// Instances are indexed in the order they are written, from 0 for the root. An
+// instance that is reached again, because it is shared or forms a cycle, is
+// written as a reference to its index rather than a second time.
+constexpr static uint8_t kMagic[4] = {'R', 'V', 'M', 'S'};
+// Version 1 had no references, so is read as is.
+constexpr static uint8_t kVersion = 2;
+// Bounds the recursion through chains of distinct nested instances. Deeper
+// trees fail to capture and restore.
+constexpr static int kMaxDepth = 32;
+
+static std::string maxDepthError()
+{
+    return "View model instance nesting is deeper than " +
+           std::to_string(kMaxDepth) + " levels";
+}
+
+namespace
+{
+enum class Tag : uint8_t
+{
+    number = 1,
+    string = 2,
+    boolean = 3,
+    color = 4,
+    enumType = 5,
+    viewModel = 6,
+    reference = 7,
+};
+
+class Writer
+{
+public:
+    std::vector<uint8_t> bytes;
+
+    void u8(uint8_t value) { bytes.push_back(value); }
+
+    void u32(uint32_t value)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            bytes.push_back(static_cast<uint8_t>(value >> (i * 8)));
+        }
+    }
+
+    void f32(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        u32(bits);
+    }
+
+    void varint(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            bytes.push_back(static_cast<uint8_t>(value) | 0x80);
+            value >>= 7;
+        }
+        bytes.push_back(static_cast<uint8_t>(value));
+    }
+
+    void string(const std::string& value)
+    {
+        varint(value.size());
+        bytes.insert(bytes.end(), value.begin(), value.end());
+    }
+};
+
+class Reader
+{
+public:
+    Reader(const uint8_t* bytes, size_t length) :
+        m_bytes(bytes), m_end(bytes + length)
+    {}
+
+    bool atEnd() const { return m_bytes == m_end; }
+
+    bool u8(uint8_t* value)
+    {
+        if (m_bytes == m_end)
+        {
+            return false;
+        }
+        *value = *m_bytes++;
+        return true;
+    }
+
+    bool u32(uint32_t* value)
+    {
+        if (m_end - m_bytes < 4)
+        {
+            return false;
+        }
+        *value = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            *value |= static_cast<uint32_t>(*m_bytes++) << (i * 8);
+        }
+        return true;
+    }
+
+    bool f32(float* value)
+    {
+        uint32_t bits;
+        if (!u32(&bits))
+        {
+            return false;
+        }
+        std::memcpy(value, &bits, sizeof(bits));
+        return true;
+    }
+
+    bool varint(uint64_t* value)
+    {
+        *value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            uint8_t byte;
+            if (!u8(&byte))
+            {
+                return false;
+            }
+            *value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool string(std::string* value)
+    {
+        uint64_t length;
+        if (!varint(&length) ||
+            length > static_cast<uint64_t>(m_end - m_bytes))
+        {
+            return false;
+        }
+        value->assign(reinterpret_cast<const char*>(m_bytes), length);
+        m_bytes += length;
+        return true;
+    }
+
+private:
+    const uint8_t* m_bytes;
+    const uint8_t* m_end;
+};
+
+struct Instance;
+
+struct Property
+{
+    Tag tag;
+    std::string name;
+    float number = 0;
+    std::string string;
+    bool boolean = false;
+    uint32_t color = 0;
+    std::unique_ptr<Instance> viewModel;
+    // The instance a reference refers to, owned by the tree.
+    const Instance* reference = nullptr;
+};
+
+struct Instance
+{
+    std::vector<Property> properties;
+};
+
+// Instances already written, by identity, to their index.
+using CapturedInstances = std::unordered_map<const ViewModelInstance*, uint64_t>;
+
+bool captureInstance(ViewModelInstanceRuntime* instance,
+                     Writer& writer,
+                     CapturedInstances& capturedInstances,
+                     int depth,
+                     std::string* error)
+{
+    capturedInstances.emplace(instance->instance().get(),
+                              capturedInstances.size());
+
+    // Count first, since skipped properties are not written.
+    std::vector<std::pair<PropertyData, rcp<ViewModelInstanceRuntime>>>
+        captured;
+    for (const PropertyData& property : instance->properties())
+    {
+        switch (property.type)
+        {
+            case DataType::number:
+            case DataType::string:
+            case DataType::boolean:
+            case DataType::color:
+            case DataType::enumType:
+                captured.emplace_back(property, nullptr);
+                break;
+            case DataType::viewModel:
+                if (auto nested = instance->propertyViewModel(property.name))
+                {
+                    captured.emplace_back(property, std::move(nested));
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    writer.varint(captured.size());
+    for (const auto& [property, nested] : captured)
+    {
+        const std::string& name = property.name;
+        switch (property.type)
+        {
+            case DataType::number:
+                writer.u8(static_cast<uint8_t>(Tag::number));
+                writer.string(name);
+                writer.f32(instance->propertyNumber(name)->value());
+                break;
+            case DataType::string:
+                writer.u8(static_cast<uint8_t>(Tag::string));
+                writer.string(name);
+                writer.string(instance->propertyString(name)->value());
+                break;
+            case DataType::boolean:
+                writer.u8(static_cast<uint8_t>(Tag::boolean));
+                writer.string(name);
+                writer.u8(instance->propertyBoolean(name)->value() ? 1 : 0);
+                break;
+            case DataType::color:
+                writer.u8(static_cast<uint8_t>(Tag::color));
+                writer.string(name);
+                writer.u32(static_cast<uint32_t>(
+                    instance->propertyColor(name)->value()));
+                break;
+            case DataType::enumType:
+                writer.u8(static_cast<uint8_t>(Tag::enumType));
+                writer.string(name);
+                writer.string(instance->propertyEnum(name)->value());
+                break;
+            case DataType::viewModel:
+            {
+                // An earlier sibling may have written this instance since it
+                // was counted.
+                auto existing =
+                    capturedInstances.find(nested->instance().get());
+                if (existing != capturedInstances.end())
+                {
+                    writer.u8(static_cast<uint8_t>(Tag::reference));
+                    writer.string(name);
+                    writer.varint(existing->second);
+                }
+                else
+                {
+                    if (depth >= kMaxDepth)
+                    {
+                        *error = maxDepthError();
+                        return false;
+                    }
+                    writer.u8(static_cast<uint8_t>(Tag::viewModel));
+                    writer.string(name);
+                    if (!captureInstance(nested.get(),
+                                         writer,
+                                         capturedInstances,
+                                         depth + 1,
+                                         error))
+                    {
+                        return false;
+                    }
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+// instances collects every parsed instance in index order, for references.
+bool parseInstance(Reader& reader,
+                   Instance* instance,
+                   std::vector<const Instance*>& instances,
+                   int depth)
+{
+    instances.push_back(instance);
+    uint64_t count;
+    if (!reader.varint(&count))
+    {
+        return false;
+    }
+    for (uint64_t i = 0; i < count; i++)
+    {
+        Property property;
+        uint8_t tag;
+        if (!reader.u8(&tag) || !reader.string(&property.name))
+        {
+            return false;
+        }
+        property.tag = static_cast<Tag>(tag);
+        bool ok;
+        switch (property.tag)
+        {
+            case Tag::number:
+                ok = reader.f32(&property.number);
+                break;
+            case Tag::string:
+            case Tag::enumType:
+                ok = reader.string(&property.string);
+                break;
+            case Tag::boolean:
+            {
+                uint8_t value = 0;
+                ok = reader.u8(&value);
+                property.boolean = value != 0;
+                break;
+            }
+            case Tag::color:
+                ok = reader.u32(&property.color);
+                break;
+            case Tag::viewModel:
+                property.viewModel = std::make_unique<Instance>();
+                ok = depth < kMaxDepth &&
+                     parseInstance(
+                         reader, property.viewModel.get(), instances, depth + 1);
+                break;
+            case Tag::reference:
+            {
+                uint64_t index = 0;
+                ok = reader.varint(&index) && index < instances.size();
+                if (ok)
+                {
+                    property.reference = instances[index];
+                }
+                break;
+            }
+            default:
+                ok = false;
+                break;
+        }
+        if (!ok)
+        {
+            return false;
+        }
+        instance->properties.push_back(std::move(property));
+    }
+    return true;
+}
+
+// A resolved write of one captured value, at most one of whose targets is
+// set.
+struct Write
+{
+    ViewModelInstanceNumberRuntime* number = nullptr;
+    ViewModelInstanceStringRuntime* string = nullptr;
+    ViewModelInstanceBooleanRuntime* boolean = nullptr;
+    ViewModelInstanceColorRuntime* color = nullptr;
+    ViewModelInstanceEnumRuntime* enumProperty = nullptr;
+    const Property* value = nullptr;
+};
+
+// Resolved writes in captured order, applied only once every property has
+// been checked.
+struct Plan
+{
+    std::vector<Write> writes;
+    // Target instances already planned, so that shared and cyclic instances
+    // are planned once.
+    std::unordered_set<const ViewModelInstance*> planned;
+    // Keeps nested instances alive until the writes are applied.
+    std::vector<rcp<ViewModelInstanceRuntime>> nested;
+};
+
+bool planInstance(ViewModelInstanceRuntime* target,
+                  const Instance& snapshot,
+                  Plan* plan,
+                  int depth,
+                  std::string* error)
+{
+    plan->planned.insert(target->instance().get());
+    for (const Property& property : snapshot.properties)
+    {
+        const std::string& name = property.name;
+        Write write;
+        write.value = &property;
+        bool found = false;
+        switch (property.tag)
+        {
+            case Tag::number:
+                write.number = target->propertyNumber(name);
+                found = write.number != nullptr;
+                break;
+            case Tag::string:
+                write.string = target->propertyString(name);
+                found = write.string != nullptr;
+                break;
+            case Tag::boolean:
+                write.boolean = target->propertyBoolean(name);
+                found = write.boolean != nullptr;
+                break;
+            case Tag::color:
+                write.color = target->propertyColor(name);
+                found = write.color != nullptr;
+                break;
+            case Tag::enumType:
+                if (auto enumProperty = target->propertyEnum(name))
+                {
+                    auto values = enumProperty->values();
+                    if (std::find(values.begin(),
+                                  values.end(),
+                                  property.string) == values.end())
+                    {
+                        *error = "Invalid value '" + property.string +
+                                 "' for enum property '" + name + "'";
+                        return false;
+                    }
+                    write.enumProperty = enumProperty;
+                    found = true;
+                }
+                break;
+            case Tag::viewModel:
+            case Tag::reference:
+                if (auto nested = target->propertyViewModel(name))
+                {
+                    const Instance& source = property.viewModel != nullptr
+                                                 ? *property.viewModel
+                                                 : *property.reference;
+                    if (plan->planned.count(nested->instance().get()) == 0)
+                    {
+                        // References can lead a target deeper than the
+                        // snapshot itself nests.
+                        if (depth >= kMaxDepth)
+                        {
+                            *error = maxDepthError();
+                            return false;
+                        }
+                        if (!planInstance(
+                                nested.get(), source, plan, depth + 1, error))
+                        {
+                            return false;
+                        }
+                    }
+                    plan->nested.push_back(std::move(nested));
+                    found = true;
+                }
+                // Nested instances write through their own properties.
+                write.value = nullptr;
+                break;
+        }
+        if (!found)
+        {
+            *error = "Snapshot property '" + name +
+                     "' does not exist on the instance, or has another type";
+            return false;
+        }
+        if (write.value != nullptr)
+        {
+            plan->writes.push_back(write);
+        }
+    }
+    return true;
+}
+} // namespace
+
+bool ViewModelInstanceSnapshot::capture(ViewModelInstanceRuntime* instance,
+                                        std::vector<uint8_t>* bytes,
+                                        std::string* error)
+{
+    Writer writer;
+    writer.bytes.insert(writer.bytes.end(), kMagic, kMagic + sizeof(kMagic));
+    writer.u8(kVersion);
+    CapturedInstances capturedInstances;
+    if (!captureInstance(instance, writer, capturedInstances, 0, error))
+    {
+        return false;
+    }
+    *bytes = std::move(writer.bytes);
+    return true;
+}
+
+bool ViewModelInstanceSnapshot::restore(ViewModelInstanceRuntime* instance,
+                                        const uint8_t* bytes,
+                                        size_t length,
+                                        std::string* error)
+{
+    if (length < sizeof(kMagic) + 1 ||
+        std::memcmp(bytes, kMagic, sizeof(kMagic)) != 0)
+    {
+        *error = "Data is not a view model instance snapshot";
+        return false;
+    }
+    if (bytes[sizeof(kMagic)] == 0 || bytes[sizeof(kMagic)] > kVersion)
+    {
+        *error = "Unsupported snapshot version " +
+                 std::to_string(bytes[sizeof(kMagic)]);
+        return false;
+    }
+
+    Reader reader(bytes + sizeof(kMagic) + 1, length - sizeof(kMagic) - 1);
+    Instance snapshot;
+    std::vector<const Instance*> instances;
+    if (!parseInstance(reader, &snapshot, instances, 0) || !reader.atEnd())
+    {
+        *error = "Malformed snapshot";
+        return false;
+    }
+
+    Plan plan;
+    if (!planInstance(instance, snapshot, &plan, 0, error))
+    {
+        return false;
+    }
+
+    for (const Write& write : plan.writes)
+    {
+        const Property& value = *write.value;
+        if (write.number != nullptr)
+        {
+            write.number->value(value.number);
+        }
+        else if (write.string != nullptr)
+        {
+            write.string->value(value.string);
+        }
+        else if (write.boolean != nullptr)
+        {
+            write.boolean->value(value.boolean);
+        }
+        else if (write.color != nullptr)
+        {
+            write.color->value(static_cast<int>(value.color));
+        }
+        else if (write.enumProperty != nullptr)
+        {
+            write.enumProperty->value(value.string);
+        }
+    }
+    return true;
+}
+
+} // namespace rive
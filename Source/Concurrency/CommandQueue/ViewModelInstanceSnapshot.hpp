@@ -0,0 +1,60 @@
+//
+//  ViewModelInstanceSnapshot.hpp
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#ifndef ViewModelInstanceSnapshot_hpp
+#define ViewModelInstanceSnapshot_hpp
+
+#include "rive/viewmodel/runtime/viewmodel_instance_runtime.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rive
+{
+
+/**
+ * Serializes the values of a view model instance tree into a compact binary
+ * blob, and applies such a blob back onto an instance.
+ *
+ * A snapshot holds every number, string, boolean, color and enum property of
+ * the instance, and of its nested view model instances, recursively.
+ * Triggers, lists, images and artboards have no value to capture and are
+ * skipped.
+ * A nested instance reached more than once, because it is shared or forms a
+ * cycle, is captured once and referenced after that. Chains of distinct
+ * nested instances are limited to 32 levels: capturing or restoring a deeper
+ * tree fails rather than leaving the deeper instances out.
+ *
+ * Restoring is all or nothing: the whole blob is parsed, and every property it
+ * names is resolved on the target and checked against its type, before any
+ * value is written. A blob that is malformed, or that does not match the
+ * target's view model, leaves the target untouched.
+ * Values are then written in the order they were captured.
+ *
+ * Both functions must be called on the thread that owns the instance, i.e.
+ * from the command server.
+ */
+class ViewModelInstanceSnapshot
+{
+public:
+    /// Returns false, with a description in error, if the instance could not
+    /// be captured.
+    static bool capture(ViewModelInstanceRuntime* instance,
+                        std::vector<uint8_t>* bytes,
+                        std::string* error);
+
+    /// Returns false, with a description in error, if nothing was applied.
+    static bool restore(ViewModelInstanceRuntime* instance,
+                        const uint8_t* bytes,
+                        size_t length,
+                        std::string* error);
+};
+
+} // namespace rive
+
+#endif /* ViewModelInstanceSnapshot_hpp */
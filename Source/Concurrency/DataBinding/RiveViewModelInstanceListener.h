@@ -66,6 +66,24 @@ NS_SWIFT_NAME(ViewModelInstanceListener)
                       requestID:(uint64_t)requestID
                            data:(NSDictionary<NSString*, id>*)data;
 
+@optional
+/**
+ * Called once per processed batch of messages with all view model data
+ * received for this observer, in the order it was received.
+ *
+ * Observers that implement this method receive data here instead of through
+ * onViewModelDataReceived:requestID:data:. This lets them handle many
+ * property changes in one frame with a single hop to their own thread,
+ * rather than one per change.
+ *
+ * @param batch The data received. Each entry has the keys of the data passed
+ *        to onViewModelDataReceived:requestID:data:, plus
+ *        "viewModelInstanceHandle" and "requestID".
+ */
+- (void)onViewModelDataBatchReceived:
+    (NSArray<NSDictionary<NSString*, id>*>*)batch;
+
+@required
 - (void)onViewModelListSizeReceived:(uint64_t)viewModelInstanceHandle
                           requestID:(uint64_t)requestID
                                path:(NSString*)path
@@ -98,6 +116,45 @@ NS_SWIFT_NAME(ViewModelInstanceListener)
                               requestID:(uint64_t)requestID
                                    name:(NSString*)name;
 
+/**
+ * Called when a snapshot of a view model instance is received.
+ *
+ * @param viewModelInstanceHandle The view model instance handle that was
+ *        captured.
+ * @param requestID The unique identifier for the request that completed.
+ * @param snapshot The opaque snapshot of the instance's values.
+ */
+- (void)onViewModelInstanceSnapshotReceived:(uint64_t)viewModelInstanceHandle
+                                  requestID:(uint64_t)requestID
+                                   snapshot:(NSData*)snapshot;
+
+/**
+ * Called when a snapshot has been applied to a view model instance.
+ *
+ * @param viewModelInstanceHandle The view model instance handle that was
+ *        restored.
+ * @param requestID The unique identifier for the request that completed.
+ */
+- (void)onViewModelInstanceRestored:(uint64_t)viewModelInstanceHandle
+                          requestID:(uint64_t)requestID;
+
+/**
+ * Called when a JSON document has been applied to a view model instance.
+ *
+ * @param viewModelInstanceHandle The view model instance handle the document
+ *        was applied to.
+ * @param requestID The unique identifier for the request that completed.
+ * @param appliedCount The number of property values that were set.
+ * @param skippedFields The paths of fields that have no matching property, or
+ *        whose value could not be converted to its property's type.
+ * @param missingFields The mapped paths of fields absent from the document.
+ */
+- (void)onViewModelInstanceJSONApplied:(uint64_t)viewModelInstanceHandle
+                             requestID:(uint64_t)requestID
+                          appliedCount:(NSUInteger)appliedCount
+                         skippedFields:(NSArray<NSString*>*)skippedFields
+                         missingFields:(NSArray<NSString*>*)missingFields;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -31,6 +31,10 @@ public enum ViewModelInstanceSource {
 /// View model instances provide a type-safe interface for accessing and modifying the data structure
 /// defined in a Rive file's view model. Properties can be read, written, and observed through streams.
 /// View model instances can be bound to state machines to enable data-driven animations.
+///
+/// Values set on a property between frames are coalesced, and only the last one is sent to the
+/// worker, so properties fed by scroll offsets or sensors can be set as often as they change.
+/// Triggers, list changes and reads are still applied after every value set before them.
 public final class ViewModelInstance: Equatable {
     /// The underlying type for the view model instance handle identifier.
     ///
@@ -132,6 +136,63 @@ public final class ViewModelInstance: Equatable {
         return name
     }
 
+    // MARK: - Snapshots
+
+    /// Captures the values of this instance in a single call to the worker.
+    ///
+    /// The snapshot holds every number, string, boolean, color and enum property of this instance
+    /// and of its nested view model instances, recursively. Triggers, lists, images and artboards
+    /// are not captured. The returned data is opaque and compact, and can be persisted, or passed
+    /// to ``restore(from:)`` on an instance of the same view model, including one on another worker.
+    ///
+    /// - Returns: The snapshot of this instance
+    /// - Throws: An error if the instance cannot be read, or nests instances more than 32 levels deep
+    @MainActor
+    public func snapshot() async throws -> Data {
+        return try await dependencies.viewModelInstanceService.snapshot(for: viewModelInstanceHandle)
+    }
+
+    /// Applies a snapshot from ``snapshot()`` to this instance in a single call to the worker.
+    ///
+    /// The snapshot is applied atomically: if it is malformed, names a property that this
+    /// instance does not have with the same type, or would nest instances more than 32 levels
+    /// deep, no value is changed and an error is thrown.
+    ///
+    /// - Parameter snapshot: A snapshot of an instance of the same view model
+    /// - Throws: `ViewModelInstanceError.message` if the snapshot cannot be applied
+    @MainActor
+    public func restore(from snapshot: Data) async throws {
+        try await dependencies.viewModelInstanceService.restore(viewModelInstanceHandle, from: snapshot)
+    }
+
+    // MARK: - JSON
+
+    /// Applies the fields of a JSON document to this instance in a single call to the worker.
+    ///
+    /// The document is read natively in one pass, without decoding it into Swift values first.
+    /// Fields are identified by their path from the root, with object keys joined by `/`, and bind
+    /// to the property at the same path, so nested objects set the properties of nested view model
+    /// instances. Values are converted to the type of their property where no information is lost,
+    /// for example numbers to strings, `0` and `1` to booleans, or `"#RRGGBB"` strings to colors.
+    /// Numbers, and strings that are exactly a JSON number, are rounded to the nearest float for
+    /// number properties. Nulls and arrays are not bound.
+    ///
+    /// Pass a mapping when the document's shape differs from the view model's. Only the fields it
+    /// names are then bound. An entry for an object binds that object's fields to the nested
+    /// instance it names, e.g. `["profile": "User"]` binds `profile/name` to `User/name`.
+    ///
+    /// - Parameters:
+    ///   - json: The UTF-8 JSON document
+    ///   - mapping: JSON field paths to property paths
+    /// - Returns: Which fields were applied, skipped or missing
+    /// - Throws: `ViewModelInstanceError.message` if the document is not valid JSON, in which case
+    ///   no value is changed
+    @MainActor
+    @discardableResult
+    public func apply(json: Data, mapping: [String: String] = [:]) async throws -> JSONBindingResult {
+        return try await dependencies.viewModelInstanceService.apply(json: json, mapping: mapping, to: viewModelInstanceHandle)
+    }
+
     // MARK: - StringProperty
     
     /// Retrieves the current value of a string property.
@@ -500,6 +561,29 @@ public final class ViewModelInstance: Equatable {
         )
     }
 
+    /// Replaces the contents of a list property with the given view model instances.
+    ///
+    /// The list is diffed against `instances` on the command server, keyed by instance:
+    /// instances already in the list keep their items, and their bindings, and are swapped into
+    /// order in place; the rest are inserted or removed. If the update fails, the list is left
+    /// unchanged. The whole update is applied at once, so the
+    /// artboard lays out the list a single time, which makes this the preferred way to
+    /// populate or reorder long lists.
+    ///
+    /// - Parameters:
+    ///   - list: The list property to modify
+    ///   - instances: The view model instances the list should hold, in order
+    @MainActor
+    public func setInstances(of list: ListProperty, to instances: [ViewModelInstance]) {
+        let handle = viewModelInstanceHandle
+        RiveLog.trace(tag: .viewModelInstance, "\(Self.logContext(for: handle)) Setting \(instances.count) list items in '\(list.path)'")
+        dependencies.viewModelInstanceService.applyViewModelInstanceListDiff(
+            viewModelInstanceHandle,
+            path: list.path,
+            values: instances.map(\.viewModelInstanceHandle)
+        )
+    }
+
     /// Retrieves the view model instance at the specified index in a list property.
     ///
     /// - Parameters:
@@ -524,6 +608,17 @@ public final class ViewModelInstance: Equatable {
     }
 }
 
+/// The outcome of applying a JSON document to a view model instance.
+public struct JSONBindingResult: Sendable, Equatable {
+    /// The number of property values that were set.
+    public let appliedCount: Int
+    /// The paths of fields that have no matching property, or whose value could not be converted
+    /// to the type of its property.
+    public let skippedFields: [String]
+    /// The mapped paths of fields absent from the document. Their properties keep their values.
+    public let missingFields: [String]
+}
+
 extension ViewModelInstance {
     /// Container for all dependencies required by a ViewModelInstance instance.
     struct Dependencies {
@@ -18,6 +18,8 @@ import Foundation
 ///
 /// The service handles property subscriptions via `subscribe`/`unsubscribe` commands. When a stream
 /// is terminated, the `onTermination` handler automatically unsubscribes and cleans up the stream continuation.
+/// Property values received while the command queue processes a frame's messages arrive together in
+/// `onViewModelDataBatchReceived`, and are fanned out to their streams from a single main actor task.
 ///
 /// All continuation-based methods are wrapped with `withTaskCancellationHandler` because
 /// `withCheckedThrowingContinuation` does not auto-resume on task cancellation. Without
@@ -70,9 +72,11 @@ final class ViewModelInstanceService: NSObject, ViewModelInstanceListener {
         }
     }
 
+    /// Dirty events carry no payload, so only the newest is buffered: a burst of writes made
+    /// before the consumer runs wakes it once rather than once per write.
     @MainActor
     func dirtyStream(for instance: ViewModelInstance.ViewModelInstanceHandle) -> AsyncStream<Void> {
-        return AsyncStream<Void> { continuation in
+        return AsyncStream<Void>(bufferingPolicy: .bufferingNewest(1)) { continuation in
             let continuationID = UUID()
             var continuationsForInstance = dirtyStreamContinuations[instance] ?? [:]
             continuationsForInstance[continuationID] = continuation
@@ -160,6 +164,68 @@ final class ViewModelInstanceService: NSObject, ViewModelInstanceListener {
         }
     }
 
+    // MARK: - Snapshots
+
+    /// Captures a snapshot of the instance and its nested instances.
+    ///
+    /// The continuation is resumed when `onViewModelInstanceSnapshotReceived` is called.
+    ///
+    /// - Parameter instance: The view model instance handle
+    /// - Returns: The opaque snapshot of the instance's values
+    /// - Throws: `ViewModelInstanceError` if the request fails
+    @MainActor
+    func snapshot(for instance: ViewModelInstance.ViewModelInstanceHandle) async throws -> Data {
+        try await withCancellableContinuation(cancelledError: ViewModelInstanceError.cancelled) { requestID in
+            self.dependencies.commandQueue.requestViewModelInstanceSnapshot(instance, requestID: requestID)
+        }
+    }
+
+    /// Applies a snapshot to the instance atomically.
+    ///
+    /// The continuation is resumed when `onViewModelInstanceRestored` is called, or throws when
+    /// `onViewModelInstanceError` is called because the snapshot does not match the instance.
+    ///
+    /// - Parameters:
+    ///   - instance: The view model instance handle
+    ///   - snapshot: The snapshot to apply
+    /// - Throws: `ViewModelInstanceError` if the snapshot cannot be applied
+    @MainActor
+    func restore(_ instance: ViewModelInstance.ViewModelInstanceHandle, from snapshot: Data) async throws {
+        let _: ViewModelInstance.ViewModelInstanceHandle = try await withCancellableContinuation(
+            cancelledError: ViewModelInstanceError.cancelled
+        ) { requestID in
+            self.dependencies.commandQueue.restoreViewModelInstance(instance, fromSnapshot: snapshot, requestID: requestID)
+        }
+        emitDirty(for: instance)
+    }
+
+    // MARK: - JSON
+
+    /// Applies the fields of a JSON document to the instance.
+    ///
+    /// The continuation is resumed when `onViewModelInstanceJSONApplied` is called, or throws when
+    /// `onViewModelInstanceError` is called because the document is not valid JSON.
+    ///
+    /// - Parameters:
+    ///   - json: The UTF-8 JSON document
+    ///   - mapping: JSON field paths to property paths, or empty to bind fields by path
+    ///   - instance: The view model instance handle
+    /// - Returns: Which fields were applied, skipped or missing
+    /// - Throws: `ViewModelInstanceError` if the document cannot be applied
+    @MainActor
+    func apply(json: Data, mapping: [String: String], to instance: ViewModelInstance.ViewModelInstanceHandle) async throws -> JSONBindingResult {
+        let result: JSONBindingResult = try await withCancellableContinuation(cancelledError: ViewModelInstanceError.cancelled) { requestID in
+            self.dependencies.commandQueue.applyViewModelInstanceJSON(
+                instance,
+                json: json,
+                mapping: mapping.isEmpty ? nil : mapping,
+                requestID: requestID
+            )
+        }
+        emitDirty(for: instance)
+        return result
+    }
+
     // MARK: - StringProperty
 
     /// Retrieves a string property value.
@@ -627,6 +693,26 @@ final class ViewModelInstanceService: NSObject, ViewModelInstanceListener {
         emitDirty(for: base)
     }
 
+    /// Replaces the contents of a list property with the given view model instances.
+    ///
+    /// Delegates to the command queue, which diffs the list on the server. No listener
+    /// callback is invoked for this operation unless it fails.
+    @MainActor
+    func applyViewModelInstanceListDiff(
+        _ base: ViewModelInstance.ViewModelInstanceHandle,
+        path: String,
+        values: [ViewModelInstance.ViewModelInstanceHandle]
+    ) {
+        let requestID = dependencies.commandQueue.nextRequestID
+        dependencies.commandQueue.applyViewModelInstanceListDiff(
+            base,
+            path: path,
+            values: values.map { NSNumber(value: $0) },
+            requestID: requestID
+        )
+        emitDirty(for: base)
+    }
+
     /// Called when a view model instance operation encounters an error.
     ///
     /// Listener callback invoked by the command server when an operation fails.
@@ -646,9 +732,8 @@ final class ViewModelInstanceService: NSObject, ViewModelInstanceListener {
 
     /// Called when view model data is received.
     ///
-    /// Listener callback invoked by the command server. Handles both regular continuations
-    /// (one-time value requests) and stream continuations (property subscriptions). For streams,
-    /// values are yielded as they arrive. Dispatches to main actor to safely access continuations.
+    /// Listener callback invoked by the command server for observers that do not receive batches.
+    /// Dispatches to main actor to safely access continuations.
     nonisolated public func onViewModelDataReceived(
         _ viewModelInstanceHandle: UInt64,
         requestID: UInt64,
@@ -656,61 +741,86 @@ final class ViewModelInstanceService: NSObject, ViewModelInstanceListener {
     ) {
         let viewModelInstanceData = ViewModelInstanceData(from: data)
         Task { @MainActor in
-            if streamContinuations[requestID] == nil {
-                finishImmediateRequest(requestID)
+            receive(viewModelInstanceData, for: requestID)
+        }
+    }
+
+    /// Called once per processed batch of messages with all view model data received.
+    ///
+    /// Listener callback invoked by the command server. When many subscribed properties change in
+    /// one frame, they are all delivered with a single hop to the main actor and fanned out to
+    /// their continuations in order, rather than with one task per change.
+    nonisolated public func onViewModelDataBatchReceived(_ batch: [[String: Any]]) {
+        let received = batch.map { data in
+            ((data["requestID"] as? NSNumber)?.uint64Value ?? 0, ViewModelInstanceData(from: data))
+        }
+        Task { @MainActor in
+            for (requestID, viewModelInstanceData) in received {
+                receive(viewModelInstanceData, for: requestID)
             }
-            if let continuation = continuations.removeValue(forKey: requestID) {
-                do {
-                    switch viewModelInstanceData.type {
-                    case .trigger:
+        }
+    }
+
+    /// Handles both regular continuations (one-time value requests) and stream continuations
+    /// (property subscriptions). For streams, values are yielded as they arrive.
+    @MainActor
+    private func receive(_ viewModelInstanceData: ViewModelInstanceData, for requestID: UInt64) {
+        if streamContinuations[requestID] == nil {
+            finishImmediateRequest(requestID)
+        }
+        if let continuation = continuations.removeValue(forKey: requestID) {
+            do {
+                switch viewModelInstanceData.type {
+                case .trigger:
+                    continuation.resume(throwing: ViewModelInstanceError.missingData)
+                case .value(let value):
+                    switch value {
+                    case .string(let stringValue):
+                        try continuation.resume(returning: stringValue)
+                    case .number(let numberValue):
+                        try continuation.resume(returning: numberValue)
+                    case .boolean(let booleanValue):
+                        try continuation.resume(returning: booleanValue)
+                    case .color(let argbValue):
+                        try continuation.resume(returning: Color(argbValue))
+                    case .none:
                         continuation.resume(throwing: ViewModelInstanceError.missingData)
-                    case .value(let value):
-                        switch value {
-                        case .string(let stringValue):
-                            try continuation.resume(returning: stringValue)
-                        case .number(let numberValue):
-                            try continuation.resume(returning: numberValue)
-                        case .boolean(let booleanValue):
-                            try continuation.resume(returning: booleanValue)
-                        case .color(let argbValue):
-                            try continuation.resume(returning: Color(argbValue))
-                        case .none:
-                            continuation.resume(throwing: ViewModelInstanceError.missingData)
-                        }
                     }
-                } catch AnyContinuationError.typeMismatch(expected: let expected, actual: let actual) {
-                    continuation.resume(throwing: ViewModelInstanceError.valueMismatch(expected, actual))
                 }
-                return
+            } catch AnyContinuationError.typeMismatch(expected: let expected, actual: let actual) {
+                continuation.resume(throwing: ViewModelInstanceError.valueMismatch(expected, actual))
+            } catch {
+                continuation.resume(throwing: ViewModelInstanceError.error(error))
             }
-            
-            if let streamContinuation = streamContinuations[requestID] {
-                do {
-                    switch viewModelInstanceData.type {
-                    case .trigger:
-                        try streamContinuation.yield(())
-                    case .value(let value):
-                        switch value {
-                        case .string(let stringValue):
-                            try streamContinuation.yield(stringValue)
-                        case .number(let numberValue):
-                            try streamContinuation.yield(numberValue)
-                        case .boolean(let booleanValue):
-                            try streamContinuation.yield(booleanValue)
-                        case .color(let argbValue):
-                            try streamContinuation.yield(Color(argbValue))
-                        case .none:
-                            streamContinuation.finish(throwing: ViewModelInstanceError.missingData)
-                            streamContinuations.removeValue(forKey: requestID)
-                        }
+            return
+        }
+        
+        if let streamContinuation = streamContinuations[requestID] {
+            do {
+                switch viewModelInstanceData.type {
+                case .trigger:
+                    try streamContinuation.yield(())
+                case .value(let value):
+                    switch value {
+                    case .string(let stringValue):
+                        try streamContinuation.yield(stringValue)
+                    case .number(let numberValue):
+                        try streamContinuation.yield(numberValue)
+                    case .boolean(let booleanValue):
+                        try streamContinuation.yield(booleanValue)
+                    case .color(let argbValue):
+                        try streamContinuation.yield(Color(argbValue))
+                    case .none:
+                        streamContinuation.finish(throwing: ViewModelInstanceError.missingData)
+                        streamContinuations.removeValue(forKey: requestID)
                     }
-                } catch AnyAsyncThrowingStreamContinuationError.typeMismatch(expected: let expected, actual: let actual) {
-                    streamContinuation.finish(throwing: ViewModelInstanceError.valueMismatch(expected, actual))
-                    streamContinuations.removeValue(forKey: requestID)
-                } catch {
-                    streamContinuation.finish(throwing: ViewModelInstanceError.error(error))
-                    streamContinuations.removeValue(forKey: requestID)
                 }
+            } catch AnyAsyncThrowingStreamContinuationError.typeMismatch(expected: let expected, actual: let actual) {
+                streamContinuation.finish(throwing: ViewModelInstanceError.valueMismatch(expected, actual))
+                streamContinuations.removeValue(forKey: requestID)
+            } catch {
+                streamContinuation.finish(throwing: ViewModelInstanceError.error(error))
+                streamContinuations.removeValue(forKey: requestID)
             }
         }
     }
@@ -770,6 +880,66 @@ final class ViewModelInstanceService: NSObject, ViewModelInstanceListener {
         }
     }
 
+    /// Called when a snapshot of a view model instance is received.
+    ///
+    /// Listener callback invoked by the command server. Dispatches to main actor to access
+    /// continuations dictionary and resume the continuation with the snapshot.
+    nonisolated public func onViewModelInstanceSnapshotReceived(
+        _ viewModelInstanceHandle: UInt64,
+        requestID: UInt64,
+        snapshot: Data
+    ) {
+        Task { @MainActor in
+            finishImmediateRequest(requestID)
+            if let continuation = continuations.removeValue(forKey: requestID) {
+                RiveLog.trace(tag: .viewModelInstance, "\(Self.context(viewModelInstanceHandle)) Received snapshot of \(snapshot.count) bytes")
+                try continuation.resume(returning: snapshot)
+            }
+        }
+    }
+
+    /// Called when a snapshot has been applied to a view model instance.
+    ///
+    /// Listener callback invoked by the command server. Dispatches to main actor to access
+    /// continuations dictionary and resume the continuation with the restored handle.
+    nonisolated public func onViewModelInstanceRestored(
+        _ viewModelInstanceHandle: UInt64,
+        requestID: UInt64
+    ) {
+        Task { @MainActor in
+            finishImmediateRequest(requestID)
+            if let continuation = continuations.removeValue(forKey: requestID) {
+                RiveLog.debug(tag: .viewModelInstance, "\(Self.context(viewModelInstanceHandle)) Restored snapshot")
+                try continuation.resume(returning: viewModelInstanceHandle)
+            }
+        }
+    }
+
+    /// Called when a JSON document has been applied to a view model instance.
+    ///
+    /// Listener callback invoked by the command server. Dispatches to main actor to access
+    /// continuations dictionary and resume the continuation with the binding result.
+    nonisolated public func onViewModelInstanceJSONApplied(
+        _ viewModelInstanceHandle: UInt64,
+        requestID: UInt64,
+        appliedCount: UInt,
+        skippedFields: [String],
+        missingFields: [String]
+    ) {
+        Task { @MainActor in
+            finishImmediateRequest(requestID)
+            if let continuation = continuations.removeValue(forKey: requestID) {
+                RiveLog.debug(tag: .viewModelInstance, "\(Self.context(viewModelInstanceHandle)) Applied JSON to \(appliedCount) properties, skipped \(skippedFields.count) fields")
+                let result = JSONBindingResult(
+                    appliedCount: Int(appliedCount),
+                    skippedFields: skippedFields,
+                    missingFields: missingFields
+                )
+                try continuation.resume(returning: result)
+            }
+        }
+    }
+
     /// Called when a view model instance deletion operation completes.
     ///
     /// Listener callback invoked by the command server. Dispatches to main actor to access
@@ -118,6 +118,19 @@ public final class File: Equatable {
         return try await dependencies.fileService.getArtboardNames(fileHandle: fileHandle)
     }
 
+    /// Retrieves a metadata index of this Rive file.
+    ///
+    /// The index lists every artboard with its size, animations and state machine inputs, and
+    /// every view model with its properties and instance names. Unlike creating artboards or
+    /// view model instances to inspect them, building the index instantiates nothing.
+    ///
+    /// - Returns: The metadata index of the file
+    /// - Throws: `FileError` if the metadata cannot be retrieved
+    @MainActor
+    public func getMetadata() async throws -> FileMetadata {
+        return try await dependencies.fileService.getMetadata(fileHandle: fileHandle)
+    }
+
     /// Creates an artboard from this file.
     ///
     /// If a name is provided, creates the artboard with that specific name. If `nil` is provided,
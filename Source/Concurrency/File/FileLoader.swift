@@ -19,6 +19,13 @@ public enum Source: Sendable {
     ///   - bundle: The bundle containing the file. If `nil`, defaults to `Bundle.main`
     case local(String, Bundle?)
     
+    /// A Rive file on disk, such as one in an app's caches directory.
+    ///
+    /// The file is memory-mapped read-only rather than read into the heap.
+    ///
+    /// - Parameter url: The file URL of the Rive file
+    case file(URL)
+
     /// A remote Rive file accessible via URL.
     ///
     /// - Parameter url: The URL pointing to the Rive file to download
@@ -94,6 +101,9 @@ final class FileLoader: FileLoaderProtocol {
         case .local(let filename, let bundle):
             RiveLog.debug(tag: .file, "[File] Loading local file '\(filename)'")
             return try await load(filename: filename, in: bundle)
+        case .file(let url):
+            RiveLog.debug(tag: .file, "[File] Loading file at '\(url.path)'")
+            return try await load(fileURL: url)
         case .url(let url):
             RiveLog.debug(tag: .file, "[File] Loading file from URL: \(url.absoluteString)")
             return try await load(url: url)
@@ -121,7 +131,7 @@ final class FileLoader: FileLoaderProtocol {
             }
 
             do {
-                let data = try Data(contentsOf: url)
+                let data = try Self.mappedData(contentsOf: url)
                 RiveLog.debug(tag: .file, "[File] Loaded local file '\(filename).riv' (\(data.count) bytes)")
                 return data
             } catch {
@@ -132,6 +142,42 @@ final class FileLoader: FileLoaderProtocol {
         }.value
     }
 
+    /// Loads a Rive file from disk.
+    ///
+    /// - Parameters:
+    ///   - fileURL: The file URL of the Rive file
+    /// - Returns: The loaded file data
+    /// - Throws: `FileError.missingFile` if there is no file at the URL
+    ///           `FileError.invalidFile` if the file cannot be loaded
+    private func load(fileURL: URL) async throws -> Data {
+        return try await Task.detached(priority: .userInitiated) {
+            guard FileManager.default.fileExists(atPath: fileURL.path) else {
+                let error = FileError.missingFile(fileURL.path)
+                RiveLog.error(tag: .file, error: error, "[File] Failed to load file")
+                throw error
+            }
+
+            do {
+                let data = try Self.mappedData(contentsOf: fileURL)
+                RiveLog.debug(tag: .file, "[File] Loaded file '\(fileURL.lastPathComponent)' (\(data.count) bytes)")
+                return data
+            } catch {
+                let fileError = FileError.invalidFile(fileURL.absoluteString)
+                RiveLog.error(tag: .file, error: fileError, "[File] Failed to read file")
+                throw fileError
+            }
+        }.value
+    }
+
+    /// Reads a file by memory-mapping it read-only.
+    ///
+    /// Mapped pages are clean, so the OS can reclaim them under memory pressure and
+    /// fault them back in from disk, rather than the file occupying dirty heap memory.
+    /// Falls back to a regular read where mapping is unsafe (e.g. network volumes).
+    private static func mappedData(contentsOf url: URL) throws -> Data {
+        return try Data(contentsOf: url, options: .mappedIfSafe)
+    }
+
     /// Loads a remote Rive file from the specified URL.
     ///
     /// Uses continuations to bridge the callback-based URL session API to async/await.
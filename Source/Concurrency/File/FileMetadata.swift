@@ -0,0 +1,133 @@
+//
+//  FileMetadata.swift
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+import Foundation
+
+/// A lightweight index of the contents of a Rive file.
+///
+/// The index lists artboards with their sizes, animations and state machine inputs, and view
+/// models with their properties and instance names. It is built on the worker from the file's
+/// definitions, so no artboard, state machine or view model instance is created to build it.
+public struct FileMetadata: Sendable, Equatable {
+    /// Describes an artboard without instantiating it.
+    public struct Artboard: Sendable, Equatable {
+        /// The name of the artboard.
+        public let name: String
+        /// The size of the artboard, as authored in the editor.
+        public let size: CGSize
+        /// The names of the linear animations in the artboard.
+        public let animationNames: [String]
+        /// The state machines in the artboard.
+        public let stateMachines: [StateMachine]
+    }
+
+    /// Describes a state machine without instantiating it.
+    public struct StateMachine: Sendable, Equatable {
+        /// The name of the state machine.
+        public let name: String
+        /// The inputs of the state machine, in file order.
+        public let inputs: [Input]
+    }
+
+    /// Describes a state machine input.
+    public struct Input: Sendable, Equatable {
+        /// The type of a state machine input.
+        public enum InputType: Sendable, Equatable {
+            case boolean
+            case number
+            case trigger
+        }
+
+        /// The name of the input.
+        public let name: String
+        /// The type of the input.
+        public let type: InputType
+    }
+
+    /// Describes the schema of a view model without creating an instance of it.
+    public struct ViewModel: Sendable, Equatable {
+        /// The name of the view model.
+        public let name: String
+        /// The properties of the view model.
+        public let properties: [ViewModelProperty]
+        /// The names of the instances of the view model authored in the editor.
+        public let instanceNames: [String]
+    }
+
+    /// The artboards in the file, in file order.
+    public let artboards: [Artboard]
+    /// The view models in the file, in file order.
+    public let viewModels: [ViewModel]
+
+    /// Returns the artboard with the given name, if any.
+    public func artboard(named name: String) -> Artboard? {
+        artboards.first { $0.name == name }
+    }
+
+    /// Returns the view model with the given name, if any.
+    public func viewModel(named name: String) -> ViewModel? {
+        viewModels.first { $0.name == name }
+    }
+}
+
+extension FileMetadata {
+    /// Creates a FileMetadata from the dictionary delivered by `onFileMetadataListed`.
+    /// - Parameter dictionary: Dictionary containing "artboards" and "viewModels" keys
+    /// - Throws: `ViewModelPropertyError` if a view model property cannot be parsed
+    init(from dictionary: [String: Any]) throws {
+        let artboards = dictionary["artboards"] as? [[String: Any]] ?? []
+        self.artboards = artboards.map { artboard in
+            let stateMachines = artboard["stateMachines"] as? [[String: Any]] ?? []
+            return Artboard(
+                name: artboard["name"] as? String ?? "",
+                size: CGSize(
+                    width: (artboard["width"] as? NSNumber)?.doubleValue ?? 0,
+                    height: (artboard["height"] as? NSNumber)?.doubleValue ?? 0
+                ),
+                animationNames: artboard["animationNames"] as? [String] ?? [],
+                stateMachines: stateMachines.map { stateMachine in
+                    let inputs = stateMachine["inputs"] as? [[String: Any]] ?? []
+                    return StateMachine(
+                        name: stateMachine["name"] as? String ?? "",
+                        inputs: inputs.compactMap { input in
+                            guard let name = input["name"] as? String,
+                                  let rawType = (input["type"] as? NSNumber)?.intValue,
+                                  let type = RiveStateMachineInputMetadata.InputType(rawValue: rawType)
+                            else { return nil }
+                            return Input(name: name, type: Input.InputType(objcValue: type))
+                        }
+                    )
+                }
+            )
+        }
+
+        let viewModels = dictionary["viewModels"] as? [[String: Any]] ?? []
+        self.viewModels = try viewModels.map { viewModel in
+            let properties = viewModel["properties"] as? [[String: Any]] ?? []
+            return ViewModel(
+                name: viewModel["name"] as? String ?? "",
+                properties: try properties.map { try ViewModelProperty(from: $0) },
+                instanceNames: viewModel["instanceNames"] as? [String] ?? []
+            )
+        }
+    }
+}
+
+extension FileMetadata.Input.InputType {
+    init(objcValue: RiveStateMachineInputMetadata.InputType) {
+        switch objcValue {
+        case .boolean:
+            self = .boolean
+        case .number:
+            self = .number
+        case .trigger:
+            self = .trigger
+        @unknown default:
+            self = .boolean
+        }
+    }
+}
@@ -174,6 +174,21 @@ final class FileService: NSObject, FileListener {
         }
     }
 
+    /// Requests the metadata index of a loaded file asynchronously.
+    ///
+    /// The continuation is resumed when `onFileMetadataListed` is called.
+    ///
+    /// - Parameter fileHandle: The file handle for the loaded file
+    /// - Returns: The metadata index of the file
+    /// - Throws: `FileError` if the request fails
+    @MainActor
+    func getMetadata(fileHandle: File.FileHandle) async throws -> FileMetadata {
+        RiveLog.debug(tag: .file, "\(Self.context(fileHandle)) Requesting file metadata")
+        return try await withCancellableRequest(mapError: FileError.invalidFile) { requestID in
+            self.dependencies.commandQueue.requestFileMetadata(fileHandle, requestID: requestID)
+        }
+    }
+
     /// Requests view model names for a loaded file asynchronously.
     ///
     /// The continuation is resumed when `onViewModelsListed` is called.
@@ -326,6 +341,26 @@ final class FileService: NSObject, FileListener {
         }
     }
 
+    /// Called when the metadata index of a file is listed.
+    ///
+    /// Listener callback invoked by the command server. Dispatches to main actor to resume
+    /// the continuation with the metadata dictionary parsed into a `FileMetadata`.
+    nonisolated func onFileMetadataListed(_ fileHandle: UInt64, requestID: UInt64, metadata: [String: Any]) {
+        let result = Result { try FileMetadata(from: metadata) }
+        Task { @MainActor in
+            finishImmediateRequest(requestID)
+            guard let request = continuations.removeValue(forKey: requestID) else { return }
+            switch result {
+            case .success(let metadata):
+                RiveLog.debug(tag: .file, "\(Self.context(fileHandle)) Received metadata for \(metadata.artboards.count) artboards")
+                try request.continuation.resume(returning: metadata)
+            case .failure(let error):
+                RiveLog.error(tag: .file, "\(Self.context(fileHandle)) Failed parsing file metadata")
+                request.continuation.resume(throwing: error)
+            }
+        }
+    }
+
     /// Called when view model names are listed for a file.
     ///
     /// Listener callback invoked by the command server. Dispatches to main actor to resume
@@ -169,6 +169,25 @@ NS_SWIFT_NAME(FileListener)
                      requestID:(uint64_t)requestID
                          enums:(NSArray<NSDictionary<NSString*, id>*>*)enums;
 
+/**
+ * Called when the metadata index of a file is listed.
+ *
+ * @param fileHandle The unique identifier of the file
+ * @param requestID The identifier of the listing request
+ * @param metadata A dictionary containing:
+ *                 - "artboards": NSArray of dictionaries, each containing
+ *                   "name", "width", "height", "animationNames" and
+ *                   "stateMachines"; each state machine contains "name" and
+ *                   "inputs", and each input contains "name" and "type" (an
+ *                   NSNumber with a RiveStateMachineInputType value)
+ *                 - "viewModels": NSArray of dictionaries, each containing
+ *                   "name", "properties" (in the format of
+ *                   onViewModelPropertiesListed:) and "instanceNames"
+ */
+- (void)onFileMetadataListed:(uint64_t)fileHandle
+                   requestID:(uint64_t)requestID
+                    metadata:(NSDictionary<NSString*, id>*)metadata;
+
 @end
 
 NS_ASSUME_NONNULL_END
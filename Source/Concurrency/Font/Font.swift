@@ -18,8 +18,9 @@ import AppKit
 /// Font instances are created from font data (e.g., TTF, OTF) or a platform-native font and can
 /// be registered as global assets with a worker, allowing them to be provided dynamically at runtime.
 ///
-/// Lifetime: Font instances are guaranteed to exist while registered as a global asset with a worker.
-/// When not used as a global asset, you must maintain a strong reference to the instance to keep it alive.
+/// Lifetime: you must maintain a strong reference to the instance to keep it alive. Once a registered
+/// font is released, the worker's global asset registry owns the decoded font, and may evict it when it is
+/// not referenced by a loaded file; see `Worker.globalAssetMemoryBudget`.
 public final class Font: Equatable {
     /// The underlying type for the font handle identifier.
     ///
@@ -30,6 +31,10 @@ public final class Font: Equatable {
     typealias FontHandle = UInt64
 
     let handle: FontHandle
+    /// The data the font was decoded from, shared rather than copied, so that it can be decoded
+    /// again if it is evicted after being registered as a global asset. `nil` for platform fonts,
+    /// which are never evicted.
+    let encodedData: Data?
     private let dependencies: Dependencies
     
     /// Creates a font by decoding the provided font data.
@@ -43,7 +48,7 @@ public final class Font: Equatable {
         RiveLog.debug(tag: .font, "[Font] Initializing font from data (\(data.count) bytes)")
         let handle = try await dependencies.fontService.decodeFont(from: data)
         RiveLog.debug(tag: .font, "[Font (\(handle))] Initialized font")
-        self.init(handle: handle, dependencies: dependencies)
+        self.init(handle: handle, dependencies: dependencies, encodedData: data)
     }
 
     #if canImport(UIKit) || RIVE_MAC_CATALYST
@@ -67,9 +72,10 @@ public final class Font: Equatable {
     #endif
 
     @MainActor
-    init(handle: FontHandle, dependencies: Dependencies) {
+    init(handle: FontHandle, dependencies: Dependencies, encodedData: Data? = nil) {
         self.handle = handle
         self.dependencies = dependencies
+        self.encodedData = encodedData
     }
 
     deinit {
@@ -13,8 +13,9 @@ import Foundation
 /// Image instances are created by decoding image data (e.g., PNG, JPEG, WebP) and can be registered
 /// as global assets with a worker, allowing them to be provided dynamically at runtime.
 ///
-/// Lifetime: Image instances are guaranteed to exist while registered as a global asset with a worker.
-/// When not used as a global asset, you must maintain a strong reference to the instance to keep it alive.
+/// Lifetime: you must maintain a strong reference to the instance to keep it alive. Once a registered
+/// image is released, the worker's global asset registry owns the decoded image, and may evict it when it is
+/// not referenced by a loaded file; see `Worker.globalAssetMemoryBudget`.
 public final class Image: Equatable {
     /// The underlying type for the image handle identifier.
     ///
@@ -24,7 +25,27 @@ public final class Image: Equatable {
     /// is deallocated via `ImageService.deleteImage`.
     typealias ImageHandle = UInt64
 
+    /// Describes how an image decoded with a maximum pixel size was reduced.
+    ///
+    /// Savings are estimated for RGBA8 images: the decoded bitmap on the CPU, and the texture
+    /// with its full mipmap chain on the GPU.
+    public struct Downsampling: Sendable, Equatable {
+        /// The size, in pixels, of the encoded image.
+        public let sourcePixelSize: CGSize
+        /// The size, in pixels, the image was decoded at.
+        public let pixelSize: CGSize
+        /// The estimated bitmap memory saved on the CPU, in bytes.
+        public let savedCPUByteCount: Int
+        /// The estimated texture memory saved on the GPU, in bytes.
+        public let savedGPUByteCount: Int
+    }
+
     let handle: ImageHandle
+    /// The data the image was decoded from, shared rather than copied, so that it can be decoded
+    /// again if it is evicted after being registered as a global asset.
+    let encodedData: Data?
+    /// How the image was reduced when decoded, or `nil` if it was decoded at full resolution.
+    public let downsampling: Downsampling?
     private let dependencies: Dependencies
     
     /// Creates an image by decoding the provided image data.
@@ -38,13 +59,55 @@ public final class Image: Equatable {
         RiveLog.debug(tag: .image, "[Image] Initializing image from data (\(data.count) bytes)")
         let handle = try await dependencies.imageService.decodeImage(from: data)
         RiveLog.debug(tag: .image, "[Image (\(handle))] Initialized image")
-        self.init(handle: handle, dependencies: dependencies)
+        self.init(handle: handle, dependencies: dependencies, encodedData: data)
+    }
+
+    /// Creates an image by decoding the provided image data, reduced to cover a maximum size.
+    ///
+    /// The image is reduced off the main actor, by the smallest power of two that still covers
+    /// `maximumPixelSize`, before being sent to the worker to decode.
+    ///
+    /// - Parameters:
+    ///   - data: The image data to decode (e.g., PNG, JPEG, WebP data)
+    ///   - maximumPixelSize: The largest size, in pixels, the image is displayed at. A zero
+    ///     dimension leaves that axis unconstrained.
+    ///   - dependencies: The dependencies required for image operations
+    /// - Throws: `ImageError.failedDecoding` if the image data cannot be decoded
+    @MainActor
+    convenience init(data: Data, maximumPixelSize: CGSize, dependencies: Dependencies) async throws {
+        let (reduced, downsampling) = await Task.detached(priority: .userInitiated) {
+            Image.downsample(data, maximumPixelSize: maximumPixelSize)
+        }.value
+        if let downsampling {
+            RiveLog.debug(tag: .image, "[Image] Reduced image from \(downsampling.sourcePixelSize) to \(downsampling.pixelSize)")
+        }
+        let handle = try await dependencies.imageService.decodeImage(from: reduced)
+        self.init(handle: handle, dependencies: dependencies, encodedData: reduced, downsampling: downsampling)
     }
 
     @MainActor
-    init(handle: ImageHandle, dependencies: Dependencies) {
+    init(handle: ImageHandle, dependencies: Dependencies, encodedData: Data? = nil, downsampling: Downsampling? = nil) {
         self.handle = handle
         self.dependencies = dependencies
+        self.encodedData = encodedData
+        self.downsampling = downsampling
+    }
+
+    /// Reduces image data to cover `maximumPixelSize`. Data ImageIO cannot read is returned as is,
+    /// since the worker may still be able to decode it.
+    static func downsample(_ data: Data, maximumPixelSize: CGSize) -> (Data, Downsampling?) {
+        guard let downsampled = RiveDownsampledImageData(data: data, maximumPixelSize: maximumPixelSize) else {
+            return (data, nil)
+        }
+        return (
+            downsampled.data,
+            Downsampling(
+                sourcePixelSize: downsampled.sourcePixelSize,
+                pixelSize: downsampled.pixelSize,
+                savedCPUByteCount: Int(downsampled.savedCPUByteCount),
+                savedGPUByteCount: Int(downsampled.savedGPUByteCount)
+            )
+        )
     }
 
     deinit {
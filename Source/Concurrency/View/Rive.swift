@@ -37,6 +37,14 @@ public final class Rive: ObservableObject, Equatable {
             fitDidChange.send(fit)
         }
     }
+    /// How the time between frames is turned into state machine advances.
+    /// Takes effect from the next frame.
+    public var timestep: Timestep
+    /// Whether pointer moves are held until the next frame, sending only the
+    /// latest move of each pointer. Cuts the listener hit tests run for
+    /// pointers that move several times a frame, at the cost of intermediate
+    /// positions. Takes effect from the next pointer move.
+    public var coalescesPointerMoves: Bool
 
     // Publishers for various mutable properties, so that RiveUIView can
     // listen to these changes and react appropriately
@@ -52,6 +60,8 @@ public final class Rive: ObservableObject, Equatable {
     ///   - dataBind: How data binding should be initialized
     ///   - fit: The fit mode for scaling and positioning, defaults to `.contain(alignment: .center)`
     ///   - backgroundColor: The background color, defaults to clear
+    ///   - timestep: How frame time advances the state machine, defaults to `.variable`
+    ///   - coalescesPointerMoves: Whether to send only the latest pointer move per frame, defaults to `false`
     @MainActor
     public init(
         file: File,
@@ -60,12 +70,16 @@ public final class Rive: ObservableObject, Equatable {
         dataBind: DataBind = .auto,
         fit: Fit = .contain(alignment: .center),
         backgroundColor: Color = Color(red: 0, green: 0, blue: 0, alpha: 0),
+        timestep: Timestep = .variable,
+        coalescesPointerMoves: Bool = false,
     ) async throws {
         self.file = file
         self.artboard = try await Self.resolveArtboard(artboard, for: file)
         self.stateMachine = try await Self.resolveStateMachine(stateMachine, for: self.artboard)
         self.fit = fit
         self.backgroundColor = backgroundColor
+        self.timestep = timestep
+        self.coalescesPointerMoves = coalescesPointerMoves
 
         switch dataBind {
         case .auto:
@@ -102,6 +116,8 @@ public final class Rive: ObservableObject, Equatable {
             && lhs.viewModelInstance == rhs.viewModelInstance
             && lhs.backgroundColor == rhs.backgroundColor
             && lhs.fit == rhs.fit
+            && lhs.timestep == rhs.timestep
+            && lhs.coalescesPointerMoves == rhs.coalescesPointerMoves
         }
     }
 
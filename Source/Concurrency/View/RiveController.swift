@@ -31,6 +31,8 @@ final class RiveController {
         didSet {
             guard oldValue != isPaused else { return }
             if isPaused {
+                // Paused views get no frames to send held moves from.
+                sendPendingPointerMoves()
                 resetTiming()
             }
         }
@@ -63,6 +65,10 @@ final class RiveController {
     private let messageGate: CommandQueueMessageGate
     private weak var delegate: RiveControllerDelegate?
     private var lastTimestamp: TimeInterval?
+    private var fixedTimestepClock: FixedTimestepClock?
+    // The latest move of each pointer since the last frame, in the order the
+    // pointers first moved.
+    private var pendingPointerMoves: [PointerEvent] = []
     private var hasProcessedFirstDraw = false
     private var wasOnscreen = false
     private var lastDrawnDrawableSize: CGSize?
@@ -138,7 +144,20 @@ final class RiveController {
 
     func handleInput(_ input: Input) {
         RiveLog.trace(tag: .view, "[RiveUIView] Handling input event")
-        inputHandler.handle(input, in: rive.stateMachine)
+        if case .pointerMove(let event) = input, rive.coalescesPointerMoves, isPaused == false {
+            // The state machine hit-tests every listener for every pointer
+            // event, and moves can arrive several times a frame, so only the
+            // latest move of each pointer is sent, once per frame.
+            if let index = pendingPointerMoves.firstIndex(where: { $0.id == event.id }) {
+                pendingPointerMoves[index] = event
+            } else {
+                pendingPointerMoves.append(event)
+            }
+        } else {
+            // Keep moves ahead of the events that followed them.
+            sendPendingPointerMoves()
+            inputHandler.handle(input, in: rive.stateMachine)
+        }
         markDirty()
     }
 
@@ -146,6 +165,7 @@ final class RiveController {
         RiveLog.trace(tag: .view, "[RiveUIView] Resetting frame timing")
         // This will cause the initial advance on next play to be 0.
         lastTimestamp = nil
+        fixedTimestepClock?.reset()
     }
 
     func advance(
@@ -165,7 +185,10 @@ final class RiveController {
          | Settled && becameOnscreen                             | No                               | Yes   |
          | Paused && drawable size changed                       | No                               | Yes   |
          | Settled && drawable size changed                      | No                               | Yes   |
+         | Fixed timestep && no step due && !first && !resize    | No                               | No    |
          */
+        sendPendingPointerMoves()
+
         // Track visibility transitions so settled views can redraw once when they return onscreen.
         let becameOnscreen = wasOnscreen == false && isOnscreen
         defer { wasOnscreen = isOnscreen }
@@ -215,10 +238,19 @@ final class RiveController {
         messageGate.processMessagesForFrame()
 
         let shouldAdvance = hasProcessedFirstDraw == false || isSettled == false
+        var advancedSteps = false
         if shouldAdvance {
-            isDirty = false
-            RiveLog.trace(tag: .view, "[RiveUIView] Advancing state machine (dt=\(delta))")
-            rive.stateMachine.advance(by: delta)
+            let (step, count) = advanceSteps(for: delta)
+            advancedSteps = count > 0
+            // A fixed timestep frame before the next step is due leaves the
+            // state machine, and whether it has changed since, as it was.
+            if advancedSteps {
+                isDirty = false
+            }
+            RiveLog.trace(tag: .view, "[RiveUIView] Advancing state machine (dt=\(step), steps=\(count))")
+            for _ in 0..<count {
+                rive.stateMachine.advance(by: step)
+            }
 
             #if !os(macOS) || RIVE_MAC_CATALYST
             let semanticsFitBridge = rive.fit.bridged(from: scaleProvider)
@@ -247,6 +279,14 @@ final class RiveController {
             return nil
         }
 
+        // Frames that did not advance have nothing new to draw, unless the
+        // view returned onscreen or its drawable size changed.
+        if shouldAdvance, advancedSteps == false, hasProcessedFirstDraw,
+           becameOnscreen == false, drawableSizeChanged == false {
+            RiveLog.trace(tag: .view, "[RiveUIView] Skipping frame: no fixed timestep step was due")
+            return nil
+        }
+
         // Build renderer configuration only when this frame should be drawn.
         let fitBridge = rive.fit.bridged(from: scaleProvider)
         let configuration = RiveUIRendererConfiguration(
@@ -268,6 +308,30 @@ final class RiveController {
 
     // MARK: - Private
 
+    /// Returns how far to advance the state machine, and how many times, for
+    /// a frame delta seconds after the previous one.
+    private func advanceSteps(for delta: TimeInterval) -> (step: TimeInterval, count: Int) {
+        fixedTimestepClock = rive.timestep.clock(reusing: fixedTimestepClock)
+        guard var clock = fixedTimestepClock else {
+            return (delta, 1)
+        }
+        let count = clock.steps(for: delta)
+        fixedTimestepClock = clock
+        // The first frame still advances by 0 so that it draws the initial state.
+        if count == 0, hasProcessedFirstDraw == false {
+            return (0, 1)
+        }
+        return (clock.step, count)
+    }
+
+    private func sendPendingPointerMoves() {
+        guard pendingPointerMoves.isEmpty == false else { return }
+        for event in pendingPointerMoves {
+            inputHandler.handle(.pointerMove(event), in: rive.stateMachine)
+        }
+        pendingPointerMoves.removeAll(keepingCapacity: true)
+    }
+
     private func markDirty() {
         isDirty = true
         hasPendingSettle = false
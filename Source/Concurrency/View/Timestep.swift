@@ -0,0 +1,76 @@
+//
+//  Timestep.swift
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+import Foundation
+
+/// Controls how the time between frames is turned into state machine advances.
+public enum Timestep: Equatable {
+    /// Advances once per frame, by the time elapsed since the previous frame.
+    case variable
+    /// Advances in steps of exactly `1 / rate` seconds, as many as have
+    /// elapsed, carrying the remainder over to the next frame.
+    ///
+    /// Because every advance is by the same amount, the state after a given
+    /// number of steps and inputs does not depend on frame timing, so repeated
+    /// runs produce identical state. A frame that arrives late advances at most
+    /// `maxStepsPerFrame` steps; time beyond that is dropped rather than caught
+    /// up, so a long hitch slows the animation down instead of making it jump.
+    /// Frames are drawn after their last step; nothing is drawn in between.
+    ///
+    /// - Parameters:
+    ///   - rate: Steps per second, e.g. 60.
+    ///   - maxStepsPerFrame: The most steps to advance in one frame.
+    case fixed(rate: Double, maxStepsPerFrame: Int = 4)
+}
+
+/// Splits the time between frames into whole fixed steps.
+struct FixedTimestepClock: Equatable {
+    /// The length of a step, in seconds.
+    let step: TimeInterval
+    let maxStepsPerFrame: Int
+    private var accumulated: TimeInterval = 0
+
+    init(rate: Double, maxStepsPerFrame: Int) {
+        self.step = 1 / max(rate, 1)
+        self.maxStepsPerFrame = max(maxStepsPerFrame, 1)
+    }
+
+    /// Adds elapsed seconds and returns how many steps to advance now.
+    mutating func steps(for elapsed: TimeInterval) -> Int {
+        accumulated += max(0, elapsed)
+        // Count a step that is due within an eighth of a step, so that a
+        // display refreshing at the step rate advances one step every frame
+        // despite jitter in its timestamps, rather than alternating between
+        // zero and two. The shortfall is made up from the next frame.
+        var steps = Int((accumulated + step / 8) / step)
+        if steps > maxStepsPerFrame {
+            steps = maxStepsPerFrame
+            accumulated = 0
+        } else {
+            accumulated -= Double(steps) * step
+        }
+        return steps
+    }
+
+    /// Drops any time carried over.
+    mutating func reset() {
+        accumulated = 0
+    }
+}
+
+extension Timestep {
+    /// Returns clock if it matches this timestep, or a new clock if not, or
+    /// nil if this timestep is variable.
+    func clock(reusing clock: FixedTimestepClock?) -> FixedTimestepClock? {
+        guard case let .fixed(rate, maxStepsPerFrame) = self else { return nil }
+        let configured = FixedTimestepClock(rate: rate, maxStepsPerFrame: maxStepsPerFrame)
+        if let clock, clock.step == configured.step, clock.maxStepsPerFrame == configured.maxStepsPerFrame {
+            return clock
+        }
+        return configured
+    }
+}
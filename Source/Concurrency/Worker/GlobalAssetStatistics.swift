@@ -0,0 +1,53 @@
+//
+//  GlobalAssetStatistics.swift
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+import Foundation
+
+/// Describes a global asset registered with a worker, and how much memory it occupies.
+public struct GlobalAssetStatistics: Sendable, Equatable {
+    /// The type of a global asset.
+    public enum AssetType: String, Sendable, Equatable {
+        case image
+        case font
+        case audio
+    }
+
+    /// The name the asset is registered under.
+    public let name: String
+    /// The type of the asset.
+    public let type: AssetType
+    /// The memory the asset occupies while resident, in bytes. Images are accounted at four
+    /// bytes per pixel; fonts and audio at the size of their data.
+    public let byteCount: Int
+    /// Whether the asset is decoded. Evicted assets are decoded again before the next file loads.
+    public let isResident: Bool
+    /// Whether an `Image`, `Font` or `Audio` instance for the asset is still alive. Such assets
+    /// are never evicted.
+    public let isHeldByClient: Bool
+    /// The number of live files loaded while the asset was registered. Such assets are never
+    /// evicted, since the files may have bound them.
+    public let fileReferenceCount: Int
+    /// The number of times the asset was decoded again after being evicted.
+    public let redecodeCount: Int
+}
+
+extension GlobalAssetStatistics {
+    /// Creates statistics from a dictionary delivered by `globalAssetStatistics`.
+    init?(from dictionary: [String: Any]) {
+        guard let name = dictionary["name"] as? String,
+              let rawType = dictionary["type"] as? String,
+              let type = AssetType(rawValue: rawType)
+        else { return nil }
+        self.name = name
+        self.type = type
+        self.byteCount = (dictionary["byteCount"] as? NSNumber)?.intValue ?? 0
+        self.isResident = (dictionary["resident"] as? NSNumber)?.boolValue ?? false
+        self.isHeldByClient = (dictionary["heldByClient"] as? NSNumber)?.boolValue ?? false
+        self.fileReferenceCount = (dictionary["fileReferenceCount"] as? NSNumber)?.intValue ?? 0
+        self.redecodeCount = (dictionary["redecodeCount"] as? NSNumber)?.intValue ?? 0
+    }
+}
@@ -22,13 +22,16 @@ import AppKit
 /// Workers also manage global assets (images, fonts, and audio) that can be shared across
 /// multiple Rive files and artboards. These assets are registered by name and can be referenced
 /// by Rive files during rendering.
+///
+/// Global assets are kept in a registry on the worker that accounts for the memory each one
+/// occupies once decoded. When registered assets exceed `globalAssetMemoryBudget`, assets that
+/// are not referenced are evicted, least recently used first, and decoded again before the next
+/// file is loaded. An asset is referenced while its `Image`, `Font` or `Audio` instance is alive,
+/// or while a file loaded after it was registered is alive. Unreferenced assets are also evicted
+/// when the system reports memory pressure.
 public final class Worker {
     let dependencies: Dependencies
 
-    private var images: [String: Image] = [:]
-    private var fonts: [String: Font] = [:]
-    private var audios: [String: Audio] = [:]
-
     @MainActor
     public convenience init() async throws {
         RiveLog.debug(tag: .worker, "[Worker] Initializing worker")
@@ -122,6 +125,38 @@ public final class Worker {
         return image
     }
 
+    /// Creates an image from the provided image data, decoded at the size it is displayed at
+    /// rather than at full resolution.
+    ///
+    /// The image is reduced by the smallest power of two that still covers `maximumPixelSize`,
+    /// which keeps its mipmaps aligned with the original's. Images that already fit are decoded
+    /// as is. The memory saved is reported by the image's `downsampling`.
+    ///
+    /// - Parameters:
+    ///   - data: The image data to decode (e.g., PNG, JPEG, WebP data)
+    ///   - maximumPixelSize: The largest size, in pixels, the image is displayed at, such as its
+    ///     size in the artboard multiplied by the screen scale.
+    /// - Returns: A decoded `Image` instance
+    /// - Throws: An error if the image data cannot be decoded
+    @MainActor
+    public func decodeImage(from data: Data, maximumPixelSize: CGSize) async throws -> Image {
+        RiveLog.debug(tag: .worker, "[Worker] Decoding image data (\(data.count) bytes) to fit \(maximumPixelSize)")
+        let image = try await Image(
+            data: data,
+            maximumPixelSize: maximumPixelSize,
+            dependencies: .init(
+                imageService: .init(
+                    dependencies: .init(
+                        commandQueue: dependencies.workerService.dependencies.commandQueue,
+                        messageGate: dependencies.workerService.messageGate
+                    )
+                )
+            )
+        )
+        RiveLog.debug(tag: .worker, "[Worker] Decoded image")
+        return image
+    }
+
     /// Registers an image as a global asset that can be referenced by name.
     ///
     /// Global assets are out-of-band resources that can be shared across multiple Rive files
@@ -134,22 +169,20 @@ public final class Worker {
     @MainActor
     public func addGlobalImageAsset(_ image: Image, name: String) {
         RiveLog.debug(tag: .worker, "[Worker] Adding global image asset '\(name)'")
-        dependencies.workerService.set(image: image.handle, name: name)
-        images[name] = image
+        dependencies.workerService.set(image: image.handle, encodedData: image.encodedData, name: name)
     }
 
     /// Removes a global image asset by name.
     ///
     /// After removal, the image can no longer be provided dynamically at runtime to Rive files
-    /// loaded by this worker. The image instance itself is not deallocated; only its registration
-    /// as a global asset is removed.
+    /// loaded by this worker. If the image instance has already been released, the decoded image is
+    /// freed; otherwise only its registration as a global asset is removed.
     ///
     /// - Parameter name: The name of the image asset to remove
     @MainActor
     public func removeGlobalImageAsset(name: String) {
         RiveLog.debug(tag: .worker, "[Worker] Removing global image asset '\(name)'")
         dependencies.workerService.remove(image: name)
-        images.removeValue(forKey: name)
     }
 
     /// Creates a font from the provided font data by decoding it into a `Font` instance
@@ -215,22 +248,20 @@ public final class Worker {
     @MainActor
     public func addGlobalFontAsset(_ font: Font, name: String) {
         RiveLog.debug(tag: .worker, "[Worker] Adding global font asset '\(name)'")
-        dependencies.workerService.set(font: font.handle, name: name)
-        fonts[name] = font
+        dependencies.workerService.set(font: font.handle, encodedData: font.encodedData, name: name)
     }
 
     /// Removes a global font asset by name.
     ///
     /// After removal, the font can no longer be provided dynamically at runtime to Rive files
-    /// loaded by this worker. The font instance itself is not deallocated; only its registration
-    /// as a global asset is removed.
+    /// loaded by this worker. If the font instance has already been released, the decoded font is
+    /// freed; otherwise only its registration as a global asset is removed.
     ///
     /// - Parameter name: The name of the font asset to remove
     @MainActor
     public func removeGlobalFontAsset(_ name: String) {
         RiveLog.debug(tag: .worker, "[Worker] Removing global font asset '\(name)'")
         dependencies.workerService.remove(font: name)
-        fonts.removeValue(forKey: name)
     }
 
     /// Creates an audio source from the provided audio data by decoding it into an `Audio` instance
@@ -269,22 +300,50 @@ public final class Worker {
     @MainActor
     public func addGlobalAudioAsset(_ audio: Audio, name: String) {
         RiveLog.debug(tag: .worker, "[Worker] Adding global audio asset '\(name)'")
-        dependencies.workerService.set(audio: audio.handle, name: name)
-        audios[name] = audio
+        dependencies.workerService.set(audio: audio.handle, encodedData: audio.encodedData, name: name)
     }
 
     /// Removes a global audio asset by name.
     ///
     /// After removal, the audio can no longer be provided dynamically at runtime to Rive files
-    /// loaded by this worker. The audio instance itself is not deallocated; only its registration
-    /// as a global asset is removed.
+    /// loaded by this worker. If the audio instance has already been released, the decoded audio is
+    /// freed; otherwise only its registration as a global asset is removed.
     ///
     /// - Parameter name: The name of the audio asset to remove
     @MainActor
     public func removeGlobalAudioAsset(name: String) {
         RiveLog.debug(tag: .worker, "[Worker] Removing global audio asset '\(name)'")
         dependencies.workerService.remove(audio: name)
-        audios.removeValue(forKey: name)
+    }
+
+    /// The memory budget, in bytes, for global assets. Defaults to 128 MB.
+    ///
+    /// Lowering the budget evicts unreferenced assets until the registered assets fit.
+    @MainActor
+    public var globalAssetMemoryBudget: Int {
+        get { dependencies.workerService.globalAssetMemoryBudget }
+        set { dependencies.workerService.globalAssetMemoryBudget = newValue }
+    }
+
+    /// The memory, in bytes, occupied by every decoded global asset.
+    @MainActor
+    public var globalAssetResidentByteCount: Int {
+        dependencies.workerService.globalAssetResidentByteCount
+    }
+
+    /// The statistics of every registered global asset, most recently used first.
+    @MainActor
+    public var globalAssetStatistics: [GlobalAssetStatistics] {
+        dependencies.workerService.globalAssetStatistics
+    }
+
+    /// Evicts every global asset that is not referenced, regardless of the budget.
+    ///
+    /// - Returns: The number of bytes freed
+    @MainActor
+    @discardableResult
+    public func trimGlobalAssets() -> Int {
+        dependencies.workerService.trimGlobalAssets()
     }
 
     @MainActor
@@ -50,10 +50,10 @@ final class WorkerService {
     ///
     /// Delegates to the command queue. No listener callback is invoked for this operation.
     @MainActor
-    func set(image: Image.ImageHandle, name: String) {
+    func set(image: Image.ImageHandle, encodedData: Data?, name: String) {
         let requestID = dependencies.commandQueue.nextRequestID
         RiveLog.debug(tag: .worker, "[Worker] Registering global image asset '\(name)'")
-        dependencies.commandQueue.addGlobalImageAsset(name, imageHandle: image, requestID: requestID)
+        dependencies.commandQueue.addGlobalImageAsset(name, imageHandle: image, encodedData: encodedData, requestID: requestID)
     }
 
     /// Removes a global image asset.
@@ -70,10 +70,10 @@ final class WorkerService {
     ///
     /// Delegates to the command queue. No listener callback is invoked for this operation.
     @MainActor
-    func set(font: Font.FontHandle, name: String) {
+    func set(font: Font.FontHandle, encodedData: Data?, name: String) {
         let requestID = dependencies.commandQueue.nextRequestID
         RiveLog.debug(tag: .worker, "[Worker] Registering global font asset '\(name)'")
-        dependencies.commandQueue.addGlobalFontAsset(name, fontHandle: font, requestID: requestID)
+        dependencies.commandQueue.addGlobalFontAsset(name, fontHandle: font, encodedData: encodedData, requestID: requestID)
     }
 
     /// Removes a global font asset.
@@ -90,10 +90,10 @@ final class WorkerService {
     ///
     /// Delegates to the command queue. No listener callback is invoked for this operation.
     @MainActor
-    func set(audio: Audio.AudioHandle, name: String) {
+    func set(audio: Audio.AudioHandle, encodedData: Data?, name: String) {
         let requestID = dependencies.commandQueue.nextRequestID
         RiveLog.debug(tag: .worker, "[Worker] Registering global audio asset '\(name)'")
-        dependencies.commandQueue.addGlobalAudioAsset(name, audioHandle: audio, requestID: requestID)
+        dependencies.commandQueue.addGlobalAudioAsset(name, audioHandle: audio, encodedData: encodedData, requestID: requestID)
     }
 
     /// Removes a global audio asset.
@@ -105,6 +105,38 @@ final class WorkerService {
         RiveLog.debug(tag: .worker, "[Worker] Removing global audio asset '\(audio)'")
         dependencies.commandQueue.removeGlobalAudioAsset(audio, requestID: requestID)
     }
+
+    /// The memory budget, in bytes, for global assets.
+    @MainActor
+    var globalAssetMemoryBudget: Int {
+        get { dependencies.commandQueue.globalAssetMemoryBudget }
+        set {
+            RiveLog.debug(tag: .worker, "[Worker] Setting global asset memory budget to \(newValue) bytes")
+            dependencies.commandQueue.globalAssetMemoryBudget = newValue
+        }
+    }
+
+    /// The accounted size, in bytes, of every resident global asset.
+    @MainActor
+    var globalAssetResidentByteCount: Int {
+        dependencies.commandQueue.globalAssetResidentByteCount
+    }
+
+    /// The statistics of every registered global asset, most recently used first.
+    @MainActor
+    var globalAssetStatistics: [GlobalAssetStatistics] {
+        dependencies.commandQueue.globalAssetStatistics().compactMap { GlobalAssetStatistics(from: $0) }
+    }
+
+    /// Evicts every unreferenced global asset.
+    ///
+    /// - Returns: The number of bytes freed
+    @MainActor
+    func trimGlobalAssets() -> Int {
+        let freed = dependencies.commandQueue.trimGlobalAssets()
+        RiveLog.debug(tag: .worker, "[Worker] Trimmed global assets, freeing \(freed) bytes")
+        return freed
+    }
 }
 
 extension WorkerService {
@@ -203,6 +203,10 @@ NS_SWIFT_NAME(RiveDataBindingViewModel.Instance)
 
 /// Calls all registered property listeners for the properties of the view model
 /// instance.
+///
+/// Listeners run only for properties that have them, and for list
+/// properties, so that cost does not grow with properties that are read but
+/// not observed. Afterwards, the changes of every cached property are cleared.
 - (void)updateListeners;
 
 @end
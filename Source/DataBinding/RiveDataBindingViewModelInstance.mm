@@ -9,6 +9,13 @@
 #import <Rive.h>
 #import <RivePrivateHeaders.h>
 #import <RiveRuntime/RiveRuntime-Swift.h>
+#import <atomic>
+#import <vector>
+
+// Incremented whenever a nested instance is replaced, which may change what
+// any path through it resolves to. Path caches built under an older
+// generation are discarded on their next lookup.
+static std::atomic<uint64_t> RiveViewModelInstancePathGeneration{0};
 
 @interface RiveDataBindingViewModelInstance () <
     RiveDataBindingViewModelInstancePropertyDelegate>
@@ -21,6 +28,19 @@
         _properties;
     NSMutableDictionary<NSString*, RiveDataBindingViewModelInstance*>*
         _children;
+    // The properties created by this instance that updateListeners visits:
+    // those with listeners, and lists, whose items may have listeners.
+    NSHashTable<RiveDataBindingViewModelInstanceProperty*>* _observedProperties;
+    // Reused by updateListeners to hold the observed properties while their
+    // listeners run, so that a frame does not allocate.
+    std::vector<RiveDataBindingViewModelInstanceProperty*> _dispatchBuffer;
+    // Full paths, relative to this instance, to what they resolved to, so
+    // that repeated lookups are a single hash lookup rather than a walk.
+    NSMutableDictionary<NSString*, RiveDataBindingViewModelInstanceProperty*>*
+        _propertiesByPath;
+    NSMutableDictionary<NSString*, RiveDataBindingViewModelInstance*>*
+        _instancesByPath;
+    uint64_t _pathGeneration;
 }
 
 - (instancetype)initWithInstance:
@@ -31,6 +51,11 @@
         _instance = instance;
         _properties = [NSMutableDictionary dictionary];
         _children = [NSMutableDictionary dictionary];
+        _observedProperties = [NSHashTable weakObjectsHashTable];
+        _propertiesByPath = [NSMutableDictionary dictionary];
+        _instancesByPath = [NSMutableDictionary dictionary];
+        _pathGeneration = RiveViewModelInstancePathGeneration.load(
+            std::memory_order_relaxed);
     }
     return self;
 }
@@ -265,9 +290,21 @@
 - (RiveDataBindingViewModelInstance*)viewModelInstancePropertyFromPath:
     (NSString*)path
 {
+    [self validatePathCaches];
+    RiveDataBindingViewModelInstance* instance = _instancesByPath[path];
+    if (instance != nil)
+    {
+        return instance;
+    }
+
     RiveDataBindingViewModelInstance* parent = [self parentForPath:path];
-    return
+    instance =
         [parent viewModelInstanceWithName:[[path pathComponents] lastObject]];
+    if (instance != nil)
+    {
+        _instancesByPath[path] = instance;
+    }
+    return instance;
 }
 
 - (BOOL)setViewModelInstancePropertyFromPath:(NSString*)path
@@ -377,6 +414,7 @@
         [[RiveDataBindingViewModelInstanceListProperty alloc]
             initWithList:list];
     listProperty.valueDelegate = self;
+    [_observedProperties addObject:listProperty];
 
     [self cacheProperty:listProperty withPath:path];
 
@@ -420,13 +458,29 @@
 
 - (void)updateListeners
 {
-    [_properties enumerateKeysAndObjectsUsingBlock:^(
-                     NSString* _Nonnull key,
-                     RiveDataBindingViewModelInstanceProperty* _Nonnull obj,
-                     BOOL* _Nonnull stop) {
-      [obj handleListeners];
-    }];
+    // Only observed properties can dispatch anything, so listeners run for
+    // them alone. Listeners may add or remove listeners, which mutates the
+    // hash table, so dispatch from a copy held in a reused buffer. The buffer
+    // is taken for the duration, so a nested call starts with its own.
+    if (_observedProperties.count > 0)
+    {
+        std::vector<RiveDataBindingViewModelInstanceProperty*> observed;
+        observed.swap(_dispatchBuffer);
+        for (RiveDataBindingViewModelInstanceProperty* property in
+             _observedProperties)
+        {
+            observed.push_back(property);
+        }
+        for (RiveDataBindingViewModelInstanceProperty* property : observed)
+        {
+            [property handleListeners];
+        }
+        observed.clear();
+        _dispatchBuffer.swap(observed);
+    }
 
+    // Every cached property, observed or not, reports only changes made since
+    // the previous call.
     [_properties enumerateKeysAndObjectsUsingBlock:^(
                      NSString* _Nonnull key,
                      RiveDataBindingViewModelInstanceProperty* _Nonnull obj,
@@ -457,52 +511,82 @@
 {
     RiveDataBindingViewModelInstance* parent = [self parentForPath:path];
     [parent setProperty:value forName:[path lastPathComponent]];
+    [self validatePathCaches];
+    _propertiesByPath[path] = value;
 }
 
 - (nullable id)cachedPropertyFromPath:(NSString*)path asClass:(Class)aClass
 {
+    [self validatePathCaches];
+    id property = _propertiesByPath[path];
+    if (property != nil && [property isKindOfClass:aClass])
+    {
+        return property;
+    }
+
+    // The property may have been cached by its parent through another path,
+    // e.g. directly on a nested instance.
     RiveDataBindingViewModelInstance* parent = [self parentForPath:path];
-    id property = [parent cachedPropertyWithName:[path lastPathComponent]];
+    property = [parent cachedPropertyWithName:[path lastPathComponent]];
     if (property != nil && [property isKindOfClass:aClass])
     {
+        _propertiesByPath[path] = property;
         return property;
     }
     return nil;
 }
 
+- (void)validatePathCaches
+{
+    uint64_t generation =
+        RiveViewModelInstancePathGeneration.load(std::memory_order_relaxed);
+    if (generation != _pathGeneration)
+    {
+        [_propertiesByPath removeAllObjects];
+        [_instancesByPath removeAllObjects];
+        _pathGeneration = generation;
+    }
+}
+
 #pragma mark - RiveDataBindingViewModelInstancePropertyDelegate
 
 - (void)valuePropertyDidAddListener:
     (RiveDataBindingViewModelInstanceProperty*)value
-{}
+{
+    [_observedProperties addObject:value];
+}
 
 - (void)valuePropertyDidRemoveListener:
             (RiveDataBindingViewModelInstanceProperty*)value
                                isEmpty:(BOOL)isEmpty
-{}
+{
+    if (isEmpty &&
+        ![value isKindOfClass:[RiveDataBindingViewModelInstanceListProperty
+                                  class]])
+    {
+        [_observedProperties removeObject:value];
+    }
+}
 
 #pragma mark - Paths
 
 - (nullable RiveDataBindingViewModelInstance*)parentForPath:(NSString*)path
 {
-    NSArray* pathComponents = [path pathComponents];
+    NSArray<NSString*>* pathComponents = [path pathComponents];
 
     if (pathComponents.count == 0)
     {
         return nil;
     }
 
-    if (pathComponents.count == 1)
+    // Walk every component but the last, which names the value itself.
+    RiveDataBindingViewModelInstance* instance = self;
+    for (NSUInteger i = 0; i + 1 < pathComponents.count && instance != nil;
+         i++)
     {
-        return self;
+        instance = [instance viewModelInstanceWithName:pathComponents[i]];
     }
-
-    NSArray* subpathComponents = [pathComponents
-        subarrayWithRange:NSMakeRange(1, pathComponents.count - 1)];
-    RiveDataBindingViewModelInstance* instance =
-        [self viewModelInstanceWithName:[pathComponents firstObject]];
-    return [instance
-        parentForPath:[subpathComponents componentsJoinedByString:@"/"]];
+    return instance;
 }
 
 - (nullable RiveDataBindingViewModelInstance*)viewModelInstanceWithName:
@@ -532,6 +616,8 @@
     if (replaced)
     {
         _children[name] = instance;
+        RiveViewModelInstancePathGeneration.fetch_add(
+            1, std::memory_order_relaxed);
     }
     return replaced;
 }
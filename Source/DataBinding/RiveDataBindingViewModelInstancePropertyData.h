@@ -32,7 +32,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 /// An object that represents the metadata of a view model instance property.
 NS_SWIFT_NAME(RiveDataBindingViewModelInstanceProperty.Data)
-@interface RiveDataBindingViewModelInstancePropertyData : NSObject
+@interface RiveDataBindingViewModelInstancePropertyData : NSObject <NSSecureCoding>
 
 /// The type of property within the view model instance.
 @property(nonatomic, readonly)
@@ -65,4 +65,34 @@ RiveDataBindingViewModelInstancePropertyDataTypeFromRuntime(rive::DataType type)
     return self;
 }
 
+#pragma mark - NSSecureCoding
+
++ (BOOL)supportsSecureCoding
+{
+    return YES;
+}
+
+- (void)encodeWithCoder:(NSCoder*)coder
+{
+    [coder encodeInteger:_type forKey:@"type"];
+    [coder encodeObject:_name forKey:@"name"];
+}
+
+- (nullable instancetype)initWithCoder:(NSCoder*)coder
+{
+    NSString* name = [coder decodeObjectOfClass:[NSString class]
+                                         forKey:@"name"];
+    if (name == nil)
+    {
+        return nil;
+    }
+    if (self = [super init])
+    {
+        _type = (RiveDataBindingViewModelInstancePropertyDataType)
+            [coder decodeIntegerForKey:@"type"];
+        _name = name;
+    }
+    return self;
+}
+
 @end
@@ -47,11 +47,16 @@ typedef NSArray<id<RiveFallbackFontProvider>>* _Nonnull (
 /// order in which they are added to the array.
 /// - Note: If unset, the default fallback is a default system font, with
 /// regular font weight.
+/// - Note: Resolved fallbacks are cached by font weight, fallback index and
+/// block of 128 codepoints. Setting this property or `fallbackFontsCallback`
+/// clears the cache.
 @property(class, copy, nonnull)
     NSArray<id<RiveFallbackFontProvider>>* fallbackFonts;
 /// A block that requests fallback font providers, given a font style.
 /// This way, different fallback fonts can be used depending on the styling
 /// of the font at draw-time (e.g weight).
+/// - Note: The block is called when a fallback is first resolved for a weight,
+/// fallback index and block of codepoints, not for every missing glyph.
 @property(class, nonatomic, copy, nonnull)
     RiveFallbackFontsCallback fallbackFontsCallback;
 @end
@@ -12,6 +12,8 @@
 #import <rive/text/utf.hpp>
 #import <RiveRuntime/RiveRuntime-Swift.h>
 #import <CoreText/CoreText.h>
+#include <mutex>
+#include <unordered_map>
 
 /// Returns a RiveFontStyleWeight for a given float value. Rounds to the nearest
 /// hundredth. These values mirror those found here:
@@ -107,17 +109,60 @@ static NSArray<id<RiveFallbackFontProvider>>* _fallbackFonts = nil;
 static RiveFallbackFontsCallback _fallbackFontsCallback = nil;
 
 #ifdef WITH_RIVE_TEXT
-static rive::rcp<rive::Font> findFallbackFont(const rive::Unichar missing,
-                                              const uint32_t fallbackIndex,
-                                              const rive::Font* font)
+/// A resolved fallback. The native font is kept to check that a font suggested
+/// for one codepoint also covers the others in its block.
+struct RiveFallbackFontCacheEntry
 {
-    // We know font is going to come back as an HBFont
-    const HBFont* hbFont = static_cast<const HBFont*>(font);
+    rive::rcp<rive::Font> font;
+    id nativeFont;
+    bool suggested;
+};
+
+/// Fallbacks resolved so far, keyed by RiveFallbackFontCacheKey. Shaping may
+/// run on any thread, so access is guarded by _fallbackFontCacheMutex.
+static std::unordered_map<uint64_t, RiveFallbackFontCacheEntry>
+    _fallbackFontCache;
+static std::mutex _fallbackFontCacheMutex;
+
+/// Codepoints are grouped in blocks of 128, which keeps characters of the same
+/// script (and emoji of the same range) together.
+static uint64_t RiveFallbackFontCacheKey(float weight,
+                                         uint32_t fallbackIndex,
+                                         rive::Unichar missing)
+{
+    uint64_t weightKey = (uint64_t)MIN(MAX(lroundf(weight), 0), 0xFFFF);
+    uint64_t indexKey = (uint64_t)MIN(fallbackIndex, (uint32_t)0xFFFF);
+    uint64_t blockKey = (uint64_t)(missing >> 7);
+    return (weightKey << 48) | (indexKey << 32) | blockKey;
+}
+
+static void RiveFallbackFontCacheReset()
+{
+    std::lock_guard<std::mutex> lock(_fallbackFontCacheMutex);
+    _fallbackFontCache.clear();
+}
 
+/// Returns whether a native font has a glyph for a codepoint.
+static BOOL RiveNativeFontCoversCodepoint(id nativeFont, rive::Unichar missing)
+{
+    uint16_t utf16[2];
+    int utf16Count = rive::UTF::ToUTF16(missing, utf16);
+    CGGlyph glyphs[2] = {0, 0};
+    return CTFontGetGlyphsForCharacters((__bridge CTFontRef)nativeFont,
+                                        (const UniChar*)utf16,
+                                        glyphs,
+                                        utf16Count);
+}
+
+static rive::rcp<rive::Font> resolveFallbackFont(const rive::Unichar missing,
+                                                 const uint32_t fallbackIndex,
+                                                 float weight,
+                                                 id* nativeFont,
+                                                 bool* suggested)
+{
     // Generate a style that will be used to request a cached font, or otherwise
     // user-specified font.
-    float value = hbFont->getWeight();
-    RiveFontStyle* style = [[RiveFontStyle alloc] initWithRawWeight:value];
+    RiveFontStyle* style = [[RiveFontStyle alloc] initWithRawWeight:weight];
 
     // Otherwise, request possible fallback providers based on the missing
     // character and style. fallbackFontsCallback will always be non-nil,
@@ -163,6 +208,7 @@ static rive::rcp<rive::Font> findFallbackFont(const rive::Unichar missing,
                     if (suggestedFont)
                     {
                         fallbackFont = suggestedFont;
+                        *suggested = true;
                     }
                 }
             }
@@ -173,11 +219,45 @@ static rive::rcp<rive::Font> findFallbackFont(const rive::Unichar missing,
         BOOL usesSystemShaper = fallbackIndex >= providers.count;
         auto riveFont = [RiveFont fontFromNativeFont:fallbackFont
                                      useSystemShaper:usesSystemShaper];
+        *nativeFont = fallbackFont;
         return rive::rcp<rive::Font>(riveFont);
     }
 
     return nullptr;
 }
+
+static rive::rcp<rive::Font> findFallbackFont(const rive::Unichar missing,
+                                              const uint32_t fallbackIndex,
+                                              const rive::Font* font)
+{
+    // We know font is going to come back as an HBFont
+    const HBFont* hbFont = static_cast<const HBFont*>(font);
+    float weight = hbFont->getWeight();
+    uint64_t key = RiveFallbackFontCacheKey(weight, fallbackIndex, missing);
+
+    {
+        std::lock_guard<std::mutex> lock(_fallbackFontCacheMutex);
+        auto cached = _fallbackFontCache.find(key);
+        // A suggested font is only reused for codepoints it covers; another
+        // codepoint in the same block may need a different suggestion.
+        if (cached != _fallbackFontCache.end() &&
+            (!cached->second.suggested ||
+             RiveNativeFontCoversCodepoint(cached->second.nativeFont, missing)))
+        {
+            return cached->second.font;
+        }
+    }
+
+    // Resolve outside of the lock, since providers run user code.
+    id nativeFont = nil;
+    bool suggested = false;
+    auto resolved = resolveFallbackFont(
+        missing, fallbackIndex, weight, &nativeFont, &suggested);
+
+    std::lock_guard<std::mutex> lock(_fallbackFontCacheMutex);
+    _fallbackFontCache[key] = {resolved, nativeFont, suggested};
+    return resolved;
+}
 #endif
 
 @implementation RiveFont
@@ -261,6 +341,7 @@ static rive::rcp<rive::Font> findFallbackFont(const rive::Unichar missing,
 
     // "Reset" fallback fonts callback so that array can take priority
     _fallbackFontsCallback = nil;
+    RiveFallbackFontCacheReset();
 #endif
 }
 
@@ -272,6 +353,17 @@ static rive::rcp<rive::Font> findFallbackFont(const rive::Unichar missing,
 
     // "Reset" fallback fonts array so that callback can take priority
     _fallbackFonts = nil;
+    RiveFallbackFontCacheReset();
+#endif
+}
+
++ (NSUInteger)cachedFallbackFontCount
+{
+#ifdef WITH_RIVE_TEXT
+    std::lock_guard<std::mutex> lock(_fallbackFontCacheMutex);
+    return _fallbackFontCache.size();
+#else
+    return 0;
 #endif
 }
 
@@ -9,31 +9,39 @@
 #import <RiveFileAsset.h>
 #import <RiveFactory.h>
 #import <CDNFileAssetLoader.h>
+#import <RiveCDNAssetCache.h>
 #import <RiveRuntime/RiveRuntime-Swift.h>
 
 @implementation CDNFileAssetLoader
 {
-    NSMutableArray<NSURLSessionTask*>* _activeTasks;
+    RiveCDNAssetCache* _cache;
+    NSMutableArray<RiveCDNAssetRequest*>* _activeRequests;
 }
 
 - (instancetype)init
+{
+    return [self initWithCache:[RiveCDNAssetCache shared]];
+}
+
+- (instancetype)initWithCache:(RiveCDNAssetCache*)cache
 {
     if (self = [super init])
     {
-        _activeTasks = [NSMutableArray array];
+        _cache = cache;
+        _activeRequests = [NSMutableArray array];
     }
     return self;
 }
 
 - (void)cancel
 {
-    @synchronized(_activeTasks)
+    @synchronized(_activeRequests)
     {
-        for (NSURLSessionTask* task in _activeTasks)
+        for (RiveCDNAssetRequest* request in _activeRequests)
         {
-            [task cancel];
+            [request cancel];
         }
-        [_activeTasks removeAllObjects];
+        [_activeRequests removeAllObjects];
     }
 }
 
@@ -52,57 +60,62 @@
             [NSURL URLWithString:[NSString stringWithFormat:@"%@/%@",
                                                             [asset cdnBaseUrl],
                                                             [asset cdnUuid]]];
-        __block NSURLSessionTask* task = nil;
-        task = [[NSURLSession sharedSession]
-            downloadTaskWithURL:URL
-              completionHandler:^(
-                  NSURL* location, NSURLResponse* response, NSError* error) {
-                if (error.code == NSURLErrorCancelled)
-                {
-                    [RiveLogger logCancelledAssetDownload:asset fromURL:URL];
-                    return;
-                }
-
-                if (!error)
-                {
-                    NSData* data = [NSData dataWithContentsOfURL:location];
-
+        __block RiveCDNAssetRequest* request = nil;
+        __weak CDNFileAssetLoader* weakSelf = self;
+        RiveCDNAssetCompletion completion = ^(NSData* data, NSError* error) {
+          if (error.code == NSURLErrorCancelled)
+          {
+              [RiveLogger logCancelledAssetDownload:asset fromURL:URL];
+              return;
+          }
+
+          if (!error)
+          {
 #ifdef WITH_RIVE_TEXT
-                    if ([asset isKindOfClass:[RiveFontAsset class]])
-                    {
-                        RiveFontAsset* fontAsset = (RiveFontAsset*)asset;
-                        [fontAsset font:[factory decodeFont:data]];
-                        [RiveLogger logFontAssetLoad:fontAsset fromURL:URL];
-                    }
+              if ([asset isKindOfClass:[RiveFontAsset class]])
+              {
+                  RiveFontAsset* fontAsset = (RiveFontAsset*)asset;
+                  [fontAsset font:[factory decodeFont:data]];
+                  [RiveLogger logFontAssetLoad:fontAsset fromURL:URL];
+              }
 #endif
-                    if ([asset isKindOfClass:[RiveImageAsset class]])
-                    {
-                        RiveImageAsset* imageAsset = (RiveImageAsset*)asset;
-                        [imageAsset renderImage:[factory decodeImage:data]];
-                        [RiveLogger logImageAssetLoad:imageAsset fromURL:URL];
-                    }
-                }
-                else
-                {
-                    NSString* message =
-                        [NSString stringWithFormat:
-                                      @"Failed to load asset from URL %@: %@",
-                                      URL.absoluteString,
-                                      error.localizedDescription];
-                    [RiveLogger logFile:nil error:message];
-                }
-
-                @synchronized(self->_activeTasks)
-                {
-                    [self->_activeTasks removeObject:task];
-                }
-              }];
-
-        @synchronized(_activeTasks)
+              if ([asset isKindOfClass:[RiveImageAsset class]])
+              {
+                  RiveImageAsset* imageAsset = (RiveImageAsset*)asset;
+                  [imageAsset renderImage:[factory decodeImage:data]];
+                  [RiveLogger logImageAssetLoad:imageAsset fromURL:URL];
+              }
+          }
+          else
+          {
+              NSString* message =
+                  [NSString stringWithFormat:
+                                @"Failed to load asset from URL %@: %@",
+                                URL.absoluteString,
+                                error.localizedDescription];
+              [RiveLogger logFile:nil error:message];
+          }
+
+          CDNFileAssetLoader* loader = weakSelf;
+          if (loader != nil)
+          {
+              @synchronized(loader->_activeRequests)
+              {
+                  [loader->_activeRequests removeObject:request];
+              }
+          }
+        };
+
+        // The completion may run before the fetch returns, e.g. on a cache
+        // hit, and removes the request under the same lock. Holding the lock
+        // until the request is added keeps the removal after the add.
+        @synchronized(_activeRequests)
         {
-            [_activeTasks addObject:task];
+            request = [_cache fetchAssetWithUUID:[asset cdnUuid]
+                                             url:URL
+                                      completion:completion];
+            [_activeRequests addObject:request];
         }
-        [task resume];
         return true;
     }
 
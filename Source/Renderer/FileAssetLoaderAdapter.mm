@@ -22,8 +22,20 @@ bool rive::FileAssetLoaderAdapter::loadContents(rive::FileAsset& asset,
                                                 rive::Span<const uint8_t> bytes,
                                                 rive::Factory* factory)
 {
-    NSData* data = [NSData dataWithBytes:bytes.data() length:bytes.size()];
-    RiveFactory* myFactory = [[RiveFactory alloc] initWithFactory:factory];
+    // The bytes are owned by the file being imported, and are only valid for
+    // the duration of this call, so they are not copied. Loaders that need
+    // them afterwards must copy them.
+    NSData* data = bytes.size() == 0
+                       ? [NSData data]
+                       : [NSData dataWithBytesNoCopy:(void*)bytes.data()
+                                              length:bytes.size()
+                                        freeWhenDone:NO];
+    if (factory != wrappedFactoryPtr || wrappedFactory == nil)
+    {
+        wrappedFactory = [[RiveFactory alloc] initWithFactory:factory];
+        wrappedFactoryPtr = factory;
+    }
+    RiveFactory* myFactory = wrappedFactory;
 #ifdef WITH_RIVE_TEXT
     if (asset.is<rive::FontAsset>())
     {
@@ -15,6 +15,8 @@
 #include "cg_renderer.hpp"
 #include "rive/renderer/gpu.hpp"
 
+#include <vector>
+
 // Values taken from Page 7 of
 // https://developer.apple.com/metal/Metal-Feature-Set-Tables.pdf
 // Last updated 10/2024
@@ -125,6 +127,14 @@ static CGSize Maximum2DTextureSizeFromDevice(id<MTLDevice> device)
     return CGSizeZero;
 }
 
+- (RenderContextBufferRingStats)bufferRingStats
+{
+    return {};
+}
+
+- (void)resetBufferRingStats
+{}
+
 @end
 
 #include "rive/renderer/metal/render_context_metal_impl.h"
@@ -248,32 +258,44 @@ static std::unique_ptr<rive::gpu::RenderContext> make_pls_context_native(
 
 @end
 
-@interface CGRendererContext : RenderContext
-- (rive::Renderer*)beginFrame:(id<RiveMetalDrawableView>)view;
-@end
-
-constexpr static int kBufferRingSize = 3;
+constexpr static NSUInteger kDefaultBufferRingSize = 3;
 
 @implementation CGRendererContext
 {
     id<MTLTexture> _renderTargetTexture;
-    id<MTLBuffer> _buffers[kBufferRingSize];
-    int _currentBufferIdx;
+    // Buffers are owned by the CPU until their blit is committed, and by the
+    // GPU until the command buffer that reads them completes. The semaphore
+    // counts the buffers currently owned by the CPU.
+    std::vector<id<MTLBuffer>> _buffers;
+    dispatch_semaphore_t _freeBuffers;
+    BOOL _blockingAcquire;
+    BOOL _hasAcquiredBuffer;
+    NSUInteger _currentBufferIdx;
+    RenderContextBufferRingStats _stats;
     AutoCF<CGContextRef> _cgContext;
     std::unique_ptr<rive::CGRenderer> _renderer;
     CGSize _maximum2DTextureSize;
 }
 
 - (instancetype)init
+{
+    return [self initWithBufferRingDepth:kDefaultBufferRingSize
+                         blockingAcquire:YES];
+}
+
+- (instancetype)initWithBufferRingDepth:(NSUInteger)depth
+                        blockingAcquire:(BOOL)blocking
 {
     self = [super init];
 
+    depth = MAX(depth, (NSUInteger)1);
     _renderTargetTexture = nil;
-    for (int i = 0; i < kBufferRingSize; ++i)
-    {
-        _buffers[i] = nil;
-    }
-    _currentBufferIdx = -1;
+    _buffers.resize(depth, nil);
+    _freeBuffers = dispatch_semaphore_create(depth);
+    _blockingAcquire = blocking;
+    _hasAcquiredBuffer = NO;
+    _currentBufferIdx = 0;
+    _stats = {};
 
     static id<MTLDevice> s_plsGPU = MTLCreateSystemDefaultDevice();
     self.metalDevice = s_plsGPU;
@@ -290,6 +312,83 @@ constexpr static int kBufferRingSize = 3;
     return self;
 }
 
+- (void)dealloc
+{
+    // libdispatch traps if a semaphore is released while its value is below
+    // the value it was created with, so hand back any buffer still held by
+    // the CPU. Buffers held by the GPU are released by their completion
+    // handlers, which retain the semaphore.
+    if (_hasAcquiredBuffer)
+    {
+        [self releaseBuffer];
+    }
+}
+
+- (BOOL)acquireBuffer
+{
+    if (dispatch_semaphore_wait(_freeBuffers, DISPATCH_TIME_NOW) == 0)
+    {
+        @synchronized(self)
+        {
+            _stats.acquireCount++;
+        }
+        return YES;
+    }
+
+    if (!_blockingAcquire)
+    {
+        @synchronized(self)
+        {
+            _stats.skipCount++;
+        }
+        return NO;
+    }
+
+    CFTimeInterval start = CACurrentMediaTime();
+    dispatch_semaphore_wait(_freeBuffers, DISPATCH_TIME_FOREVER);
+    NSTimeInterval waited = CACurrentMediaTime() - start;
+    @synchronized(self)
+    {
+        _stats.acquireCount++;
+        _stats.waitCount++;
+        _stats.totalWaitTime += waited;
+        _stats.maxWaitTime = MAX(_stats.maxWaitTime, waited);
+    }
+    return YES;
+}
+
+- (void)releaseBuffer
+{
+    dispatch_semaphore_signal(_freeBuffers);
+}
+
+- (void)releaseBufferOnCompletionOfCommandBuffer:
+    (id<MTLCommandBuffer>)commandBuffer
+{
+    // Capture the semaphore rather than self so that the context can be
+    // released while frames are still in flight.
+    dispatch_semaphore_t freeBuffers = _freeBuffers;
+    [commandBuffer addCompletedHandler:^(id<MTLCommandBuffer> buffer) {
+      dispatch_semaphore_signal(freeBuffers);
+    }];
+}
+
+- (RenderContextBufferRingStats)bufferRingStats
+{
+    @synchronized(self)
+    {
+        return _stats;
+    }
+}
+
+- (void)resetBufferRingStats
+{
+    @synchronized(self)
+    {
+        _stats = {};
+    }
+}
+
 - (rive::Factory*)factory
 {
     static rive::CGFactory factory;
@@ -322,7 +421,16 @@ constexpr static int kBufferRingSize = 3;
         return nullptr;
     }
 
-    _currentBufferIdx = (_currentBufferIdx + 1) % kBufferRingSize;
+    if (![self acquireBuffer])
+    {
+        _renderTargetTexture = nil;
+        return nullptr;
+    }
+    _hasAcquiredBuffer = YES;
+
+    // Buffers are released in the order their command buffers were committed,
+    // and the ring only advances past a buffer once its blit is committed, so
+    // the current buffer is always the one that was just released.
     size_t bufferSize =
         _renderTargetTexture.height * _renderTargetTexture.width * 4;
     if (_buffers[_currentBufferIdx] == nil ||
@@ -353,6 +461,9 @@ constexpr static int kBufferRingSize = 3;
     if (_cgContext != nil)
     {
         id<MTLCommandBuffer> commandBuffer = [self.metalQueue commandBuffer];
+        // Hand the buffer back to the CPU once the blit that reads it has
+        // finished.
+        [self releaseBufferOnCompletionOfCommandBuffer:commandBuffer];
         id<MTLBlitCommandEncoder> blitEncoder =
             [commandBuffer blitCommandEncoder];
         [blitEncoder copyFromBuffer:_buffers[_currentBufferIdx]
@@ -375,7 +486,15 @@ constexpr static int kBufferRingSize = 3;
             [commandBuffer addCompletedHandler:completionHandler];
         }
         [commandBuffer commit];
+        _currentBufferIdx = (_currentBufferIdx + 1) % _buffers.size();
+    }
+    else if (_hasAcquiredBuffer)
+    {
+        // Nothing was committed that reads the buffer, so it never left the
+        // CPU and the next frame reuses it.
+        [self releaseBuffer];
     }
+    _hasAcquiredBuffer = NO;
     _renderTargetTexture = nil;
     _renderer = nullptr;
     _cgContext = nullptr;
@@ -434,4 +553,11 @@ constexpr static int kBufferRingSize = 3;
     return [[RiveRendererContext alloc] init];
 }
 
+- (RenderContext*)newCGContextWithBufferRingDepth:(NSUInteger)depth
+                                 blockingAcquire:(BOOL)blocking
+{
+    return [[CGRendererContext alloc] initWithBufferRingDepth:depth
+                                              blockingAcquire:blocking];
+}
+
 @end
@@ -133,14 +133,18 @@ static int artInstanceCount = 0;
 
 - (NSArray*)animationNames
 {
+    // Read names from the animation definitions, rather than instancing each
+    // animation just to read its name.
     NSMutableArray* animationNames = [NSMutableArray array];
     for (NSUInteger i = 0; i < [self animationCount]; i++)
     {
-        RiveLinearAnimationInstance* animation = [self animationFromIndex:i
-                                                                    error:nil];
-        if (animation != nil)
+        auto animation = _artboardInstance->animation(i);
+        if (animation != nullptr)
         {
-            [animationNames addObject:[animation name]];
+            [animationNames
+                addObject:[NSString
+                              stringWithCString:animation->name().c_str()
+                                       encoding:NSUTF8StringEncoding]];
         }
     }
     return animationNames;
@@ -215,14 +219,18 @@ static int artInstanceCount = 0;
 
 - (NSArray*)stateMachineNames
 {
+    // Read names from the state machine definitions, rather than instancing
+    // each state machine just to read its name.
     NSMutableArray* stateMachineNames = [NSMutableArray array];
     for (NSUInteger i = 0; i < [self stateMachineCount]; i++)
     {
-        RiveStateMachineInstance* stateMachine =
-            [self stateMachineFromIndex:i error:nil];
-        if (stateMachine != nil)
+        auto stateMachine = _artboardInstance->stateMachine(i);
+        if (stateMachine != nullptr)
         {
-            [stateMachineNames addObject:[stateMachine name]];
+            [stateMachineNames
+                addObject:[NSString
+                              stringWithCString:stateMachine->name().c_str()
+                                       encoding:NSUTF8StringEncoding]];
         }
     }
     return stateMachineNames;
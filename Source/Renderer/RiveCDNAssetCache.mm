@@ -0,0 +1,705 @@
+//
+//  RiveCDNAssetCache.mm
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#import <Rive.h>
+#import <RivePrivateHeaders.h>
+#import <RiveCDNAssetCache.h>
+#import <RiveRuntime/RiveRuntime-Swift.h>
+
+constexpr static NSUInteger kDefaultMaximumConcurrentDownloads = 4;
+constexpr static NSUInteger kDefaultDiskBudget = 64 * 1024 * 1024;
+constexpr static NSTimeInterval kDefaultRevalidationInterval = 24 * 60 * 60;
+// How long access times are held in memory before being saved together.
+constexpr static NSTimeInterval kAccessSaveDelay = 5;
+
+static NSString* const kAssetExtension = @"asset";
+static NSString* const kInfoExtension = @"plist";
+
+/// What is known about a cached asset. Persisted next to the asset.
+@interface RiveCDNAssetCacheEntry : NSObject
+@property(nonatomic, copy) NSString* name;
+@property(nonatomic) NSUInteger byteCount;
+@property(nonatomic) NSDate* lastAccess;
+@property(nonatomic) NSDate* validatedAt;
+@property(nonatomic, copy, nullable) NSString* etag;
+@property(nonatomic, copy, nullable) NSString* lastModified;
+@end
+
+@implementation RiveCDNAssetCacheEntry
+
+- (NSDictionary*)dictionaryRepresentation
+{
+    NSMutableDictionary* dictionary = [@{
+        @"byteCount" : @(_byteCount),
+        @"lastAccess" : _lastAccess,
+        @"validatedAt" : _validatedAt,
+    } mutableCopy];
+    dictionary[@"etag"] = _etag;
+    dictionary[@"lastModified"] = _lastModified;
+    return dictionary;
+}
+
++ (nullable instancetype)entryWithName:(NSString*)name
+                            dictionary:(NSDictionary*)dictionary
+{
+    NSNumber* byteCount = dictionary[@"byteCount"];
+    NSDate* lastAccess = dictionary[@"lastAccess"];
+    NSDate* validatedAt = dictionary[@"validatedAt"];
+    if (![byteCount isKindOfClass:[NSNumber class]] ||
+        ![lastAccess isKindOfClass:[NSDate class]] ||
+        ![validatedAt isKindOfClass:[NSDate class]])
+    {
+        return nil;
+    }
+    RiveCDNAssetCacheEntry* entry = [[RiveCDNAssetCacheEntry alloc] init];
+    entry.name = name;
+    entry.byteCount = byteCount.unsignedIntegerValue;
+    entry.lastAccess = lastAccess;
+    entry.validatedAt = validatedAt;
+    entry.etag = dictionary[@"etag"];
+    entry.lastModified = dictionary[@"lastModified"];
+    return entry;
+}
+
+@end
+
+/// A fetch of one asset, shared by every request for its UUID.
+@interface RiveCDNAssetFetch : NSObject
+@property(nonatomic, copy) NSString* name;
+@property(nonatomic) NSURL* url;
+@property(nonatomic) NSMutableArray<RiveCDNAssetRequest*>* requests;
+@property(nonatomic, nullable) NSURLSessionDataTask* task;
+@end
+
+@implementation RiveCDNAssetFetch
+@end
+
+@interface RiveCDNAssetRequest ()
+@property(nonatomic, weak) RiveCDNAssetCache* cache;
+@property(nonatomic, copy, nullable) RiveCDNAssetCompletion completion;
+@property(nonatomic, weak) RiveCDNAssetFetch* fetch;
+@end
+
+@interface RiveCDNAssetCache ()
+- (void)cancelRequest:(RiveCDNAssetRequest*)request;
+@end
+
+@implementation RiveCDNAssetRequest
+
+- (instancetype)initWithCache:(RiveCDNAssetCache*)cache
+                   completion:(RiveCDNAssetCompletion)completion
+{
+    if (self = [super init])
+    {
+        _cache = cache;
+        _completion = [completion copy];
+    }
+    return self;
+}
+
+- (void)cancel
+{
+    [_cache cancelRequest:self];
+}
+
+@end
+
+@implementation RiveCDNAssetCache
+{
+    NSURLSession* _session;
+    // Guards every ivar below, and all access to the directory.
+    dispatch_queue_t _queue;
+    // Loaded from the directory on first use.
+    NSMutableDictionary<NSString*, RiveCDNAssetCacheEntry*>* _entries;
+    NSMutableDictionary<NSString*, RiveCDNAssetFetch*>* _fetches;
+    NSMutableArray<RiveCDNAssetFetch*>* _pendingFetches;
+    NSUInteger _activeDownloadCount;
+    // Entries whose access time changed since their info was last saved.
+    NSMutableSet<RiveCDNAssetCacheEntry*>* _unsavedEntries;
+    BOOL _isSaveScheduled;
+    NSUInteger _maximumConcurrentDownloads;
+    NSUInteger _diskBudget;
+    NSTimeInterval _revalidationInterval;
+    NSUInteger _totalByteCount;
+    NSUInteger _hitCount;
+    NSUInteger _revalidationCount;
+    NSUInteger _downloadCount;
+    NSUInteger _coalescedCount;
+}
+
++ (RiveCDNAssetCache*)shared
+{
+    static RiveCDNAssetCache* shared = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+      NSURL* caches = [[NSFileManager defaultManager]
+                          URLsForDirectory:NSCachesDirectory
+                                 inDomains:NSUserDomainMask]
+                          .firstObject;
+      shared = [[RiveCDNAssetCache alloc]
+          initWithDirectoryURL:[caches URLByAppendingPathComponent:
+                                           @"app.rive.cdn-assets"
+                                                       isDirectory:YES]
+          sessionConfiguration:[NSURLSessionConfiguration
+                                   defaultSessionConfiguration]];
+    });
+    return shared;
+}
+
+- (instancetype)initWithDirectoryURL:(NSURL*)directoryURL
+                sessionConfiguration:
+                    (NSURLSessionConfiguration*)sessionConfiguration
+{
+    if (self = [super init])
+    {
+        _directoryURL = directoryURL;
+        _maximumConcurrentDownloads = kDefaultMaximumConcurrentDownloads;
+        _diskBudget = kDefaultDiskBudget;
+        _revalidationInterval = kDefaultRevalidationInterval;
+
+        // Assets are cached here, so the session should not cache them too.
+        NSURLSessionConfiguration* configuration = [sessionConfiguration copy];
+        configuration.URLCache = nil;
+        configuration.requestCachePolicy =
+            NSURLRequestReloadIgnoringLocalCacheData;
+        _session = [NSURLSession sessionWithConfiguration:configuration];
+
+        _queue = dispatch_queue_create(
+            "app.rive.cdn-asset-cache",
+            dispatch_queue_attr_make_with_qos_class(
+                DISPATCH_QUEUE_SERIAL, QOS_CLASS_USER_INITIATED, -1));
+        _fetches = [NSMutableDictionary dictionary];
+        _pendingFetches = [NSMutableArray array];
+        _unsavedEntries = [NSMutableSet set];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [_session invalidateAndCancel];
+    // Nothing else can reach the cache any more, so save without the queue.
+    [self saveUnsavedEntries];
+}
+
+#pragma mark - Configuration
+
+- (NSUInteger)maximumConcurrentDownloads
+{
+    return [self readOnQueue:^NSUInteger {
+      return self->_maximumConcurrentDownloads;
+    }];
+}
+
+- (void)setMaximumConcurrentDownloads:(NSUInteger)maximumConcurrentDownloads
+{
+    dispatch_async(_queue, ^{
+      self->_maximumConcurrentDownloads = maximumConcurrentDownloads;
+      [self startPendingFetches];
+    });
+}
+
+- (NSUInteger)diskBudget
+{
+    return [self readOnQueue:^NSUInteger {
+      return self->_diskBudget;
+    }];
+}
+
+- (void)setDiskBudget:(NSUInteger)diskBudget
+{
+    dispatch_async(_queue, ^{
+      self->_diskBudget = diskBudget;
+    });
+}
+
+- (NSTimeInterval)revalidationInterval
+{
+    __block NSTimeInterval value = 0;
+    dispatch_sync(_queue, ^{
+      value = self->_revalidationInterval;
+    });
+    return value;
+}
+
+- (void)setRevalidationInterval:(NSTimeInterval)revalidationInterval
+{
+    dispatch_async(_queue, ^{
+      self->_revalidationInterval = revalidationInterval;
+    });
+}
+
+#pragma mark - Statistics
+
+- (NSUInteger)readOnQueue:(NSUInteger (^)(void))block
+{
+    __block NSUInteger value = 0;
+    dispatch_sync(_queue, ^{
+      value = block();
+    });
+    return value;
+}
+
+- (NSUInteger)totalByteCount
+{
+    return [self readOnQueue:^NSUInteger {
+      [self loadEntries];
+      return self->_totalByteCount;
+    }];
+}
+
+- (NSUInteger)hitCount
+{
+    return [self readOnQueue:^NSUInteger {
+      return self->_hitCount;
+    }];
+}
+
+- (NSUInteger)revalidationCount
+{
+    return [self readOnQueue:^NSUInteger {
+      return self->_revalidationCount;
+    }];
+}
+
+- (NSUInteger)downloadCount
+{
+    return [self readOnQueue:^NSUInteger {
+      return self->_downloadCount;
+    }];
+}
+
+- (NSUInteger)coalescedCount
+{
+    return [self readOnQueue:^NSUInteger {
+      return self->_coalescedCount;
+    }];
+}
+
+- (void)resetStatistics
+{
+    dispatch_sync(_queue, ^{
+      self->_hitCount = 0;
+      self->_revalidationCount = 0;
+      self->_downloadCount = 0;
+      self->_coalescedCount = 0;
+    });
+}
+
+#pragma mark - Disk
+
+/// Returns the file name used for a UUID. UUIDs are used as is when they are
+/// safe file names, and hashed otherwise.
++ (NSString*)fileNameForUUID:(NSString*)uuid
+{
+    static NSCharacterSet* unsafe = [[NSCharacterSet
+        characterSetWithCharactersInString:
+            @"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-"]
+        invertedSet];
+    if (uuid.length > 0 && uuid.length <= 128 &&
+        [uuid rangeOfCharacterFromSet:unsafe].location == NSNotFound)
+    {
+        return uuid;
+    }
+    NSData* data = [uuid dataUsingEncoding:NSUTF8StringEncoding];
+    return [RiveFileCache contentHashForBytes:(const uint8_t*)data.bytes
+                                       length:data.length];
+}
+
+- (NSURL*)URLForName:(NSString*)name extension:(NSString*)extension
+{
+    return [[_directoryURL URLByAppendingPathComponent:name]
+        URLByAppendingPathExtension:extension];
+}
+
+- (void)loadEntries
+{
+    if (_entries != nil)
+    {
+        return;
+    }
+    _entries = [NSMutableDictionary dictionary];
+    _totalByteCount = 0;
+    NSArray<NSURL*>* urls = [[NSFileManager defaultManager]
+          contentsOfDirectoryAtURL:_directoryURL
+        includingPropertiesForKeys:nil
+                           options:NSDirectoryEnumerationSkipsHiddenFiles
+                             error:nil];
+    for (NSURL* url in urls)
+    {
+        if (![url.pathExtension isEqualToString:kInfoExtension])
+        {
+            continue;
+        }
+        NSString* name = url.URLByDeletingPathExtension.lastPathComponent;
+        NSDictionary* dictionary =
+            [NSDictionary dictionaryWithContentsOfURL:url];
+        RiveCDNAssetCacheEntry* entry =
+            [RiveCDNAssetCacheEntry entryWithName:name dictionary:dictionary];
+        NSURL* assetURL = [self URLForName:name extension:kAssetExtension];
+        if (entry == nil ||
+            ![[NSFileManager defaultManager] fileExistsAtPath:assetURL.path])
+        {
+            [self removeEntryFilesForName:name];
+            continue;
+        }
+        _entries[name] = entry;
+        _totalByteCount += entry.byteCount;
+    }
+}
+
+- (void)writeInfoForEntry:(RiveCDNAssetCacheEntry*)entry
+{
+    [[entry dictionaryRepresentation]
+        writeToURL:[self URLForName:entry.name extension:kInfoExtension]
+             error:nil];
+}
+
+- (void)removeEntryFilesForName:(NSString*)name
+{
+    NSFileManager* fileManager = [NSFileManager defaultManager];
+    [fileManager removeItemAtURL:[self URLForName:name
+                                        extension:kAssetExtension]
+                           error:nil];
+    [fileManager removeItemAtURL:[self URLForName:name extension:kInfoExtension]
+                           error:nil];
+}
+
+- (void)removeEntry:(RiveCDNAssetCacheEntry*)entry
+{
+    [_unsavedEntries removeObject:entry];
+    [self removeEntryFilesForName:entry.name];
+    [_entries removeObjectForKey:entry.name];
+    _totalByteCount -= entry.byteCount;
+}
+
+/// Reads a cached asset and marks it as recently used. Removes the entry if
+/// its asset is missing. The access time is saved later, with others, so that
+/// a hit does not write to disk.
+- (nullable NSData*)readEntry:(RiveCDNAssetCacheEntry*)entry
+{
+    // Mapped, so that reading a large asset does not hold up the queue.
+    NSData* data = [NSData
+        dataWithContentsOfURL:[self URLForName:entry.name
+                                     extension:kAssetExtension]
+                      options:NSDataReadingMappedIfSafe
+                        error:nil];
+    if (data == nil)
+    {
+        [self removeEntry:entry];
+        return nil;
+    }
+    entry.lastAccess = [NSDate date];
+    [_unsavedEntries addObject:entry];
+    [self scheduleSave];
+    return data;
+}
+
+- (void)scheduleSave
+{
+    if (_isSaveScheduled)
+    {
+        return;
+    }
+    _isSaveScheduled = YES;
+    __weak RiveCDNAssetCache* weakSelf = self;
+    dispatch_after(
+        dispatch_time(DISPATCH_TIME_NOW,
+                      (int64_t)(kAccessSaveDelay * NSEC_PER_SEC)),
+        _queue,
+        ^{
+          RiveCDNAssetCache* cache = weakSelf;
+          if (cache != nil)
+          {
+              cache->_isSaveScheduled = NO;
+              [cache saveUnsavedEntries];
+          }
+        });
+}
+
+- (void)saveUnsavedEntries
+{
+    for (RiveCDNAssetCacheEntry* entry in _unsavedEntries)
+    {
+        [self writeInfoForEntry:entry];
+    }
+    [_unsavedEntries removeAllObjects];
+}
+
+- (void)storeData:(NSData*)data
+          forName:(NSString*)name
+         response:(NSHTTPURLResponse*)response
+{
+    RiveCDNAssetCacheEntry* existing = _entries[name];
+    if (existing != nil)
+    {
+        [self removeEntry:existing];
+    }
+    if (data.length > _diskBudget)
+    {
+        return;
+    }
+
+    [[NSFileManager defaultManager] createDirectoryAtURL:_directoryURL
+                             withIntermediateDirectories:YES
+                                              attributes:nil
+                                                   error:nil];
+    if (![data writeToURL:[self URLForName:name extension:kAssetExtension]
+                  options:NSDataWritingAtomic
+                    error:nil])
+    {
+        return;
+    }
+
+    RiveCDNAssetCacheEntry* entry = [[RiveCDNAssetCacheEntry alloc] init];
+    entry.name = name;
+    entry.byteCount = data.length;
+    entry.lastAccess = [NSDate date];
+    entry.validatedAt = entry.lastAccess;
+    entry.etag = [response valueForHTTPHeaderField:@"ETag"];
+    entry.lastModified = [response valueForHTTPHeaderField:@"Last-Modified"];
+    [self writeInfoForEntry:entry];
+    _entries[name] = entry;
+    _totalByteCount += entry.byteCount;
+    [self evictToBudgetKeeping:entry];
+}
+
+- (void)evictToBudgetKeeping:(RiveCDNAssetCacheEntry*)kept
+{
+    if (_totalByteCount <= _diskBudget)
+    {
+        return;
+    }
+    NSArray<RiveCDNAssetCacheEntry*>* entries = [_entries.allValues
+        sortedArrayUsingComparator:^NSComparisonResult(
+            RiveCDNAssetCacheEntry* a, RiveCDNAssetCacheEntry* b) {
+          return [a.lastAccess compare:b.lastAccess];
+        }];
+    for (RiveCDNAssetCacheEntry* entry in entries)
+    {
+        if (_totalByteCount <= _diskBudget)
+        {
+            break;
+        }
+        if (entry != kept)
+        {
+            [self removeEntry:entry];
+        }
+    }
+}
+
+- (void)removeAllAssets
+{
+    dispatch_sync(_queue, ^{
+      [self loadEntries];
+      for (RiveCDNAssetCacheEntry* entry in self->_entries.allValues)
+      {
+          [self removeEntry:entry];
+      }
+    });
+}
+
+#pragma mark - Fetching
+
+- (RiveCDNAssetRequest*)fetchAssetWithUUID:(NSString*)uuid
+                                       url:(NSURL*)url
+                                completion:(RiveCDNAssetCompletion)completion
+{
+    RiveCDNAssetRequest* request =
+        [[RiveCDNAssetRequest alloc] initWithCache:self completion:completion];
+    NSString* name = [RiveCDNAssetCache fileNameForUUID:uuid];
+    dispatch_async(_queue, ^{
+      RiveCDNAssetFetch* fetch = self->_fetches[name];
+      if (fetch != nil)
+      {
+          self->_coalescedCount++;
+          request.fetch = fetch;
+          [fetch.requests addObject:request];
+          return;
+      }
+
+      [self loadEntries];
+      RiveCDNAssetCacheEntry* entry = self->_entries[name];
+      if (entry != nil &&
+          -entry.validatedAt.timeIntervalSinceNow < self->_revalidationInterval)
+      {
+          NSData* data = [self readEntry:entry];
+          if (data != nil)
+          {
+              self->_hitCount++;
+              [self completeRequests:@[ request ] data:data error:nil];
+              return;
+          }
+      }
+
+      fetch = [[RiveCDNAssetFetch alloc] init];
+      fetch.name = name;
+      fetch.url = url;
+      fetch.requests = [NSMutableArray arrayWithObject:request];
+      request.fetch = fetch;
+      self->_fetches[name] = fetch;
+      [self->_pendingFetches addObject:fetch];
+      [self startPendingFetches];
+    });
+    return request;
+}
+
+- (void)startPendingFetches
+{
+    while (_activeDownloadCount < MAX(_maximumConcurrentDownloads, 1) &&
+           _pendingFetches.count > 0)
+    {
+        RiveCDNAssetFetch* fetch = _pendingFetches.firstObject;
+        [_pendingFetches removeObjectAtIndex:0];
+
+        NSMutableURLRequest* urlRequest =
+            [NSMutableURLRequest requestWithURL:fetch.url];
+        RiveCDNAssetCacheEntry* entry = _entries[fetch.name];
+        if (entry.etag != nil)
+        {
+            [urlRequest setValue:entry.etag forHTTPHeaderField:@"If-None-Match"];
+        }
+        if (entry.lastModified != nil)
+        {
+            [urlRequest setValue:entry.lastModified
+                forHTTPHeaderField:@"If-Modified-Since"];
+        }
+
+        __weak RiveCDNAssetCache* weakSelf = self;
+        fetch.task = [_session
+            dataTaskWithRequest:urlRequest
+              completionHandler:^(
+                  NSData* data, NSURLResponse* response, NSError* error) {
+                RiveCDNAssetCache* cache = weakSelf;
+                if (cache == nil)
+                {
+                    return;
+                }
+                dispatch_async(cache->_queue, ^{
+                  [cache finishFetch:fetch
+                                data:data
+                            response:(NSHTTPURLResponse*)response
+                               error:error];
+                });
+              }];
+        _activeDownloadCount++;
+        [fetch.task resume];
+    }
+}
+
+- (void)finishFetch:(RiveCDNAssetFetch*)fetch
+               data:(nullable NSData*)data
+           response:(nullable NSHTTPURLResponse*)response
+              error:(nullable NSError*)error
+{
+    _activeDownloadCount--;
+    [self startPendingFetches];
+    if (_fetches[fetch.name] == fetch)
+    {
+        [_fetches removeObjectForKey:fetch.name];
+    }
+    if (fetch.requests.count == 0)
+    {
+        // Every request was cancelled.
+        return;
+    }
+
+    NSInteger status = [response isKindOfClass:[NSHTTPURLResponse class]]
+                           ? response.statusCode
+                           : 0;
+    RiveCDNAssetCacheEntry* entry = _entries[fetch.name];
+    NSData* result = nil;
+    if (error == nil && status == 304 && entry != nil)
+    {
+        _revalidationCount++;
+        entry.validatedAt = [NSDate date];
+        [self writeInfoForEntry:entry];
+        result = [self readEntry:entry];
+    }
+    else if (error == nil && status >= 200 && status < 300 && data != nil)
+    {
+        _downloadCount++;
+        [self storeData:data forName:fetch.name response:response];
+        result = data;
+    }
+    else if (entry != nil)
+    {
+        // The CDN could not be reached; the cached asset is better than none.
+        result = [self readEntry:entry];
+    }
+
+    if (result == nil && error == nil)
+    {
+        error = [NSError
+            errorWithDomain:NSURLErrorDomain
+                       code:NSURLErrorBadServerResponse
+                   userInfo:@{
+                       NSLocalizedDescriptionKey : [NSString
+                           stringWithFormat:@"Unexpected status code %ld",
+                                            (long)status]
+                   }];
+    }
+    [self completeRequests:fetch.requests
+                      data:result
+                     error:result != nil ? nil : error];
+    [fetch.requests removeAllObjects];
+}
+
+- (void)cancelRequest:(RiveCDNAssetRequest*)request
+{
+    dispatch_async(_queue, ^{
+      RiveCDNAssetFetch* fetch = request.fetch;
+      if (request.completion == nil)
+      {
+          return;
+      }
+      [self completeRequests:@[ request ]
+                        data:nil
+                       error:[NSError errorWithDomain:NSURLErrorDomain
+                                                 code:NSURLErrorCancelled
+                                             userInfo:nil]];
+      if (fetch == nil)
+      {
+          return;
+      }
+      [fetch.requests removeObject:request];
+      if (fetch.requests.count > 0)
+      {
+          return;
+      }
+      [self->_fetches removeObjectForKey:fetch.name];
+      if (fetch.task != nil)
+      {
+          [fetch.task cancel];
+      }
+      else
+      {
+          [self->_pendingFetches removeObject:fetch];
+      }
+    });
+}
+
+/// Calls the completion of each request once, off the cache's queue.
+- (void)completeRequests:(NSArray<RiveCDNAssetRequest*>*)requests
+                    data:(nullable NSData*)data
+                   error:(nullable NSError*)error
+{
+    for (RiveCDNAssetRequest* request in requests)
+    {
+        RiveCDNAssetCompletion completion = request.completion;
+        request.completion = nil;
+        if (completion != nil)
+        {
+            dispatch_async(
+                dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+                  completion(data, error);
+                });
+        }
+    }
+}
+
+@end
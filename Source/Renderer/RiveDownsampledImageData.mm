@@ -0,0 +1,125 @@
+//
+//  RiveDownsampledImageData.mm
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#import <RiveDownsampledImageData.h>
+#import <ImageIO/ImageIO.h>
+
+#include <cmath>
+
+constexpr static NSUInteger kBytesPerPixel = 4;
+
+/// Returns the number of times an image can be halved while still covering
+/// the target size along every constrained axis.
+static int RiveDownsampleLevel(CGSize source, CGSize target)
+{
+    double ratio = INFINITY;
+    if (target.width > 0)
+    {
+        ratio = MIN(ratio, source.width / target.width);
+    }
+    if (target.height > 0)
+    {
+        ratio = MIN(ratio, source.height / target.height);
+    }
+    if (!std::isfinite(ratio) || ratio < 2)
+    {
+        return 0;
+    }
+    return (int)std::floor(std::log2(ratio));
+}
+
+@implementation RiveDownsampledImageData
+
+- (nullable instancetype)initWithData:(NSData*)data
+                     maximumPixelSize:(CGSize)maximumPixelSize
+{
+    NSDictionary* sourceOptions = @{
+        (__bridge NSString*)kCGImageSourceShouldCache : @NO,
+    };
+    CGImageSourceRef source = CGImageSourceCreateWithData(
+        (__bridge CFDataRef)data, (__bridge CFDictionaryRef)sourceOptions);
+    if (source == nil)
+    {
+        return nil;
+    }
+
+    // Reads the image header only.
+    NSDictionary* properties = CFBridgingRelease(
+        CGImageSourceCopyPropertiesAtIndex(source, 0, nil));
+    NSNumber* width = properties[(__bridge NSString*)kCGImagePropertyPixelWidth];
+    NSNumber* height =
+        properties[(__bridge NSString*)kCGImagePropertyPixelHeight];
+    if (width == nil || height == nil)
+    {
+        CFRelease(source);
+        return nil;
+    }
+
+    if (self = [super init])
+    {
+        _sourcePixelSize = CGSizeMake(width.doubleValue, height.doubleValue);
+        _pixelSize = _sourcePixelSize;
+        _data = data;
+
+        int level = RiveDownsampleLevel(_sourcePixelSize, maximumPixelSize);
+        NSData* reduced = level > 0 ? [self reduceSource:source level:level]
+                                    : nil;
+        if (reduced != nil)
+        {
+            _data = reduced;
+            NSUInteger sourcePixels =
+                (NSUInteger)(_sourcePixelSize.width * _sourcePixelSize.height);
+            NSUInteger pixels =
+                (NSUInteger)(_pixelSize.width * _pixelSize.height);
+            _savedCPUByteCount = (sourcePixels - pixels) * kBytesPerPixel;
+            // A full mipmap chain adds a third to the size of a texture.
+            _savedGPUByteCount = _savedCPUByteCount * 4 / 3;
+        }
+    }
+    CFRelease(source);
+    return self;
+}
+
+/// Decodes the image at 1/2^level of its size, and re-encodes it losslessly.
+- (nullable NSData*)reduceSource:(CGImageSourceRef)source level:(int)level
+{
+    CGFloat scale = std::ldexp(1.0, -level);
+    CGFloat maxPixelSize =
+        std::ceil(MAX(_sourcePixelSize.width, _sourcePixelSize.height) * scale);
+    NSDictionary* thumbnailOptions = @{
+        (__bridge NSString*)kCGImageSourceCreateThumbnailFromImageAlways : @YES,
+        (__bridge NSString*)kCGImageSourceThumbnailMaxPixelSize :
+            @(maxPixelSize),
+        (__bridge NSString*)kCGImageSourceCreateThumbnailWithTransform : @NO,
+        (__bridge NSString*)kCGImageSourceShouldCacheImmediately : @YES,
+    };
+    CGImageRef image = CGImageSourceCreateThumbnailAtIndex(
+        source, 0, (__bridge CFDictionaryRef)thumbnailOptions);
+    if (image == nil)
+    {
+        return nil;
+    }
+
+    NSMutableData* encoded = [NSMutableData data];
+    CGImageDestinationRef destination = CGImageDestinationCreateWithData(
+        (__bridge CFMutableDataRef)encoded, CFSTR("public.png"), 1, nil);
+    BOOL success = NO;
+    if (destination != nil)
+    {
+        CGImageDestinationAddImage(destination, image, nil);
+        success = CGImageDestinationFinalize(destination);
+        CFRelease(destination);
+    }
+    if (success)
+    {
+        _pixelSize = CGSizeMake(CGImageGetWidth(image), CGImageGetHeight(image));
+    }
+    CGImageRelease(image);
+    return success ? encoded : nil;
+}
+
+@end
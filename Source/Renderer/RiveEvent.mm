@@ -9,6 +9,12 @@
 #import <Rive.h>
 #import <RivePrivateHeaders.h>
 
+@interface RiveEvent ()
+/// For open URL events, their URL and target.
+- (NSString*)copiedUrl;
+- (uint32_t)targetValue;
+@end
+
 /*
  * RiveEvent
  */
@@ -16,6 +22,12 @@
 {
     const rive::Event* instance;
     float secondsDelay;
+    // Set instead of instance for events copied out of the runtime.
+    NSString* copiedName;
+    NSInteger copiedType;
+    NSDictionary<NSString*, id>* copiedProperties;
+    NSString* copiedUrl;
+    uint32_t copiedTargetValue;
 }
 
 - (const rive::Event*)getInstance
@@ -38,8 +50,50 @@
     }
 }
 
+- (instancetype)initWithName:(NSString*)name
+                        type:(NSInteger)type
+                       delay:(float)delay
+                  properties:(NSDictionary<NSString*, id>*)properties
+                         url:(NSString*)url
+                 targetValue:(uint32_t)targetValue
+{
+    if (self = [super init])
+    {
+        instance = nullptr;
+        secondsDelay = delay;
+        copiedName = [name copy];
+        copiedType = type;
+        copiedProperties = [properties copy];
+        copiedUrl = [url copy];
+        copiedTargetValue = targetValue;
+        return self;
+    }
+    else
+    {
+        return nil;
+    }
+}
+
+- (NSString*)copiedUrl
+{
+    return copiedUrl;
+}
+
+- (uint32_t)targetValue
+{
+    if (instance == nullptr)
+    {
+        return copiedTargetValue;
+    }
+    return ((const rive::OpenUrlEvent*)instance)->targetValue();
+}
+
 - (NSString*)name
 {
+    if (instance == nullptr)
+    {
+        return copiedName;
+    }
     std::string str = ((const rive::Event*)instance)->name();
     return [NSString stringWithCString:str.c_str()
                               encoding:[NSString defaultCStringEncoding]];
@@ -47,6 +101,10 @@
 
 - (NSInteger)type
 {
+    if (instance == nullptr)
+    {
+        return copiedType;
+    }
     return ((rive::Event*)[self getInstance])->coreType();
 }
 
@@ -57,6 +115,10 @@
 
 - (NSDictionary<NSString*, id>*)properties
 {
+    if (instance == nullptr)
+    {
+        return copiedProperties;
+    }
     bool hasCustomProperties = false;
     NSMutableDictionary<NSString*, id>* customProperties =
         [NSMutableDictionary dictionary];
@@ -125,6 +187,10 @@
 @implementation RiveOpenUrlEvent
 - (NSString*)url
 {
+    if ([self getInstance] == nullptr)
+    {
+        return [self copiedUrl];
+    }
     std::string str = ((const rive::OpenUrlEvent*)[self getInstance])->url();
     return [NSString stringWithCString:str.c_str()
                               encoding:[NSString defaultCStringEncoding]];
@@ -132,8 +198,7 @@
 
 - (NSString*)target
 {
-    uint32_t targetValue =
-        ((const rive::OpenUrlEvent*)[self getInstance])->targetValue();
+    uint32_t targetValue = [self targetValue];
     std::string targetString;
     switch (targetValue)
     {
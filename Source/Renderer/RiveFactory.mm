@@ -11,6 +11,14 @@
 #import <RiveFactory.h>
 #import <RiveRuntime/RiveRuntime-Swift.h>
 #import <RenderContext.h>
+#import <RiveDownsampledImageData.h>
+
+@interface RiveRenderImage ()
+@property(nonatomic, readwrite) CGSize pixelSize;
+@property(nonatomic, readwrite) CGSize sourcePixelSize;
+@property(nonatomic, readwrite) NSUInteger savedCPUByteCount;
+@property(nonatomic, readwrite) NSUInteger savedGPUByteCount;
+@end
 
 @implementation RiveRenderImage
 {
@@ -106,6 +114,25 @@
                           rive::Span<const uint8_t>(bytes, [data length]))];
 }
 
+- (RiveRenderImage*)decodeImage:(NSData*)data
+               maximumPixelSize:(CGSize)maximumPixelSize
+{
+    RiveDownsampledImageData* downsampled =
+        [[RiveDownsampledImageData alloc] initWithData:data
+                                      maximumPixelSize:maximumPixelSize];
+    if (downsampled == nil)
+    {
+        // Not an image ImageIO understands; the factory may still decode it.
+        return [self decodeImage:data];
+    }
+    RiveRenderImage* image = [self decodeImage:downsampled.data];
+    image.pixelSize = downsampled.pixelSize;
+    image.sourcePixelSize = downsampled.sourcePixelSize;
+    image.savedCPUByteCount = downsampled.savedCPUByteCount;
+    image.savedGPUByteCount = downsampled.savedGPUByteCount;
+    return image;
+}
+
 - (RiveFont*)decodeFont:(nonnull NSData*)data
 {
     UInt8* bytes = (UInt8*)[data bytes];
@@ -16,6 +16,58 @@
 
 #import <FileAssetLoaderAdapter.hpp>
 
+#include <atomic>
+
+@interface RiveFileImportTask ()
+- (void)deliverFile:(nullable RiveFile*)file
+              error:(nullable NSError*)error
+         completion:(RiveFileImportCompletion)completion;
+@end
+
+/*
+ * RiveFileImportTask
+ */
+@implementation RiveFileImportTask
+{
+    std::atomic<bool> _cancelled;
+}
+
+- (instancetype)init
+{
+    if (self = [super init])
+    {
+        _cancelled = false;
+    }
+    return self;
+}
+
+- (BOOL)isCancelled
+{
+    return _cancelled.load();
+}
+
+- (void)cancel
+{
+    _cancelled = true;
+}
+
+/// Delivers the result of the import on the main queue, unless the task has
+/// been cancelled by the time the main queue gets to it.
+- (void)deliverFile:(nullable RiveFile*)file
+              error:(nullable NSError*)error
+         completion:(RiveFileImportCompletion)completion
+{
+    dispatch_async(dispatch_get_main_queue(), ^{
+      if (self.isCancelled)
+      {
+          return;
+      }
+      completion(file, error);
+    });
+}
+
+@end
+
 /*
  * RiveFile
  */
@@ -25,6 +77,12 @@
     rive::rcp<rive::FileAssetLoader> fileAssetLoader;
     RenderContext* _renderContext;
     FallbackFileAssetLoader* _fallbackLoader;
+    // Set when the file is shared through the file cache, which then owns the
+    // file's asset loaders and render context.
+    RiveFileCacheEntry* _cacheEntry;
+    RiveFileMetadata* _metadata;
+    // The hex SHA-256 of the file's contents, when computed during import.
+    NSString* _contentHash;
 }
 
 + (uint)majorVersion
@@ -190,9 +248,7 @@
     NSString* filepath = [[NSBundle mainBundle] pathForResource:resourceName
                                                          ofType:extension];
     NSURL* fileUrl = [NSURL fileURLWithPath:filepath];
-    NSData* fileData = [NSData dataWithContentsOfURL:fileUrl];
-
-    return [self initWithData:fileData loadCdn:cdn error:error];
+    return [self initWithFileURL:fileUrl loadCdn:cdn error:error];
 }
 
 /*
@@ -235,13 +291,69 @@
     NSString* filepath = [[NSBundle mainBundle] pathForResource:resourceName
                                                          ofType:extension];
     NSURL* fileUrl = [NSURL fileURLWithPath:filepath];
-    NSData* fileData = [NSData dataWithContentsOfURL:fileUrl];
+    return [self initWithFileURL:fileUrl
+                         loadCdn:cdn
+               customAssetLoader:customAssetLoader
+                           error:error];
+}
+
+/*
+ * Creates a RiveFile from a file on disk. The file is memory-mapped read-only
+ * rather than read into the heap, and imported straight from the mapping;
+ * its pages are clean, so the OS can reclaim them under memory pressure.
+ */
+- (nullable instancetype)initWithFileURL:(NSURL*)fileURL
+                                 loadCdn:(bool)cdn
+                                   error:(NSError**)error
+{
+    NSData* fileData = [RiveFile mappedDataWithContentsOfURL:fileURL
+                                                       error:error];
+    if (fileData == nil)
+    {
+        return nil;
+    }
+    return [self initWithData:fileData loadCdn:cdn error:error];
+}
+
+- (nullable instancetype)initWithFileURL:(NSURL*)fileURL
+                                 loadCdn:(bool)cdn
+                       customAssetLoader:(LoadAsset)customAssetLoader
+                                   error:(NSError**)error
+{
+    NSData* fileData = [RiveFile mappedDataWithContentsOfURL:fileURL
+                                                       error:error];
+    if (fileData == nil)
+    {
+        return nil;
+    }
     return [self initWithData:fileData
                       loadCdn:cdn
             customAssetLoader:customAssetLoader
                         error:error];
 }
 
++ (nullable NSData*)mappedDataWithContentsOfURL:(NSURL*)fileURL
+                                          error:(NSError**)error
+{
+    NSError* readError = nil;
+    NSData* fileData = [NSData dataWithContentsOfURL:fileURL
+                                             options:NSDataReadingMappedIfSafe
+                                               error:&readError];
+    if (fileData == nil)
+    {
+        NSString* message =
+            [NSString stringWithFormat:@"Failed to read file at %@: %@",
+                                       fileURL.path,
+                                       readError.localizedDescription];
+        [RiveLogger logFile:nil error:message];
+        if (error)
+        {
+            *error = readError;
+        }
+    }
+    return fileData;
+}
+
 /*
  * Creates a RiveFile from an HTTP url
  */
@@ -337,6 +449,120 @@
     return nil;
 }
 
+#pragma mark - Asynchronous Import
+
+/**
+ * Returns the concurrent queue files are imported on asynchronously.
+ */
++ (dispatch_queue_t)importQueue
+{
+    static dispatch_once_t onceToken;
+    static dispatch_queue_t importQueue;
+    dispatch_once(&onceToken, ^{
+      auto attrs = dispatch_queue_attr_make_with_qos_class(
+          DISPATCH_QUEUE_CONCURRENT, QOS_CLASS_USER_INITIATED, -1);
+      importQueue = dispatch_queue_create("app.rive.file-import", attrs);
+    });
+    return importQueue;
+}
+
++ (nullable RiveFile*)newFileWithData:(NSData*)data
+                              loadCdn:(bool)cdn
+                    customAssetLoader:(nullable LoadAsset)customAssetLoader
+                                error:(NSError**)error
+{
+    if (customAssetLoader == nil)
+    {
+        return [[RiveFile alloc] initWithData:data loadCdn:cdn error:error];
+    }
+    return [[RiveFile alloc] initWithData:data
+                                  loadCdn:cdn
+                        customAssetLoader:customAssetLoader
+                                    error:error];
+}
+
++ (RiveFileImportTask*)importData:(NSData*)data
+                          loadCdn:(bool)cdn
+                customAssetLoader:(nullable LoadAsset)customAssetLoader
+                       completion:(RiveFileImportCompletion)completion
+{
+    RiveFileImportTask* task = [[RiveFileImportTask alloc] init];
+    dispatch_async([self importQueue], ^{
+      if (task.isCancelled)
+      {
+          return;
+      }
+      NSError* error = nil;
+      RiveFile* file = [RiveFile newFileWithData:data
+                                         loadCdn:cdn
+                               customAssetLoader:customAssetLoader
+                                           error:&error];
+      [task deliverFile:file error:error completion:completion];
+    });
+    return task;
+}
+
++ (RiveFileImportTask*)importFileURL:(NSURL*)fileURL
+                             loadCdn:(bool)cdn
+                   customAssetLoader:(nullable LoadAsset)customAssetLoader
+                          completion:(RiveFileImportCompletion)completion
+{
+    RiveFileImportTask* task = [[RiveFileImportTask alloc] init];
+    dispatch_async([self importQueue], ^{
+      if (task.isCancelled)
+      {
+          return;
+      }
+      NSError* error = nil;
+      RiveFile* file = nil;
+      NSData* data = [RiveFile mappedDataWithContentsOfURL:fileURL
+                                                     error:&error];
+      if (data != nil)
+      {
+          file = [RiveFile newFileWithData:data
+                                   loadCdn:cdn
+                         customAssetLoader:customAssetLoader
+                                     error:&error];
+      }
+      [task deliverFile:file error:error completion:completion];
+    });
+    return task;
+}
+
++ (RiveFileImportTask*)importResource:(NSString*)resourceName
+                        withExtension:(NSString*)extension
+                              loadCdn:(bool)cdn
+                    customAssetLoader:(nullable LoadAsset)customAssetLoader
+                           completion:(RiveFileImportCompletion)completion
+{
+    [RiveLogger logLoadingFromResource:[NSString stringWithFormat:@"%@.%@",
+                                                                  resourceName,
+                                                                  extension]];
+    NSURL* fileURL = [[NSBundle mainBundle] URLForResource:resourceName
+                                             withExtension:extension];
+    if (fileURL == nil)
+    {
+        NSString* message =
+            [NSString stringWithFormat:@"Failed to find resource %@.%@",
+                                       resourceName,
+                                       extension];
+        [RiveLogger logFile:nil error:message];
+        RiveFileImportTask* task = [[RiveFileImportTask alloc] init];
+        NSError* error = [NSError
+            errorWithDomain:NSCocoaErrorDomain
+                       code:NSFileReadNoSuchFileError
+                   userInfo:@{NSLocalizedDescriptionKey : message}];
+        [task deliverFile:nil error:error completion:completion];
+        return task;
+    }
+    return [self importFileURL:fileURL
+                       loadCdn:cdn
+             customAssetLoader:customAssetLoader
+                    completion:completion];
+}
+
+#pragma mark - Import
+
 - (BOOL)import:(UInt8*)bytes
     byteLength:(UInt64)length
        loadCdn:(bool)loadCdn
@@ -345,18 +571,36 @@
     return [self import:bytes
                byteLength:length
                   loadCdn:loadCdn
-        customAssetLoader:^bool(
-            RiveFileAsset* asset, NSData* data, RiveFactory* factory) {
-          return false;
-        }
+        customAssetLoader:nil
                     error:error];
 }
 - (BOOL)import:(UInt8*)bytes
            byteLength:(UInt64)length
               loadCdn:(bool)loadCdn
-    customAssetLoader:(LoadAsset)custom
+    customAssetLoader:(nullable LoadAsset)custom
                 error:(NSError**)error
 {
+    // Files imported with a custom asset loader are never shared, since their
+    // assets are provided by the caller and may differ between imports.
+    RiveFileCache* cache = [RiveFileCache shared];
+    NSString* cacheKey = nil;
+    if ((custom == nil && cache.isEnabled) ||
+        [RiveFileMetadataCache shared].isEnabled)
+    {
+        _contentHash = [RiveFileCache contentHashForBytes:bytes length:length];
+    }
+    if (custom == nil && cache.isEnabled)
+    {
+        cacheKey = [RiveFileCache keyForContentHash:_contentHash
+                                            loadCdn:loadCdn];
+        RiveFileCacheEntry* entry = [cache acquireEntryForKey:cacheKey];
+        if (entry != nil)
+        {
+            [self useCacheEntry:entry];
+            return true;
+        }
+    }
+
     rive::ImportResult result;
     _renderContext = [[RenderContextManager shared] newDefaultContext];
     NSAssert(_renderContext, @"A render context must be available.");
@@ -365,9 +609,12 @@
     FallbackFileAssetLoader* fallbackLoader =
         [[FallbackFileAssetLoader alloc] init];
 
-    CustomFileAssetLoader* customAssetLoader =
-        [[CustomFileAssetLoader alloc] initWithLoader:custom];
-    [fallbackLoader addLoader:customAssetLoader];
+    if (custom != nil)
+    {
+        CustomFileAssetLoader* customAssetLoader =
+            [[CustomFileAssetLoader alloc] initWithLoader:custom];
+        [fallbackLoader addLoader:customAssetLoader];
+    }
 
     if (loadCdn)
     {
@@ -384,6 +631,18 @@
         rive::Span(bytes, length), factory, &result, fileAssetLoader.get());
     if (result == rive::ImportResult::success)
     {
+        if (cacheKey != nil)
+        {
+            RiveFileCacheEntry* entry =
+                [cache insertFile:file
+                       assetLoader:fileAssetLoader
+                    fallbackLoader:fallbackLoader
+                     renderContext:_renderContext
+                         byteCount:length
+                            forKey:cacheKey];
+            [self useCacheEntry:entry];
+            return true;
+        }
         riveFile = file;
         return true;
     }
@@ -430,6 +689,15 @@
     return false;
 }
 
+- (void)useCacheEntry:(RiveFileCacheEntry*)entry
+{
+    _cacheEntry = entry;
+    riveFile = entry.file;
+    _renderContext = entry.renderContext;
+    fileAssetLoader = nullptr;
+    _fallbackLoader = nil;
+}
+
 - (RiveArtboard*)artboard:(NSError**)error
 {
     auto artboard = riveFile->artboardDefault();
@@ -500,17 +768,32 @@
 
 - (NSArray*)artboardNames
 {
-    NSMutableArray* artboardNames = [NSMutableArray array];
+    return [self.metadata.artboards valueForKey:@"name"];
+}
 
-    for (NSUInteger i = 0; i < [self artboardCount]; i++)
+- (RiveFileMetadata*)metadata
+{
+    @synchronized(self)
     {
-        RiveArtboard* artboard = [self artboardFromIndex:i error:nil];
-        if (artboard != nil)
+        if (_metadata == nil)
         {
-            [artboardNames addObject:[artboard name]];
+            // The file is already imported, so reading its definitions is
+            // cheaper than reading and decoding a sidecar. The sidecar is
+            // only written, for launches that have not imported the file.
+            _metadata = [[RiveFileMetadata alloc] initWithFile:riveFile.get()];
+            RiveFileMetadataCache* diskCache = [RiveFileMetadataCache shared];
+            if (_contentHash != nil && diskCache.isEnabled)
+            {
+                [diskCache storeMetadata:_metadata forContentHash:_contentHash];
+            }
         }
+        return _metadata;
     }
-    return artboardNames;
+}
+
+- (NSUInteger)importIdentifier
+{
+    return reinterpret_cast<uintptr_t>(riveFile.get());
 }
 
 #pragma mark - Data Binding
@@ -608,6 +891,13 @@
     [_fallbackLoader cancel];
     riveFile = nullptr;
     fileAssetLoader = nullptr;
+    if (_cacheEntry != nil)
+    {
+        // Release the file before the entry, so that an eviction triggered by
+        // the release frees it.
+        [[RiveFileCache shared] releaseEntry:_cacheEntry];
+        _cacheEntry = nil;
+    }
 }
 
 @end
@@ -0,0 +1,296 @@
+//
+//  RiveFileCache.mm
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#import <Rive.h>
+#import <RivePrivateHeaders.h>
+#import <RiveFileCache.h>
+#import <RenderContext.h>
+#import <RenderContextManager.h>
+#import <CDNFileAssetLoader.h>
+#import <CommonCrypto/CommonDigest.h>
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+constexpr static NSUInteger kDefaultMemoryBudget = 32 * 1024 * 1024;
+
+@interface RiveFileCacheEntry ()
+- (const std::string&)key;
+@property(nonatomic, readonly) NSUInteger byteCount;
+// The number of RiveFiles currently using the entry. Guarded by the cache's
+// mutex.
+@property(nonatomic) NSUInteger useCount;
+@end
+
+@implementation RiveFileCacheEntry
+{
+    rive::rcp<rive::File> _file;
+    rive::rcp<rive::FileAssetLoader> _assetLoader;
+    FallbackFileAssetLoader* _fallbackLoader;
+    std::string _key;
+}
+
+- (instancetype)initWithFile:(rive::rcp<rive::File>)file
+                 assetLoader:(rive::rcp<rive::FileAssetLoader>)assetLoader
+              fallbackLoader:(FallbackFileAssetLoader*)fallbackLoader
+               renderContext:(RenderContext*)renderContext
+                   byteCount:(NSUInteger)byteCount
+                         key:(std::string)key
+{
+    if (self = [super init])
+    {
+        _file = std::move(file);
+        _assetLoader = std::move(assetLoader);
+        _fallbackLoader = fallbackLoader;
+        _renderContext = renderContext;
+        _byteCount = byteCount;
+        _key = std::move(key);
+        _useCount = 0;
+    }
+    return self;
+}
+
+- (rive::rcp<rive::File>)file
+{
+    return _file;
+}
+
+- (const std::string&)key
+{
+    return _key;
+}
+
+- (void)dealloc
+{
+    [_fallbackLoader cancel];
+    _file = nullptr;
+    _assetLoader = nullptr;
+}
+
+@end
+
+@implementation RiveFileCache
+{
+    std::mutex _mutex;
+    // Most recently used entries are at the front.
+    std::list<RiveFileCacheEntry*> _lru;
+    std::unordered_map<std::string, std::list<RiveFileCacheEntry*>::iterator>
+        _index;
+    NSUInteger _memoryBudget;
+    NSUInteger _totalByteCount;
+    NSUInteger _hitCount;
+    NSUInteger _missCount;
+    NSUInteger _evictionCount;
+}
+
++ (RiveFileCache*)shared
+{
+    static RiveFileCache* shared = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+      shared = [[self alloc] initPrivate];
+    });
+    return shared;
+}
+
+- (instancetype)initPrivate
+{
+    if (self = [super init])
+    {
+        _enabled = NO;
+        _memoryBudget = kDefaultMemoryBudget;
+        _totalByteCount = 0;
+        _hitCount = 0;
+        _missCount = 0;
+        _evictionCount = 0;
+    }
+    return self;
+}
+
++ (NSString*)contentHashForBytes:(const uint8_t*)bytes
+                          length:(NSUInteger)length
+{
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(bytes, (CC_LONG)length, digest);
+
+    NSMutableString* hash =
+        [NSMutableString stringWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+    for (int i = 0; i < CC_SHA256_DIGEST_LENGTH; i++)
+    {
+        [hash appendFormat:@"%02x", digest[i]];
+    }
+    return hash;
+}
+
++ (NSString*)keyForContentHash:(NSString*)contentHash loadCdn:(bool)loadCdn
+{
+    // Files hold resources created by the factory of the renderer they were
+    // imported with, so the renderer is part of the loader configuration.
+    return [NSString
+        stringWithFormat:@"%@-%d-%ld",
+                         contentHash,
+                         loadCdn ? 1 : 0,
+                         (long)[RenderContextManager shared].defaultRenderer];
+}
+
+- (nullable RiveFileCacheEntry*)acquireEntryForKey:(NSString*)key
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto itr = _index.find(std::string(key.UTF8String));
+    if (itr == _index.end())
+    {
+        _missCount++;
+        return nil;
+    }
+    _hitCount++;
+    _lru.splice(_lru.begin(), _lru, itr->second);
+    RiveFileCacheEntry* entry = *itr->second;
+    entry.useCount++;
+    return entry;
+}
+
+- (RiveFileCacheEntry*)
+       insertFile:(rive::rcp<rive::File>)file
+      assetLoader:(rive::rcp<rive::FileAssetLoader>)assetLoader
+    fallbackLoader:(FallbackFileAssetLoader*)fallbackLoader
+    renderContext:(RenderContext*)renderContext
+        byteCount:(NSUInteger)byteCount
+           forKey:(NSString*)key
+{
+    std::string stdKey(key.UTF8String);
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Another thread may have imported the same file while this one was
+    // importing; share the file that made it into the cache first.
+    auto itr = _index.find(stdKey);
+    if (itr != _index.end())
+    {
+        // The losing import's file is released on return; stop any asset
+        // downloads it started.
+        [fallbackLoader cancel];
+        _lru.splice(_lru.begin(), _lru, itr->second);
+        RiveFileCacheEntry* entry = *itr->second;
+        entry.useCount++;
+        return entry;
+    }
+
+    RiveFileCacheEntry* entry =
+        [[RiveFileCacheEntry alloc] initWithFile:std::move(file)
+                                     assetLoader:std::move(assetLoader)
+                                  fallbackLoader:fallbackLoader
+                                   renderContext:renderContext
+                                       byteCount:byteCount
+                                             key:stdKey];
+    entry.useCount = 1;
+    _lru.push_front(entry);
+    _index[stdKey] = _lru.begin();
+    _totalByteCount += byteCount;
+    [self trimLocked];
+    return entry;
+}
+
+- (void)releaseEntry:(RiveFileCacheEntry*)entry
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (entry.useCount > 0)
+    {
+        entry.useCount--;
+    }
+    [self trimLocked];
+}
+
+// Evicts unused entries, least recently used first, until the cache is within
+// its budget. Must be called with the mutex held.
+- (void)trimLocked
+{
+    auto itr = _lru.end();
+    while (_totalByteCount > _memoryBudget && itr != _lru.begin())
+    {
+        --itr;
+        RiveFileCacheEntry* entry = *itr;
+        if (entry.useCount > 0)
+        {
+            continue;
+        }
+        _totalByteCount -= entry.byteCount;
+        _index.erase(entry.key);
+        itr = _lru.erase(itr);
+        _evictionCount++;
+    }
+}
+
+- (void)removeAllUnusedFiles
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto itr = _lru.begin(); itr != _lru.end();)
+    {
+        RiveFileCacheEntry* entry = *itr;
+        if (entry.useCount > 0)
+        {
+            ++itr;
+            continue;
+        }
+        _totalByteCount -= entry.byteCount;
+        _index.erase(entry.key);
+        itr = _lru.erase(itr);
+    }
+}
+
+- (void)resetStatistics
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _hitCount = 0;
+    _missCount = 0;
+    _evictionCount = 0;
+}
+
+- (NSUInteger)memoryBudget
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _memoryBudget;
+}
+
+- (void)setMemoryBudget:(NSUInteger)memoryBudget
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _memoryBudget = memoryBudget;
+    [self trimLocked];
+}
+
+- (NSUInteger)fileCount
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _lru.size();
+}
+
+- (NSUInteger)totalByteCount
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _totalByteCount;
+}
+
+- (NSUInteger)hitCount
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hitCount;
+}
+
+- (NSUInteger)missCount
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _missCount;
+}
+
+- (NSUInteger)evictionCount
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _evictionCount;
+}
+
+@end
@@ -0,0 +1,365 @@
+//
+//  RiveFileMetadata.mm
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#import <Rive.h>
+#import <RivePrivateHeaders.h>
+#import <RiveFileMetadata.h>
+
+static NSString* RiveFileMetadataString(const std::string& string)
+{
+    return [NSString stringWithCString:string.c_str()
+                              encoding:NSUTF8StringEncoding];
+}
+
+static NSArray* RiveFileMetadataDecodeArray(NSCoder* coder,
+                                            NSString* key,
+                                            Class elementClass)
+{
+    NSArray* array = [coder
+        decodeObjectOfClasses:[NSSet setWithObjects:[NSArray class],
+                                                    elementClass,
+                                                    nil]
+                       forKey:key];
+    for (id element in array)
+    {
+        if (![element isKindOfClass:elementClass])
+        {
+            return nil;
+        }
+    }
+    return [array isKindOfClass:[NSArray class]] ? array : nil;
+}
+
+@implementation RiveStateMachineInputMetadata
+
+- (instancetype)initWithInput:(const rive::StateMachineInput*)input
+{
+    if (self = [super init])
+    {
+        _name = RiveFileMetadataString(input->name());
+        if (input->is<rive::StateMachineNumber>())
+        {
+            _type = RiveStateMachineInputTypeNumber;
+        }
+        else if (input->is<rive::StateMachineTrigger>())
+        {
+            _type = RiveStateMachineInputTypeTrigger;
+        }
+        else
+        {
+            _type = RiveStateMachineInputTypeBoolean;
+        }
+    }
+    return self;
+}
+
++ (BOOL)supportsSecureCoding
+{
+    return YES;
+}
+
+- (void)encodeWithCoder:(NSCoder*)coder
+{
+    [coder encodeObject:_name forKey:@"name"];
+    [coder encodeInteger:_type forKey:@"type"];
+}
+
+- (nullable instancetype)initWithCoder:(NSCoder*)coder
+{
+    NSString* name = [coder decodeObjectOfClass:[NSString class]
+                                         forKey:@"name"];
+    NSInteger type = [coder decodeIntegerForKey:@"type"];
+    if (name == nil || type < RiveStateMachineInputTypeBoolean ||
+        type > RiveStateMachineInputTypeTrigger)
+    {
+        return nil;
+    }
+    if (self = [super init])
+    {
+        _name = name;
+        _type = (RiveStateMachineInputType)type;
+    }
+    return self;
+}
+
+@end
+
+@implementation RiveStateMachineMetadata
+
+- (instancetype)initWithStateMachine:(const rive::StateMachine*)stateMachine
+{
+    if (self = [super init])
+    {
+        _name = RiveFileMetadataString(stateMachine->name());
+        NSMutableArray* inputs =
+            [NSMutableArray arrayWithCapacity:stateMachine->inputCount()];
+        for (size_t i = 0; i < stateMachine->inputCount(); i++)
+        {
+            auto input = stateMachine->input(i);
+            if (input == nullptr)
+            {
+                continue;
+            }
+            [inputs addObject:[[RiveStateMachineInputMetadata alloc]
+                                  initWithInput:input]];
+        }
+        _inputs = inputs;
+    }
+    return self;
+}
+
++ (BOOL)supportsSecureCoding
+{
+    return YES;
+}
+
+- (void)encodeWithCoder:(NSCoder*)coder
+{
+    [coder encodeObject:_name forKey:@"name"];
+    [coder encodeObject:_inputs forKey:@"inputs"];
+}
+
+- (nullable instancetype)initWithCoder:(NSCoder*)coder
+{
+    NSString* name = [coder decodeObjectOfClass:[NSString class]
+                                         forKey:@"name"];
+    NSArray* inputs = RiveFileMetadataDecodeArray(
+        coder, @"inputs", [RiveStateMachineInputMetadata class]);
+    if (name == nil || inputs == nil)
+    {
+        return nil;
+    }
+    if (self = [super init])
+    {
+        _name = name;
+        _inputs = inputs;
+    }
+    return self;
+}
+
+@end
+
+@implementation RiveArtboardMetadata
+
+- (instancetype)initWithArtboard:(rive::Artboard*)artboard
+{
+    if (self = [super init])
+    {
+        _name = RiveFileMetadataString(artboard->name());
+        _width = artboard->width();
+        _height = artboard->height();
+
+        NSMutableArray* animationNames =
+            [NSMutableArray arrayWithCapacity:artboard->animationCount()];
+        for (size_t i = 0; i < artboard->animationCount(); i++)
+        {
+            auto animation = artboard->animation(i);
+            if (animation != nullptr)
+            {
+                [animationNames
+                    addObject:RiveFileMetadataString(animation->name())];
+            }
+        }
+        _animationNames = animationNames;
+
+        NSMutableArray* stateMachines =
+            [NSMutableArray arrayWithCapacity:artboard->stateMachineCount()];
+        for (size_t i = 0; i < artboard->stateMachineCount(); i++)
+        {
+            auto stateMachine = artboard->stateMachine(i);
+            if (stateMachine != nullptr)
+            {
+                [stateMachines addObject:[[RiveStateMachineMetadata alloc]
+                                             initWithStateMachine:stateMachine]];
+            }
+        }
+        _stateMachines = stateMachines;
+    }
+    return self;
+}
+
++ (BOOL)supportsSecureCoding
+{
+    return YES;
+}
+
+- (void)encodeWithCoder:(NSCoder*)coder
+{
+    [coder encodeObject:_name forKey:@"name"];
+    [coder encodeDouble:_width forKey:@"width"];
+    [coder encodeDouble:_height forKey:@"height"];
+    [coder encodeObject:_animationNames forKey:@"animationNames"];
+    [coder encodeObject:_stateMachines forKey:@"stateMachines"];
+}
+
+- (nullable instancetype)initWithCoder:(NSCoder*)coder
+{
+    NSString* name = [coder decodeObjectOfClass:[NSString class]
+                                         forKey:@"name"];
+    NSArray* animationNames = RiveFileMetadataDecodeArray(
+        coder, @"animationNames", [NSString class]);
+    NSArray* stateMachines = RiveFileMetadataDecodeArray(
+        coder, @"stateMachines", [RiveStateMachineMetadata class]);
+    if (name == nil || animationNames == nil || stateMachines == nil)
+    {
+        return nil;
+    }
+    if (self = [super init])
+    {
+        _name = name;
+        _width = [coder decodeDoubleForKey:@"width"];
+        _height = [coder decodeDoubleForKey:@"height"];
+        _animationNames = animationNames;
+        _stateMachines = stateMachines;
+    }
+    return self;
+}
+
+@end
+
+@implementation RiveViewModelMetadata
+
+- (instancetype)initWithViewModel:(rive::ViewModelRuntime*)viewModel
+{
+    if (self = [super init])
+    {
+        RiveDataBindingViewModel* model =
+            [[RiveDataBindingViewModel alloc] initWithViewModel:viewModel];
+        _name = model.name;
+        _properties = model.properties;
+        _instanceNames = model.instanceNames;
+    }
+    return self;
+}
+
++ (BOOL)supportsSecureCoding
+{
+    return YES;
+}
+
+- (void)encodeWithCoder:(NSCoder*)coder
+{
+    [coder encodeObject:_name forKey:@"name"];
+    [coder encodeObject:_properties forKey:@"properties"];
+    [coder encodeObject:_instanceNames forKey:@"instanceNames"];
+}
+
+- (nullable instancetype)initWithCoder:(NSCoder*)coder
+{
+    NSString* name = [coder decodeObjectOfClass:[NSString class]
+                                         forKey:@"name"];
+    NSArray* properties = RiveFileMetadataDecodeArray(
+        coder,
+        @"properties",
+        [RiveDataBindingViewModelInstancePropertyData class]);
+    NSArray* instanceNames =
+        RiveFileMetadataDecodeArray(coder, @"instanceNames", [NSString class]);
+    if (name == nil || properties == nil || instanceNames == nil)
+    {
+        return nil;
+    }
+    if (self = [super init])
+    {
+        _name = name;
+        _properties = properties;
+        _instanceNames = instanceNames;
+    }
+    return self;
+}
+
+@end
+
+@implementation RiveFileMetadata
+
+- (instancetype)initWithFile:(rive::File*)file
+{
+    if (self = [super init])
+    {
+        NSMutableArray* artboards =
+            [NSMutableArray arrayWithCapacity:file->artboardCount()];
+        for (size_t i = 0; i < file->artboardCount(); i++)
+        {
+            // The artboard definitions, not instances of them.
+            auto artboard = file->artboard(i);
+            if (artboard != nullptr)
+            {
+                [artboards addObject:[[RiveArtboardMetadata alloc]
+                                         initWithArtboard:artboard]];
+            }
+        }
+        _artboards = artboards;
+
+        NSMutableArray* viewModels =
+            [NSMutableArray arrayWithCapacity:file->viewModelCount()];
+        for (size_t i = 0; i < file->viewModelCount(); i++)
+        {
+            auto viewModel = file->viewModelByIndex(i);
+            if (viewModel != nullptr)
+            {
+                [viewModels addObject:[[RiveViewModelMetadata alloc]
+                                          initWithViewModel:viewModel]];
+            }
+        }
+        _viewModels = viewModels;
+    }
+    return self;
+}
+
++ (BOOL)supportsSecureCoding
+{
+    return YES;
+}
+
+- (void)encodeWithCoder:(NSCoder*)coder
+{
+    [coder encodeObject:_artboards forKey:@"artboards"];
+    [coder encodeObject:_viewModels forKey:@"viewModels"];
+}
+
+- (nullable instancetype)initWithCoder:(NSCoder*)coder
+{
+    NSArray* artboards = RiveFileMetadataDecodeArray(
+        coder, @"artboards", [RiveArtboardMetadata class]);
+    NSArray* viewModels = RiveFileMetadataDecodeArray(
+        coder, @"viewModels", [RiveViewModelMetadata class]);
+    if (artboards == nil || viewModels == nil)
+    {
+        return nil;
+    }
+    if (self = [super init])
+    {
+        _artboards = artboards;
+        _viewModels = viewModels;
+    }
+    return self;
+}
+
+- (nullable RiveArtboardMetadata*)artboardNamed:(NSString*)name
+{
+    for (RiveArtboardMetadata* artboard in _artboards)
+    {
+        if ([artboard.name isEqualToString:name])
+        {
+            return artboard;
+        }
+    }
+    return nil;
+}
+
+- (nullable RiveViewModelMetadata*)viewModelNamed:(NSString*)name
+{
+    for (RiveViewModelMetadata* viewModel in _viewModels)
+    {
+        if ([viewModel.name isEqualToString:name])
+        {
+            return viewModel;
+        }
+    }
+    return nil;
+}
+
+@end
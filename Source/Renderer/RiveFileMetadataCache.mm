@@ -0,0 +1,253 @@
+//
+//  RiveFileMetadataCache.mm
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#import <Rive.h>
+#import <RivePrivateHeaders.h>
+#import <RiveFileMetadataCache.h>
+#import <RiveRuntime/RiveRuntime-Swift.h>
+
+#include <atomic>
+
+static NSString* const kSidecarExtension = @"rivmeta";
+
+// Sidecars start with a fixed size header, followed by the keyed archive of
+// the metadata:
+//   magic           4 bytes   "RIVM"
+//   formatVersion   uint32    kSidecarFormatVersion
+//   majorVersion    uint32    RiveFile.majorVersion when written
+//   minorVersion    uint32    RiveFile.minorVersion when written
+//   contentHash     64 bytes  hex SHA-256 of the .riv contents
+// Integers are little endian.
+static const char kSidecarMagic[4] = {'R', 'I', 'V', 'M'};
+constexpr static uint32_t kSidecarFormatVersion = 1;
+constexpr static NSUInteger kContentHashLength = 64;
+constexpr static NSUInteger kSidecarHeaderLength = 16 + kContentHashLength;
+
+@implementation RiveFileMetadataCache
+{
+    std::atomic<NSUInteger> _hitCount;
+    std::atomic<NSUInteger> _missCount;
+    dispatch_queue_t _writeQueue;
+}
+
++ (RiveFileMetadataCache*)shared
+{
+    static RiveFileMetadataCache* shared = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+      NSURL* caches = [[NSFileManager defaultManager]
+                          URLsForDirectory:NSCachesDirectory
+                                 inDomains:NSUserDomainMask]
+                          .firstObject;
+      shared = [[RiveFileMetadataCache alloc]
+          initWithDirectoryURL:[caches URLByAppendingPathComponent:
+                                           @"app.rive.file-metadata"
+                                                       isDirectory:YES]];
+      shared.enabled = NO;
+    });
+    return shared;
+}
+
+- (instancetype)initWithDirectoryURL:(NSURL*)directoryURL
+{
+    if (self = [super init])
+    {
+        _directoryURL = directoryURL;
+        _enabled = YES;
+        _hitCount = 0;
+        _missCount = 0;
+        _writeQueue = dispatch_queue_create(
+            "app.rive.file-metadata-cache",
+            dispatch_queue_attr_make_with_qos_class(
+                DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, -1));
+    }
+    return self;
+}
+
+- (NSUInteger)hitCount
+{
+    return _hitCount;
+}
+
+- (NSUInteger)missCount
+{
+    return _missCount;
+}
+
+- (void)resetStatistics
+{
+    _hitCount = 0;
+    _missCount = 0;
+}
+
+- (NSURL*)sidecarURLForContentHash:(NSString*)contentHash
+{
+    return [[_directoryURL URLByAppendingPathComponent:contentHash]
+        URLByAppendingPathExtension:kSidecarExtension];
+}
+
+- (nullable RiveFileMetadata*)metadataForData:(NSData*)data
+{
+    NSString* contentHash =
+        [RiveFileCache contentHashForBytes:(const uint8_t*)data.bytes
+                                    length:data.length];
+    return [self metadataForContentHash:contentHash];
+}
+
+- (nullable RiveFileMetadata*)metadataForContentHash:(NSString*)contentHash
+{
+    NSURL* url = [self sidecarURLForContentHash:contentHash];
+    __block RiveFileMetadata* metadata = nil;
+    // Reads go through the write queue, so that metadata stored earlier is
+    // visible and stale sidecars are not deleted while being rewritten.
+    dispatch_sync(_writeQueue, ^{
+      NSData* sidecar = [NSData dataWithContentsOfURL:url
+                                              options:NSDataReadingMappedIfSafe
+                                                error:nil];
+      if (sidecar == nil)
+      {
+          return;
+      }
+      metadata = [self decodeSidecar:sidecar forContentHash:contentHash];
+      if (metadata == nil)
+      {
+          // Written by another runtime version, or unreadable.
+          [[NSFileManager defaultManager] removeItemAtURL:url error:nil];
+      }
+    });
+    if (metadata == nil)
+    {
+        _missCount++;
+        return nil;
+    }
+    _hitCount++;
+    return metadata;
+}
+
+/// Whether a sidecar was written by this runtime version for the given
+/// content hash. Reads only the header.
+- (BOOL)isCurrentSidecar:(NSData*)sidecar forContentHash:(NSString*)contentHash
+{
+    if (sidecar.length < kSidecarHeaderLength)
+    {
+        return NO;
+    }
+    const uint8_t* bytes = (const uint8_t*)sidecar.bytes;
+    if (memcmp(bytes, kSidecarMagic, sizeof(kSidecarMagic)) != 0)
+    {
+        return NO;
+    }
+    uint32_t header[3];
+    memcpy(header, bytes + 4, sizeof(header));
+    if (CFSwapInt32LittleToHost(header[0]) != kSidecarFormatVersion ||
+        CFSwapInt32LittleToHost(header[1]) != RiveFile.majorVersion ||
+        CFSwapInt32LittleToHost(header[2]) != RiveFile.minorVersion)
+    {
+        return NO;
+    }
+    NSString* storedHash =
+        [[NSString alloc] initWithBytes:bytes + 16
+                                 length:kContentHashLength
+                               encoding:NSASCIIStringEncoding];
+    return [storedHash isEqualToString:contentHash];
+}
+
+- (nullable RiveFileMetadata*)decodeSidecar:(NSData*)sidecar
+                             forContentHash:(NSString*)contentHash
+{
+    if (![self isCurrentSidecar:sidecar forContentHash:contentHash])
+    {
+        return nil;
+    }
+    NSData* archive = [sidecar
+        subdataWithRange:NSMakeRange(kSidecarHeaderLength,
+                                     sidecar.length - kSidecarHeaderLength)];
+    return [NSKeyedUnarchiver unarchivedObjectOfClass:[RiveFileMetadata class]
+                                             fromData:archive
+                                                error:nil];
+}
+
+- (void)storeMetadata:(RiveFileMetadata*)metadata
+       forContentHash:(NSString*)contentHash
+{
+    if ([contentHash lengthOfBytesUsingEncoding:NSASCIIStringEncoding] !=
+        kContentHashLength)
+    {
+        return;
+    }
+    NSURL* directoryURL = _directoryURL;
+    NSURL* url = [self sidecarURLForContentHash:contentHash];
+    // Archiving and writing happen off the caller's thread. Files imported
+    // on every launch find their sidecar already written, and skip both.
+    dispatch_async(_writeQueue, ^{
+      NSData* existing = [NSData dataWithContentsOfURL:url
+                                               options:NSDataReadingMappedIfSafe
+                                                 error:nil];
+      if (existing != nil &&
+          [self isCurrentSidecar:existing forContentHash:contentHash])
+      {
+          return;
+      }
+
+      NSError* error = nil;
+      NSData* archive = [NSKeyedArchiver archivedDataWithRootObject:metadata
+                                              requiringSecureCoding:YES
+                                                              error:&error];
+      if (archive == nil)
+      {
+          [RiveLogger logFile:nil error:@"Could not archive file metadata"];
+          return;
+      }
+
+      NSMutableData* sidecar = [NSMutableData
+          dataWithCapacity:kSidecarHeaderLength + archive.length];
+      [sidecar appendBytes:kSidecarMagic length:sizeof(kSidecarMagic)];
+      uint32_t header[3] = {
+          CFSwapInt32HostToLittle(kSidecarFormatVersion),
+          CFSwapInt32HostToLittle(RiveFile.majorVersion),
+          CFSwapInt32HostToLittle(RiveFile.minorVersion),
+      };
+      [sidecar appendBytes:header length:sizeof(header)];
+      [sidecar
+          appendData:[contentHash dataUsingEncoding:NSASCIIStringEncoding]];
+      [sidecar appendData:archive];
+
+      [[NSFileManager defaultManager] createDirectoryAtURL:directoryURL
+                               withIntermediateDirectories:YES
+                                                attributes:nil
+                                                     error:nil];
+      if (![sidecar writeToURL:url options:NSDataWritingAtomic error:&error])
+      {
+          [RiveLogger
+              logFile:nil
+                error:[NSString
+                          stringWithFormat:@"Could not write file metadata: %@",
+                                           error.localizedDescription]];
+      }
+    });
+}
+
+- (void)removeAllMetadata
+{
+    dispatch_sync(_writeQueue, ^{
+      NSFileManager* fileManager = [NSFileManager defaultManager];
+      NSArray<NSURL*>* urls =
+          [fileManager contentsOfDirectoryAtURL:self->_directoryURL
+                     includingPropertiesForKeys:nil
+                                        options:0
+                                          error:nil];
+      for (NSURL* url in urls)
+      {
+          if ([url.pathExtension isEqualToString:kSidecarExtension])
+          {
+              [fileManager removeItemAtURL:url error:nil];
+          }
+      }
+    });
+}
+
+@end
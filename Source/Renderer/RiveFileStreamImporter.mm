@@ -0,0 +1,491 @@
+//
+//  RiveFileStreamImporter.mm
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#import <Rive.h>
+#import <RivePrivateHeaders.h>
+#import <RiveFileStreamImporter.h>
+#import <RiveRuntime/RiveRuntime-Swift.h>
+
+#include "rive/runtime_header.hpp"
+#include "rive/core/binary_reader.hpp"
+#include "rive/core/field_types/core_uint_type.hpp"
+#include "rive/core/field_types/core_string_type.hpp"
+#include "rive/core/field_types/core_double_type.hpp"
+#include "rive/core/field_types/core_color_type.hpp"
+#include "rive/generated/core_registry.hpp"
+
+#include <atomic>
+#include <vector>
+
+// The size of each read when importing from an NSInputStream.
+constexpr static NSUInteger kInputStreamChunkSize = 16 * 1024;
+
+namespace
+{
+enum class ScanResult
+{
+    needMoreBytes,
+    malformed,
+    unsupportedVersion,
+};
+
+// Skips the value of a single property, using the runtime's registry for known
+// properties and the header's table of contents for properties that this
+// runtime does not know about. Mirrors how rive::File reads objects.
+bool skipProperty(rive::BinaryReader& reader,
+                  uint64_t propertyKey,
+                  const rive::RuntimeHeader& header)
+{
+    int fieldId = rive::CoreRegistry::propertyFieldId((int)propertyKey);
+    if (fieldId == -1)
+    {
+        fieldId = header.propertyFieldId((int)propertyKey);
+    }
+
+    if (fieldId == rive::CoreUintType::id)
+    {
+        reader.readVarUint64();
+    }
+    else if (fieldId == rive::CoreStringType::id)
+    {
+        reader.readBytes();
+    }
+    else if (fieldId == rive::CoreDoubleType::id)
+    {
+        reader.readFloat32();
+    }
+    else if (fieldId == rive::CoreColorType::id)
+    {
+        reader.readUint32();
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+} // namespace
+
+@implementation RiveFileStreamImporter
+{
+    bool _loadCdn;
+    LoadAsset _customAssetLoader;
+
+    std::vector<uint8_t> _bytes;
+    rive::RuntimeHeader _header;
+    bool _hasHeader;
+    // The offset of the first object that has not been fully received yet.
+    size_t _scanOffset;
+    bool _hasProvisionalFile;
+    bool _isFinished;
+
+    // Imports provisional files off the append path, and orders every
+    // delegate call after them.
+    dispatch_queue_t _importQueue;
+
+    std::atomic<bool> _isCancelled;
+    std::atomic<NSUInteger> _bytesReceived;
+    std::atomic<NSUInteger> _artboardsReceived;
+}
+
+- (instancetype)initWithLoadCdn:(bool)cdn
+{
+    return [self initWithLoadCdn:cdn customAssetLoader:nil];
+}
+
+- (instancetype)initWithLoadCdn:(bool)cdn
+              customAssetLoader:(nullable LoadAsset)customAssetLoader
+{
+    if (self = [super init])
+    {
+        _loadCdn = cdn;
+        _customAssetLoader = customAssetLoader
+                                 ?: ^bool(RiveFileAsset* asset,
+                                          NSData* data,
+                                          RiveFactory* factory) {
+                                      return false;
+                                    };
+        _hasHeader = false;
+        _scanOffset = 0;
+        _hasProvisionalFile = false;
+        _isFinished = false;
+        _importQueue = dispatch_queue_create(
+            "app.rive.file-stream-import",
+            dispatch_queue_attr_make_with_qos_class(
+                DISPATCH_QUEUE_SERIAL, QOS_CLASS_USER_INITIATED, -1));
+        _isCancelled = false;
+        _bytesReceived = 0;
+        _artboardsReceived = 0;
+    }
+    return self;
+}
+
+- (NSUInteger)bytesReceived
+{
+    return _bytesReceived;
+}
+
+- (NSUInteger)artboardsReceived
+{
+    return _artboardsReceived;
+}
+
+- (void)expectLength:(NSUInteger)length
+{
+    _bytes.reserve(length);
+}
+
+- (BOOL)appendData:(NSData*)data
+{
+    __block BOOL ok = YES;
+    // Data delivered by URLSession is often discontiguous; walk its regions
+    // rather than asking for `bytes`, which would flatten it into a copy.
+    [data enumerateByteRangesUsingBlock:^(
+              const void* bytes, NSRange byteRange, BOOL* stop) {
+      ok = [self appendBytes:(const uint8_t*)bytes length:byteRange.length];
+      *stop = !ok;
+    }];
+    return ok;
+}
+
+- (BOOL)appendBytes:(const uint8_t*)bytes length:(NSUInteger)length
+{
+    if (_isCancelled || _isFinished)
+    {
+        return NO;
+    }
+
+    _bytes.insert(_bytes.end(), bytes, bytes + length);
+    _bytesReceived = _bytes.size();
+
+    ScanResult result = [self scan];
+    switch (result)
+    {
+        case ScanResult::needMoreBytes:
+            return YES;
+        case ScanResult::unsupportedVersion:
+            [self failWithCode:RiveUnsupportedVersion
+                       message:@"Unsupported Rive File Version"
+                          name:@"UnsupportedVersion"];
+            return NO;
+        case ScanResult::malformed:
+            [self failWithCode:RiveMalformedFile
+                       message:@"Malformed Rive File."
+                          name:@"Malformed"];
+            return NO;
+    }
+    return NO;
+}
+
+// Advances over every object that has fully arrived. Objects are never
+// partially consumed, so a scan that runs out of bytes simply resumes from the
+// same object once more bytes have been appended.
+- (ScanResult)scan
+{
+    if (!_hasHeader)
+    {
+        rive::BinaryReader reader(rive::Span(_bytes.data(), _bytes.size()));
+        bool ok = rive::RuntimeHeader::read(reader, _header);
+        if (reader.didOverflow())
+        {
+            return ScanResult::needMoreBytes;
+        }
+        if (!ok)
+        {
+            return ScanResult::malformed;
+        }
+        if (_header.majorVersion() != rive::File::majorVersion)
+        {
+            return ScanResult::unsupportedVersion;
+        }
+        _hasHeader = true;
+        _scanOffset = reader.position() - _bytes.data();
+
+        uint major = (uint)_header.majorVersion();
+        uint minor = (uint)_header.minorVersion();
+        [self notify:^(id<RiveFileStreamImporterDelegate> delegate) {
+          if ([delegate respondsToSelector:@selector
+                        (riveFileStreamImporter:
+                            didReadHeaderWithMajorVersion:minorVersion:)])
+          {
+              [delegate riveFileStreamImporter:self
+                  didReadHeaderWithMajorVersion:major
+                                   minorVersion:minor];
+          }
+        }];
+    }
+
+    while (_scanOffset < _bytes.size())
+    {
+        size_t objectOffset = _scanOffset;
+        rive::BinaryReader reader(rive::Span(_bytes.data() + objectOffset,
+                                             _bytes.size() - objectOffset));
+        uint64_t typeKey = reader.readVarUint64();
+        while (!reader.didOverflow())
+        {
+            uint64_t propertyKey = reader.readVarUint64();
+            if (reader.didOverflow() || propertyKey == 0)
+            {
+                break;
+            }
+            if (!skipProperty(reader, propertyKey, _header))
+            {
+                return ScanResult::malformed;
+            }
+        }
+        if (reader.didOverflow())
+        {
+            return ScanResult::needMoreBytes;
+        }
+        _scanOffset = reader.position() - _bytes.data();
+
+        if (typeKey == rive::Artboard::typeKey)
+        {
+            NSUInteger count = ++_artboardsReceived;
+            // The second artboard starting means everything before it,
+            // including the whole first artboard, has arrived.
+            if (count == 2 && !_hasProvisionalFile)
+            {
+                [self importProvisionalFileWithLength:objectOffset];
+            }
+        }
+    }
+    return ScanResult::needMoreBytes;
+}
+
+// Importing takes time proportional to the bytes received, so it runs on the
+// import queue rather than holding up the source. The bytes are copied, since
+// the buffer keeps growing.
+- (void)importProvisionalFileWithLength:(size_t)length
+{
+    _hasProvisionalFile = true;
+    NSData* data = [NSData dataWithBytes:_bytes.data() length:length];
+    LoadAsset customAssetLoader = _customAssetLoader;
+    dispatch_async(_importQueue, ^{
+      if (self->_isCancelled)
+      {
+          return;
+      }
+      NSError* error = nil;
+      RiveFile* file =
+          [[RiveFile alloc] initWithBytes:(UInt8*)data.bytes
+                               byteLength:data.length
+                                  loadCdn:false
+                        customAssetLoader:customAssetLoader
+                                    error:&error];
+      // A provisional file is best-effort; the complete file reports any
+      // error.
+      if (file == nil)
+      {
+          return;
+      }
+      // Already on the import queue, so delivered ahead of any later call.
+      [self deliver:^(id<RiveFileStreamImporterDelegate> delegate) {
+        if ([delegate respondsToSelector:@selector(riveFileStreamImporter:
+                                             didImportProvisionalFile:)])
+        {
+            [delegate riveFileStreamImporter:self
+                    didImportProvisionalFile:file];
+        }
+      }];
+    });
+}
+
+- (void)finish
+{
+    if (_isCancelled || _isFinished)
+    {
+        return;
+    }
+    _isFinished = true;
+
+    NSError* error = nil;
+    RiveFile* file = [[RiveFile alloc] initWithBytes:_bytes.data()
+                                          byteLength:_bytes.size()
+                                             loadCdn:_loadCdn
+                                   customAssetLoader:_customAssetLoader
+                                               error:&error];
+    // The imported file owns copies of everything it needs.
+    std::vector<uint8_t>().swap(_bytes);
+
+    if (file == nil)
+    {
+        [self failWithError:error];
+        return;
+    }
+    [self notify:^(id<RiveFileStreamImporterDelegate> delegate) {
+      if ([delegate respondsToSelector:@selector(riveFileStreamImporter:
+                                                          didImportFile:)])
+      {
+          [delegate riveFileStreamImporter:self didImportFile:file];
+      }
+    }];
+}
+
+- (void)cancel
+{
+    _isCancelled = true;
+}
+
+- (void)importFromInputStream:(NSInputStream*)stream
+{
+    if (stream.streamStatus == NSStreamStatusNotOpen)
+    {
+        [stream open];
+    }
+
+    std::vector<uint8_t> chunk(kInputStreamChunkSize);
+    while (!_isCancelled)
+    {
+        NSInteger length = [stream read:chunk.data() maxLength:chunk.size()];
+        if (length == 0)
+        {
+            break;
+        }
+        if (length < 0)
+        {
+            [stream close];
+            [self failWithError:stream.streamError];
+            return;
+        }
+        if (![self appendBytes:chunk.data() length:length])
+        {
+            [stream close];
+            return;
+        }
+    }
+    [stream close];
+    [self finish];
+}
+
+#pragma mark - Errors
+
+- (void)failWithCode:(RiveErrorCode)code
+             message:(NSString*)message
+                name:(NSString*)name
+{
+    [RiveLogger logFile:nil error:message];
+    [self failWithError:[NSError errorWithDomain:RiveErrorDomain
+                                            code:code
+                                        userInfo:@{
+                                            NSLocalizedDescriptionKey : message,
+                                            @"name" : name
+                                        }]];
+}
+
+- (void)failWithError:(nullable NSError*)error
+{
+    _isFinished = true;
+    std::vector<uint8_t>().swap(_bytes);
+    if (error == nil)
+    {
+        NSString* message = @"Unknown error loading file.";
+        error = [NSError errorWithDomain:RiveErrorDomain
+                                    code:RiveUnknownError
+                                userInfo:@{
+                                    NSLocalizedDescriptionKey : message,
+                                    @"name" : @"Unknown"
+                                }];
+    }
+    [self notify:^(id<RiveFileStreamImporterDelegate> delegate) {
+      if ([delegate respondsToSelector:@selector(riveFileStreamImporter:
+                                                       didFailWithError:)])
+      {
+          [delegate riveFileStreamImporter:self didFailWithError:error];
+      }
+    }];
+}
+
+/// Calls the delegate on the main queue, after any provisional file being
+/// imported has been delivered.
+- (void)notify:(void (^)(id<RiveFileStreamImporterDelegate> delegate))block
+{
+    dispatch_async(_importQueue, ^{
+      [self deliver:block];
+    });
+}
+
+/// Calls the delegate on the main queue. The importer is kept alive until
+/// then, so that the call is made even if its owner has released it.
+- (void)deliver:(void (^)(id<RiveFileStreamImporterDelegate> delegate))block
+{
+    dispatch_async(dispatch_get_main_queue(), ^{
+      id<RiveFileStreamImporterDelegate> delegate = self.delegate;
+      if (self->_isCancelled || delegate == nil)
+      {
+          return;
+      }
+      block(delegate);
+    });
+}
+
+#pragma mark - NSURLSessionDataDelegate
+
+- (void)URLSession:(NSURLSession*)session
+              dataTask:(NSURLSessionDataTask*)dataTask
+    didReceiveResponse:(NSURLResponse*)response
+     completionHandler:
+         (void (^)(NSURLSessionResponseDisposition))completionHandler
+{
+    if ([response isKindOfClass:[NSHTTPURLResponse class]])
+    {
+        NSInteger status = ((NSHTTPURLResponse*)response).statusCode;
+        if (status < 200 || status >= 300)
+        {
+            NSString* message = [NSString
+                stringWithFormat:@"Failed to load file from URL %@: HTTP %ld",
+                                 response.URL.absoluteString,
+                                 (long)status];
+            [self failWithCode:RiveUnknownError
+                       message:message
+                          name:@"Unknown"];
+            completionHandler(NSURLSessionResponseCancel);
+            return;
+        }
+    }
+
+    if (response.expectedContentLength > 0)
+    {
+        [self expectLength:(NSUInteger)response.expectedContentLength];
+    }
+    completionHandler(_isCancelled ? NSURLSessionResponseCancel
+                                   : NSURLSessionResponseAllow);
+}
+
+- (void)URLSession:(NSURLSession*)session
+          dataTask:(NSURLSessionDataTask*)dataTask
+    didReceiveData:(NSData*)data
+{
+    if (![self appendData:data])
+    {
+        [dataTask cancel];
+    }
+}
+
+- (void)URLSession:(NSURLSession*)session
+                    task:(NSURLSessionTask*)task
+    didCompleteWithError:(nullable NSError*)error
+{
+    if (_isCancelled || _isFinished)
+    {
+        return;
+    }
+    if (error != nil)
+    {
+        NSString* message =
+            [NSString stringWithFormat:@"Failed to load file from URL %@: %@",
+                                       task.originalRequest.URL.absoluteString,
+                                       error.localizedDescription];
+        [RiveLogger logFile:nil error:message];
+        [self failWithError:error];
+        return;
+    }
+    [RiveLogger logLoadedFromURL:task.originalRequest.URL];
+    [self finish];
+}
+
+@end
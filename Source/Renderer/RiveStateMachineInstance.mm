@@ -9,6 +9,17 @@
 #import <Rive.h>
 #import <RivePrivateHeaders.h>
 #import <RiveRuntime/RiveRuntime-Swift.h>
+#import <StateMachineEventChannel.hpp>
+
+#include "rive/custom_property_boolean.hpp"
+#include "rive/custom_property_number.hpp"
+#include "rive/custom_property_string.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // MARK: - Globals
 
@@ -35,18 +46,49 @@ RiveHitResult RiveHitResultFromRuntime(rive::HitResult result)
     }
 }
 
+/// Returns the input at index if it is of type Input, or nullptr.
+template <typename Instance, typename Input>
+static Instance* RiveInputAtIndex(rive::StateMachineInstance* stateMachine,
+                                  NSInteger index)
+{
+    if (index < 0 || index >= (NSInteger)stateMachine->inputCount())
+    {
+        return nullptr;
+    }
+    rive::SMIInput* input = stateMachine->input(index);
+    if (input == nullptr || !input->input()->is<Input>())
+    {
+        return nullptr;
+    }
+    return static_cast<Instance*>(input);
+}
+
+/// Converts a string copied into a report, as events and states convert
+/// their names.
+static NSString* RiveReportString(const std::string& string)
+{
+    return [NSString stringWithCString:string.c_str()
+                              encoding:[NSString defaultCStringEncoding]];
+}
+
 // MARK: - RiveStateMachineInstance
 
 @interface RiveStateMachineInstance ()
 
-/// Holds references to SMIInputs
-@property NSMutableDictionary* inputs;
+/// Holds references to SMIInputs, keyed by name. Each type has its own
+/// dictionary, so that a cached input is found without building a key.
+@property NSMutableDictionary<NSString*, RiveSMIBool*>* bools;
+@property NSMutableDictionary<NSString*, RiveSMITrigger*>* triggers;
+@property NSMutableDictionary<NSString*, RiveSMINumber*>* numbers;
 
 @end
 
 @implementation RiveStateMachineInstance
 {
     std::unique_ptr<rive::StateMachineInstance> instance;
+    /// Input names to indices, built on first lookup by name.
+    std::unordered_map<std::string, NSInteger> inputIndices;
+    rive::StateMachineEventChannel reports;
 }
 
 // MARK: Lifecycle
@@ -62,7 +104,9 @@ RiveHitResult RiveHitResultFromRuntime(rive::HitResult result)
 #endif // RIVE_ENABLE_REFERENCE_COUNTING
 
         instance = std::move(stateMachine);
-        _inputs = [[NSMutableDictionary alloc] init];
+        _bools = [[NSMutableDictionary alloc] init];
+        _triggers = [[NSMutableDictionary alloc] init];
+        _numbers = [[NSMutableDictionary alloc] init];
         return self;
     }
     else
@@ -105,18 +149,26 @@ RiveHitResult RiveHitResultFromRuntime(rive::HitResult result)
 - (bool)advanceBy:(double)elapsedSeconds
 {
     [RiveLogger logStateMachine:self advance:elapsedSeconds];
-    return instance->advanceAndApply(elapsedSeconds);
+    return [self advanceUnloggedBy:elapsedSeconds];
+}
+
+- (bool)advanceUnloggedBy:(double)elapsedSeconds
+{
+    // Advancing clears what was reported since the last advance, e.g. by
+    // touches, so it is collected first.
+    reports.collect(instance.get());
+    bool result = instance->advanceAndApply(elapsedSeconds);
+    reports.advanced();
+    return result;
 }
 
 - (RiveSMIBool*)getBool:(NSString*)name
 {
-    // Create a unique dictionary name for numbers;
-    // this lets us use one dictionary for the three different types
-    NSString* dictName = [NSString stringWithFormat:@"%@%s", name, "_boo"];
     // Check if the input is already instanced
-    if ([_inputs objectForKey:dictName] != nil)
+    RiveSMIBool* cached = _bools[name];
+    if (cached != nil)
     {
-        return _inputs[dictName];
+        return cached;
     }
     // Otherwise, try to retrieve from runtime
     std::string stdName = std::string([name UTF8String]);
@@ -132,20 +184,19 @@ RiveHitResult RiveHitResultFromRuntime(rive::HitResult result)
     }
     else
     {
-        _inputs[dictName] = [[RiveSMIBool alloc] initWithSMIInput:smi];
-        return _inputs[dictName];
+        RiveSMIBool* input = [[RiveSMIBool alloc] initWithSMIInput:smi];
+        _bools[name] = input;
+        return input;
     }
 }
 
 - (RiveSMITrigger*)getTrigger:(NSString*)name
 {
-    // Create a unique dictionary name for numbers;
-    // this lets us use one dictionary for the three different types
-    NSString* dictName = [NSString stringWithFormat:@"%@%s", name, "_trg"];
     // Check if the input is already instanced
-    if ([_inputs objectForKey:dictName] != nil)
+    RiveSMITrigger* cached = _triggers[name];
+    if (cached != nil)
     {
-        return _inputs[dictName];
+        return cached;
     }
     // Otherwise, try to retrieve from runtime
     std::string stdName = std::string([name UTF8String]);
@@ -161,20 +212,19 @@ RiveHitResult RiveHitResultFromRuntime(rive::HitResult result)
     }
     else
     {
-        _inputs[dictName] = [[RiveSMITrigger alloc] initWithSMIInput:smi];
-        return _inputs[dictName];
+        RiveSMITrigger* input = [[RiveSMITrigger alloc] initWithSMIInput:smi];
+        _triggers[name] = input;
+        return input;
     }
 }
 
 - (RiveSMINumber*)getNumber:(NSString*)name
 {
-    // Create a unique dictionary name for numbers;
-    // this lets us use one dictionary for the three different types
-    NSString* dictName = [NSString stringWithFormat:@"%@%s", name, "_num"];
     // Check if the input is already instanced
-    if ([_inputs objectForKey:dictName] != nil)
+    RiveSMINumber* cached = _numbers[name];
+    if (cached != nil)
     {
-        return _inputs[dictName];
+        return cached;
     }
     // Otherwise, try to retrieve from runtime
     std::string stdName = std::string([name UTF8String]);
@@ -190,9 +240,9 @@ RiveHitResult RiveHitResultFromRuntime(rive::HitResult result)
     }
     else
     {
-        _inputs[dictName] = [[RiveSMINumber alloc] initWithSMIInput:smi];
-        ;
-        return _inputs[dictName];
+        RiveSMINumber* input = [[RiveSMINumber alloc] initWithSMIInput:smi];
+        _numbers[name] = input;
+        return input;
     }
 }
 
@@ -258,20 +308,10 @@ RiveHitResult RiveHitResultFromRuntime(rive::HitResult result)
 // Creates a new instance of this state machine
 - (RiveSMIInput*)inputFromName:(NSString*)name error:(NSError**)error
 {
-    std::string stdName = std::string([name UTF8String]);
-
-    RiveSMIInput* input = [RiveSMIInput alloc];
-    for (int i = 0; i < [self inputCount]; i++)
+    NSInteger index = [self inputIndexForName:name];
+    if (index != NSNotFound)
     {
-        input = [self inputFromIndex:i error:error];
-        if (input == nil)
-        {
-            return nil;
-        }
-        if ([[input name] isEqualToString:name])
-        {
-            return input;
-        }
+        return [self inputFromIndex:index error:error];
     }
     *error = [NSError
         errorWithDomain:RiveErrorDomain
@@ -285,6 +325,75 @@ RiveHitResult RiveHitResultFromRuntime(rive::HitResult result)
     return nil;
 }
 
+- (NSInteger)inputIndexForName:(NSString*)name
+{
+    if (inputIndices.empty())
+    {
+        for (size_t i = 0; i < instance->inputCount(); i++)
+        {
+            // Keep the first of duplicate names, as a scan would.
+            inputIndices.emplace(instance->input(i)->name(), i);
+        }
+    }
+    auto found = inputIndices.find(std::string([name UTF8String]));
+    return found == inputIndices.end() ? NSNotFound : found->second;
+}
+
+- (bool)setBool:(bool)value atIndex:(NSInteger)index
+{
+    rive::SMIBool* input =
+        RiveInputAtIndex<rive::SMIBool, rive::StateMachineBool>(instance.get(),
+                                                                index);
+    if (input == nullptr)
+    {
+        return false;
+    }
+    input->value(value);
+    return true;
+}
+
+- (bool)boolAtIndex:(NSInteger)index
+{
+    rive::SMIBool* input =
+        RiveInputAtIndex<rive::SMIBool, rive::StateMachineBool>(instance.get(),
+                                                                index);
+    return input != nullptr && input->value();
+}
+
+- (bool)setNumber:(float)value atIndex:(NSInteger)index
+{
+    rive::SMINumber* input =
+        RiveInputAtIndex<rive::SMINumber, rive::StateMachineNumber>(
+            instance.get(), index);
+    if (input == nullptr)
+    {
+        return false;
+    }
+    input->value(value);
+    return true;
+}
+
+- (float)numberAtIndex:(NSInteger)index
+{
+    rive::SMINumber* input =
+        RiveInputAtIndex<rive::SMINumber, rive::StateMachineNumber>(
+            instance.get(), index);
+    return input == nullptr ? 0 : input->value();
+}
+
+- (bool)fireTriggerAtIndex:(NSInteger)index
+{
+    rive::SMITrigger* input =
+        RiveInputAtIndex<rive::SMITrigger, rive::StateMachineTrigger>(
+            instance.get(), index);
+    if (input == nullptr)
+    {
+        return false;
+    }
+    input->fire();
+    return true;
+}
+
 - (NSArray*)inputNames
 {
     NSMutableArray* inputNames = [NSMutableArray array];
@@ -361,6 +470,117 @@ RiveHitResult RiveHitResultFromRuntime(rive::HitResult result)
     }
 }
 
+- (NSUInteger)readReportsAfter:(uint64_t)identifier
+                         kinds:(RiveStateMachineReportKind)kinds
+                          into:(RiveStateMachineReport*)buffer
+                      capacity:(NSUInteger)capacity
+{
+    reports.collect(instance.get());
+    // Read in chunks, so that any number of reports can be read without
+    // allocating.
+    const rive::StateMachineEventChannel::Report* found[32];
+    NSUInteger total = 0;
+    while (total < capacity)
+    {
+        size_t count = reports.read(
+            identifier,
+            (uint32_t)kinds,
+            found,
+            std::min((size_t)(capacity - total), std::size(found)));
+        for (size_t i = 0; i < count; i++)
+        {
+            buffer[total + i].identifier = found[i]->id;
+            buffer[total + i].kind = (RiveStateMachineReportKind)found[i]->kind;
+            buffer[total + i].delay = found[i]->delay;
+        }
+        total += count;
+        if (count < std::size(found))
+        {
+            break;
+        }
+        identifier = found[count - 1]->id;
+    }
+    return total;
+}
+
+- (uint64_t)lastReportIdentifier
+{
+    reports.collect(instance.get());
+    return reports.lastID();
+}
+
+- (uint64_t)reportIdentifierBeforeLatestAdvance
+{
+    return reports.lastIDBeforeAdvance();
+}
+
+- (RiveEvent*)eventForReport:(uint64_t)identifier
+{
+    const rive::StateMachineEventChannel::Report* report =
+        reports.find(identifier);
+    if (report == nullptr ||
+        report->kind != rive::StateMachineEventChannel::Kind::event)
+    {
+        return nil;
+    }
+    NSMutableDictionary<NSString*, id>* properties = nil;
+    for (const auto& property : report->properties)
+    {
+        if (properties == nil)
+        {
+            properties = [NSMutableDictionary dictionary];
+        }
+        NSString* name = RiveReportString(property.name);
+        switch (property.typeKey)
+        {
+            case rive::CustomPropertyBoolean::typeKey:
+                properties[name] = @(property.boolValue);
+                break;
+            case rive::CustomPropertyNumber::typeKey:
+                properties[name] = @(property.numberValue);
+                break;
+            case rive::CustomPropertyString::typeKey:
+                properties[name] = RiveReportString(property.stringValue);
+                break;
+        }
+    }
+    Class eventClass = report->typeKey == rive::OpenUrlEvent::typeKey
+                           ? [RiveOpenUrlEvent class]
+                           : [RiveGeneralEvent class];
+    return [[eventClass alloc] initWithName:RiveReportString(report->name)
+                                       type:report->typeKey
+                                      delay:report->delay
+                                 properties:properties
+                                        url:RiveReportString(report->url)
+                                targetValue:report->target];
+}
+
+- (NSString*)stateNameForReport:(uint64_t)identifier
+{
+    const rive::StateMachineEventChannel::Report* report =
+        reports.find(identifier);
+    if (report == nullptr ||
+        report->kind != rive::StateMachineEventChannel::Kind::stateChange)
+    {
+        return nil;
+    }
+    // Named as RiveLayerState and its subclasses name them.
+    switch (report->typeKey)
+    {
+        case rive::EntryState::typeKey:
+            return @"EntryState";
+        case rive::AnyState::typeKey:
+            return @"AnyState";
+        case rive::ExitState::typeKey:
+            return @"ExitState";
+        case rive::AnimationState::typeKey:
+            return report->name.empty() ? @"Unknown"
+                                        : RiveReportString(report->name);
+        default:
+            return @"UnknownState";
+    }
+}
+
 - (RiveLayerState*)stateChangedFromIndex:(NSInteger)index error:(NSError**)error
 {
     const rive::LayerState* layerState = instance->stateChangedByIndex(index);
@@ -490,4 +710,42 @@ RiveHitResult RiveHitResultFromRuntime(rive::HitResult result)
     [RiveLogger logStateMachine:self instanceBind:i.name];
 }
 
+- (NSSet<NSNumber*>*)viewModelInstanceIdentifiers
+{
+    NSMutableSet<NSNumber*>* identifiers = [NSMutableSet set];
+    if (_viewModelInstance == nil)
+    {
+        return identifiers;
+    }
+    // Instances can be nested in several places, or in themselves, so each
+    // is walked once.
+    std::vector<rive::rcp<rive::ViewModelInstanceRuntime>> pending;
+    pending.push_back(rive::ref_rcp(_viewModelInstance.instance));
+    while (!pending.empty())
+    {
+        auto runtime = pending.back();
+        pending.pop_back();
+        NSNumber* identifier =
+            @(reinterpret_cast<uintptr_t>(runtime->instance().get()));
+        if ([identifiers containsObject:identifier])
+        {
+            continue;
+        }
+        [identifiers addObject:identifier];
+        for (const auto& property : runtime->properties())
+        {
+            if (property.type != rive::DataType::viewModel)
+            {
+                continue;
+            }
+            auto nested = runtime->propertyViewModel(property.name);
+            if (nested != nullptr)
+            {
+                pending.push_back(nested);
+            }
+        }
+    }
+    return identifiers;
+}
+
 @end
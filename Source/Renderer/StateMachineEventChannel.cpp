@@ -0,0 +1,208 @@
+//
+//  StateMachineEventChannel.cpp
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#include "StateMachineEventChannel.hpp"
+
+#include "rive/animation/animation_state.hpp"
+#include "rive/animation/linear_animation.hpp"
+#include "rive/custom_property_boolean.hpp"
+#include "rive/custom_property_number.hpp"
+#include "rive/custom_property_string.hpp"
+#include "rive/event.hpp"
+#include "rive/open_url_event.hpp"
+
+#include <atomic>
+#include <utility>
+
+namespace rive
+{
+
+namespace
+{
+std::atomic<uint64_t> nextReportID{1};
+
+void copyEvent(const Event* event, StateMachineEventChannel::Report& report)
+{
+    report.typeKey = event->coreType();
+    report.name = event->name();
+    report.url.clear();
+    report.target = 0;
+    if (event->is<OpenUrlEvent>())
+    {
+        const OpenUrlEvent* openUrl = event->as<OpenUrlEvent>();
+        report.url = openUrl->url();
+        report.target = openUrl->targetValue();
+    }
+    report.properties.clear();
+    for (auto child : event->children())
+    {
+        if (!child->is<CustomProperty>() || child->name().empty())
+        {
+            continue;
+        }
+        StateMachineEventChannel::Property property;
+        property.name = child->name();
+        property.typeKey = child->coreType();
+        switch (child->coreType())
+        {
+            case CustomPropertyBoolean::typeKey:
+                property.boolValue =
+                    child->as<CustomPropertyBoolean>()->propertyValue();
+                break;
+            case CustomPropertyNumber::typeKey:
+                property.numberValue =
+                    child->as<CustomPropertyNumber>()->propertyValue();
+                break;
+            case CustomPropertyString::typeKey:
+                property.stringValue =
+                    child->as<CustomPropertyString>()->propertyValue();
+                break;
+        }
+        report.properties.push_back(std::move(property));
+    }
+}
+
+void copyState(const LayerState* state,
+               StateMachineEventChannel::Report& report)
+{
+    report.typeKey = state->coreType();
+    report.name.clear();
+    report.url.clear();
+    report.target = 0;
+    report.properties.clear();
+    if (state->is<AnimationState>())
+    {
+        const LinearAnimation* animation =
+            state->as<AnimationState>()->animation();
+        if (animation != nullptr)
+        {
+            report.name = animation->name();
+        }
+    }
+}
+} // namespace
+
+StateMachineEventChannel::StateMachineEventChannel() :
+    m_reports(initialCapacity)
+{}
+
+void StateMachineEventChannel::collect(StateMachineInstance* instance)
+{
+    const size_t eventCount = instance->reportedEventCount();
+    for (size_t i = m_collectedEvents; i < eventCount; i++)
+    {
+        const EventReport eventReport = instance->reportedEventAt(i);
+        if (eventReport.event() == nullptr)
+        {
+            continue;
+        }
+        Report& report = push();
+        report.kind = Kind::event;
+        report.delay = eventReport.secondsDelay();
+        copyEvent(eventReport.event(), report);
+    }
+    m_collectedEvents = eventCount;
+
+    const size_t stateCount = instance->stateChangedCount();
+    for (size_t i = m_collectedStates; i < stateCount; i++)
+    {
+        const LayerState* state = instance->stateChangedByIndex(i);
+        if (state == nullptr)
+        {
+            continue;
+        }
+        Report& report = push();
+        report.kind = Kind::stateChange;
+        report.delay = 0;
+        copyState(state, report);
+    }
+    m_collectedStates = stateCount;
+}
+
+void StateMachineEventChannel::advanced()
+{
+    m_collectedEvents = 0;
+    m_collectedStates = 0;
+    m_advanceCount++;
+    m_lastIDBeforeAdvance = lastID();
+}
+
+size_t StateMachineEventChannel::read(uint64_t after,
+                                      uint32_t kinds,
+                                      const Report** buffer,
+                                      size_t maxCount) const
+{
+    const size_t capacity = m_reports.size();
+    size_t count = 0;
+    for (size_t i = 0; i < m_size && count < maxCount; i++)
+    {
+        const Report& report = m_reports[(m_start + i) % capacity];
+        if (report.id > after &&
+            (static_cast<uint32_t>(report.kind) & kinds) != 0)
+        {
+            buffer[count++] = &report;
+        }
+    }
+    return count;
+}
+
+const StateMachineEventChannel::Report* StateMachineEventChannel::find(
+    uint64_t id) const
+{
+    const size_t capacity = m_reports.size();
+    for (size_t i = 0; i < m_size; i++)
+    {
+        const Report& report = m_reports[(m_start + i) % capacity];
+        if (report.id == id)
+        {
+            return &report;
+        }
+    }
+    return nullptr;
+}
+
+uint64_t StateMachineEventChannel::lastID() const
+{
+    return m_size == 0
+               ? 0
+               : m_reports[(m_start + m_size - 1) % m_reports.size()].id;
+}
+
+StateMachineEventChannel::Report& StateMachineEventChannel::push()
+{
+    if (m_size == m_reports.size())
+    {
+        // Reports collected since the advance before the latest may not have
+        // been read yet, so the ring grows rather than overwrite them.
+        if (m_reports[m_start].advance + 1 >= m_advanceCount)
+        {
+            grow();
+        }
+        else
+        {
+            m_start = (m_start + 1) % m_reports.size();
+            m_size--;
+        }
+    }
+    Report& report = m_reports[(m_start + m_size++) % m_reports.size()];
+    report.id = nextReportID.fetch_add(1, std::memory_order_relaxed);
+    report.advance = m_advanceCount;
+    return report;
+}
+
+void StateMachineEventChannel::grow()
+{
+    std::vector<Report> reports(m_reports.size() * 2);
+    for (size_t i = 0; i < m_size; i++)
+    {
+        reports[i] = std::move(m_reports[(m_start + i) % m_reports.size()]);
+    }
+    m_reports = std::move(reports);
+    m_start = 0;
+}
+
+} // namespace rive
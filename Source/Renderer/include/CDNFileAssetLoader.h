@@ -12,8 +12,14 @@
 #import <RiveRuntime/RiveFileAssetLoader.h>
 
 @class RiveFileAssetLoader;
+@class RiveCDNAssetCache;
 
+/// Loads assets hosted on the Rive CDN, through a RiveCDNAssetCache.
 @interface CDNFileAssetLoader : RiveFileAssetLoader
+/// Creates a loader that fetches through RiveCDNAssetCache.shared.
+- (instancetype)init;
+/// Creates a loader that fetches through the given cache.
+- (instancetype)initWithCache:(RiveCDNAssetCache*)cache;
 @end
 
 @interface FallbackFileAssetLoader : RiveFileAssetLoader
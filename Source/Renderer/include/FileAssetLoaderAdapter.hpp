@@ -13,6 +13,7 @@
 #import <RivePrivateHeaders.h>
 
 @class RiveFileAssetLoader;
+@class RiveFactory;
 
 namespace rive
 {
@@ -21,6 +22,10 @@ class FileAssetLoaderAdapter : public FileAssetLoader
 {
 private:
     RiveFileAssetLoader* loader;
+    // The wrapper of the last factory passed to loadContents. An import
+    // passes the same factory for every asset, so it is wrapped once.
+    RiveFactory* wrappedFactory = nil;
+    rive::Factory* wrappedFactoryPtr = nullptr;
 
 public:
     FileAssetLoaderAdapter(RiveFileAssetLoader*);
@@ -20,6 +20,26 @@ NS_ASSUME_NONNULL_BEGIN
 
 @protocol RiveMetalDrawableView;
 
+/// Counters describing how a render context's CPU-side buffer ring has been
+/// used. Only contexts that stage frames in CPU memory before handing them to
+/// the GPU (i.e. the CoreGraphics context) populate these; all other contexts
+/// report zeroes.
+typedef struct RenderContextBufferRingStats
+{
+    /// The number of frames that acquired a buffer from the ring.
+    NSUInteger acquireCount;
+    /// The number of acquires that found every buffer still owned by the GPU
+    /// and had to wait for one to be released.
+    NSUInteger waitCount;
+    /// The number of frames that were skipped because no buffer was free and
+    /// blocking acquires are disabled.
+    NSUInteger skipCount;
+    /// The total time, in seconds, spent waiting for a free buffer.
+    NSTimeInterval totalWaitTime;
+    /// The longest single wait, in seconds, for a free buffer.
+    NSTimeInterval maxWaitTime;
+} RenderContextBufferRingStats;
+
 /// RenderContext knows how to set up a backend-specific render context (e.g.,
 /// CG, Rive, ...), and provides a rive::Factory and rive::Renderer for it.
 @interface RenderContext : NSObject
@@ -34,6 +54,27 @@ NS_ASSUME_NONNULL_BEGIN
 - (BOOL)canDrawInRect:(CGRect)rect
          drawableSize:(CGSize)size
                 scale:(CGFloat)scale;
+/// Returns a snapshot of the buffer ring counters since creation, or since the
+/// last call to `resetBufferRingStats`.
+- (RenderContextBufferRingStats)bufferRingStats;
+- (void)resetBufferRingStats;
+@end
+
+/// Renders with CoreGraphics into a ring of CPU-side buffers, each blitted to
+/// the drawable's texture when its frame ends.
+@interface CGRendererContext : RenderContext
+- (instancetype)initWithBufferRingDepth:(NSUInteger)depth
+                        blockingAcquire:(BOOL)blocking;
+/// Takes ownership of a free buffer for the CPU. When every buffer is owned
+/// by the GPU, waits for one to be released, or, if acquires are not
+/// blocking, returns NO and counts the frame as skipped.
+- (BOOL)acquireBuffer;
+/// Hands an acquired buffer back without the GPU having read it.
+- (void)releaseBuffer;
+/// Hands an acquired buffer to the GPU until commandBuffer completes. Must be
+/// called before commandBuffer is committed.
+- (void)releaseBufferOnCompletionOfCommandBuffer:
+    (id<MTLCommandBuffer>)commandBuffer;
 @end
 
 NS_ASSUME_NONNULL_END
@@ -24,6 +24,13 @@ typedef NS_ENUM(NSInteger, RendererType) { riveRenderer, cgRenderer };
 - (RenderContext*)newDefaultContext;
 - (RenderContext*)newRiveContext;
 - (RenderContext*)newCGContext;
+/// Returns a new CoreGraphics context that stages each frame in one of `depth`
+/// shared buffers. A buffer is owned by the GPU from the moment its blit is
+/// committed until the command buffer completes; a depth of 0 is treated as 1.
+/// When `blocking` is NO, beginning a frame while every buffer is owned by the
+/// GPU skips the frame rather than waiting for a buffer to be released.
+- (RenderContext*)newCGContextWithBufferRingDepth:(NSUInteger)depth
+                                 blockingAcquire:(BOOL)blocking;
 @end
 
 #endif
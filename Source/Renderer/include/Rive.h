@@ -13,6 +13,10 @@
 #import <CoreGraphics/CoreGraphics.h>
 
 #import <RiveRuntime/RiveFile.h>
+#import <RiveRuntime/RiveFileStreamImporter.h>
+#import <RiveRuntime/RiveFileCache.h>
+#import <RiveRuntime/RiveFileMetadata.h>
+#import <RiveRuntime/RiveFileMetadataCache.h>
 #import <RiveRuntime/RiveArtboard.h>
 #import <RiveRuntime/RiveBindableArtboard.h>
 #import <RiveRuntime/RiveSMIInput.h>
@@ -24,9 +28,11 @@
 #import <RiveRuntime/RenderContextManager.h>
 // TODO: fix our headers so these can become exposed here
 #import <RiveRuntime/RiveFactory.h>
+#import <RiveRuntime/RiveDownsampledImageData.h>
 #import <RiveRuntime/RiveFileAsset.h>
 #import <RiveRuntime/RiveFileAssetLoader.h>
 #import <RiveRuntime/CDNFileAssetLoader.h>
+#import <RiveRuntime/RiveCDNAssetCache.h>
 #import <RiveRuntime/RiveFont.h>
 
 #import <RiveRuntime/RiveDataBindingViewModel.h>
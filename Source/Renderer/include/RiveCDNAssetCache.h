@@ -0,0 +1,103 @@
+//
+//  RiveCDNAssetCache.h
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#ifndef rive_cdn_asset_cache_h
+#define rive_cdn_asset_cache_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef void (^RiveCDNAssetCompletion)(NSData* _Nullable data,
+                                       NSError* _Nullable error);
+
+/// A request for a CDN hosted asset, returned by RiveCDNAssetCache.
+@interface RiveCDNAssetRequest : NSObject
+/// Cancels the request. Its completion is called with NSURLErrorCancelled,
+/// unless it has already been called. The download itself is cancelled only
+/// once every request for the asset has been cancelled.
+- (void)cancel;
+- (instancetype)init NS_UNAVAILABLE;
+@end
+
+/*
+ * RiveCDNAssetCache
+ *
+ * A content-addressed, on-disk cache of assets hosted on the Rive CDN, keyed
+ * by their CDN UUID. CDNFileAssetLoader fetches every asset through the shared
+ * cache, so an asset referenced by several files, or loaded on every launch,
+ * is downloaded once.
+ *
+ * Cached assets are revalidated with a conditional request (If-None-Match /
+ * If-Modified-Since) once they are older than the revalidation interval; if
+ * revalidation fails, the cached asset is used. Concurrent requests for the
+ * same UUID share a single download, at most maximumConcurrentDownloads
+ * downloads run at once, and once the cached assets exceed the disk budget,
+ * the least recently used are deleted.
+ */
+@interface RiveCDNAssetCache : NSObject
+
+/// The cache used by CDNFileAssetLoader, stored in the app's caches
+/// directory.
+@property(class, nonatomic, readonly) RiveCDNAssetCache* shared;
+
+/// The directory cached assets are stored in.
+@property(nonatomic, readonly) NSURL* directoryURL;
+
+/// The maximum number of downloads that run at once. Defaults to 4. May be
+/// set from any thread.
+@property(atomic) NSUInteger maximumConcurrentDownloads;
+
+/// The total size, in bytes, that cached assets may occupy on disk before
+/// the least recently used are deleted. Defaults to 64 MB. May be set from
+/// any thread, and applies from the next asset stored.
+@property(atomic) NSUInteger diskBudget;
+
+/// How long a cached asset is used before being revalidated with the CDN.
+/// Defaults to one day. May be set from any thread.
+@property(atomic) NSTimeInterval revalidationInterval;
+
+/// The total size, in bytes, of the cached assets.
+@property(nonatomic, readonly) NSUInteger totalByteCount;
+
+/// The number of requests served from disk without a network request.
+@property(nonatomic, readonly) NSUInteger hitCount;
+
+/// The number of cached assets the CDN confirmed were unchanged.
+@property(nonatomic, readonly) NSUInteger revalidationCount;
+
+/// The number of assets downloaded.
+@property(nonatomic, readonly) NSUInteger downloadCount;
+
+/// The number of requests that joined a fetch already in flight.
+@property(nonatomic, readonly) NSUInteger coalescedCount;
+
+/// Creates a cache storing assets in the given directory, downloading with a
+/// session created from the given configuration.
+- (instancetype)initWithDirectoryURL:(NSURL*)directoryURL
+                sessionConfiguration:
+                    (NSURLSessionConfiguration*)sessionConfiguration;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Fetches the asset with the given UUID from the cache, or from url. The
+/// completion is called on a background queue.
+- (RiveCDNAssetRequest*)fetchAssetWithUUID:(NSString*)uuid
+                                       url:(NSURL*)url
+                                completion:(RiveCDNAssetCompletion)completion;
+
+/// Deletes every cached asset. Fetches in flight are not affected.
+- (void)removeAllAssets;
+
+/// Resets the hit, revalidation, download and coalesced counters to zero.
+- (void)resetStatistics;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* rive_cdn_asset_cache_h */
@@ -0,0 +1,58 @@
+//
+//  RiveDownsampledImageData.h
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#ifndef rive_downsampled_image_data_h
+#define rive_downsampled_image_data_h
+
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*
+ * RiveDownsampledImageData
+ *
+ * Encoded image data reduced to the size it is displayed at, so that it is
+ * decoded and uploaded to the GPU at that size rather than at full
+ * resolution.
+ *
+ * Images are only ever reduced by powers of two, to the smallest size that
+ * still covers the requested size. This keeps downsampling a box filter,
+ * lets JPEG images be decoded directly at the reduced size, and keeps the
+ * reduced image's mipmaps aligned with the original's. Images that already
+ * fit are left untouched.
+ *
+ * Memory savings are estimated for RGBA8 images: the decoded bitmap on the
+ * CPU, and the texture with its full mipmap chain on the GPU.
+ */
+@interface RiveDownsampledImageData : NSObject
+
+/// The encoded image to decode. This is the original data when the image
+/// was not reduced.
+@property(nonatomic, readonly) NSData* data;
+/// The size, in pixels, of the original image.
+@property(nonatomic, readonly) CGSize sourcePixelSize;
+/// The size, in pixels, of the image in data.
+@property(nonatomic, readonly) CGSize pixelSize;
+/// The estimated bitmap memory saved on the CPU, in bytes.
+@property(nonatomic, readonly) NSUInteger savedCPUByteCount;
+/// The estimated texture memory saved on the GPU, in bytes.
+@property(nonatomic, readonly) NSUInteger savedGPUByteCount;
+
+/// Reduces encoded image data so that it covers, but need not fit within,
+/// maximumPixelSize. A zero dimension leaves that axis unconstrained.
+/// Returns nil if the data is not an image.
+- (nullable instancetype)initWithData:(NSData*)data
+                     maximumPixelSize:(CGSize)maximumPixelSize;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* rive_downsampled_image_data_h */
@@ -10,6 +10,7 @@
 #define RiveFactory_h
 
 #import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
 
 #if TARGET_OS_IPHONE
 #import <UIKit/UIFont.h>
@@ -18,11 +19,22 @@
 #endif
 
 @class RiveFont;
+@class RiveImageAsset;
 
 NS_ASSUME_NONNULL_BEGIN
 
 @interface RiveRenderImage : NSObject
 - (nullable instancetype)initWithData:(NSData*)data;
+/// The size, in pixels, the image was decoded at. Zero unless the image was
+/// decoded with a maximum pixel size.
+@property(nonatomic, readonly) CGSize pixelSize;
+/// The size, in pixels, of the encoded image. Zero unless the image was
+/// decoded with a maximum pixel size.
+@property(nonatomic, readonly) CGSize sourcePixelSize;
+/// The estimated CPU bitmap memory saved by downsampling, in bytes.
+@property(nonatomic, readonly) NSUInteger savedCPUByteCount;
+/// The estimated GPU texture memory saved by downsampling, in bytes.
+@property(nonatomic, readonly) NSUInteger savedGPUByteCount;
 @end
 
 @interface RiveAudio : NSObject
@@ -39,6 +51,12 @@ NS_ASSUME_NONNULL_BEGIN
 - (nullable RiveFont*)decodeNSFont:(NSFont*)data NS_SWIFT_NAME(decodeFont(_:));
 #endif
 - (RiveRenderImage*)decodeImage:(NSData*)data;
+/// Decodes an image reduced to the smallest power of two fraction of its size
+/// that still covers maximumPixelSize; see RiveDownsampledImageData.
+- (RiveRenderImage*)decodeImage:(NSData*)data
+               maximumPixelSize:(CGSize)maximumPixelSize;
+/// Creates an audio source from encoded audio data. The data is handed to the
+/// runtime as is; decoding for playback is left to the runtime's audio engine.
 - (nullable RiveAudio*)decodeAudio:(NSData*)data;
 @end
 
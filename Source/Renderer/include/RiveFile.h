@@ -19,9 +19,36 @@ NS_ASSUME_NONNULL_BEGIN
 @class RiveFactory;
 @class RiveDataBindingViewModel;
 @class RiveBindableArtboard;
+@class RiveFileMetadata;
+@class RiveFile;
+/// Loads the contents of an asset during import. For embedded assets, data
+/// references the bytes of the file being imported without copying them, and
+/// is only valid until the block returns; copy it to use it later.
 typedef bool (^LoadAsset)(RiveFileAsset* asset,
                           NSData* data,
                           RiveFactory* factory);
+typedef void (^RiveFileImportCompletion)(RiveFile* _Nullable file,
+                                         NSError* _Nullable error);
+
+/*
+ * RiveFileImportTask
+ *
+ * A handle to a file being imported asynchronously, which can be used to
+ * cancel the import.
+ */
+@interface RiveFileImportTask : NSObject
+
+/// Whether the import has been cancelled.
+@property(readonly, getter=isCancelled) BOOL cancelled;
+
+/// Cancels the import. If the import has not started parsing yet, it is
+/// skipped entirely; otherwise parsing runs to completion and the result is
+/// discarded. When called on the main thread, the completion handler is
+/// guaranteed not to be called afterwards; when called on any other thread,
+/// a completion that is already being delivered may still be called.
+- (void)cancel;
+
+@end
 
 /*
  * RiveFile
@@ -37,9 +64,19 @@ typedef bool (^LoadAsset)(RiveFileAsset* asset,
 /// Delegate for calling when a file has finished loading
 @property(weak) id delegate;
 
+/// Identifies the imported file this RiveFile reads from. RiveFiles that
+/// share an import through RiveFileCache have the same identifier. Zero until
+/// the file has loaded.
+@property(nonatomic, readonly) NSUInteger importIdentifier;
+
 /// The number of view models in the file.
 @property(nonatomic, readonly) NSUInteger viewModelCount;
 
+/// An index of the artboards, state machines and view models in the file.
+/// The index is built from the file's definitions the first time it is
+/// accessed, without instantiating any artboard or state machine.
+@property(nonatomic, readonly) RiveFileMetadata* metadata;
+
 /// Used to manage url sessions Rive, this is to enable testing.
 - (nullable instancetype)initWithByteArray:(NSArray*)bytes
                                    loadCdn:(bool)cdn
@@ -85,6 +122,17 @@ typedef bool (^LoadAsset)(RiveFileAsset* asset,
                         customAssetLoader:(LoadAsset)customAssetLoader
                                     error:(NSError**)error;
 
+/// Creates a file from a .riv on disk, such as one in a bundle or a disk
+/// cache. The file is memory-mapped read-only and imported without being
+/// copied into the heap.
+- (nullable instancetype)initWithFileURL:(NSURL*)fileURL
+                                 loadCdn:(bool)cdn
+                                   error:(NSError**)error;
+- (nullable instancetype)initWithFileURL:(NSURL*)fileURL
+                                 loadCdn:(bool)cdn
+                       customAssetLoader:(LoadAsset)customAssetLoader
+                                   error:(NSError**)error;
+
 - (nullable instancetype)initWithHttpUrl:(NSString*)url
                                  loadCdn:(bool)cdn
                             withDelegate:(id<RiveFileDelegate>)delegate;
@@ -93,6 +141,38 @@ typedef bool (^LoadAsset)(RiveFileAsset* asset,
                        customAssetLoader:(LoadAsset)customAssetLoader
                             withDelegate:(id<RiveFileDelegate>)delegate;
 
+#pragma mark - Asynchronous Import
+
+/// Imports a file from bytes on a background queue, and calls completion on
+/// the main queue with either the file or the error that prevented it from
+/// loading. Parsing never blocks the calling thread.
+///
+/// Any number of files may be imported concurrently, from any thread. The
+/// data must not be mutated until the completion has been called. The custom
+/// asset loader, if any, is called on the background queue the file is being
+/// parsed on. The delivered file should then be used from one thread at a
+/// time, like any other RiveFile.
++ (RiveFileImportTask*)importData:(NSData*)data
+                          loadCdn:(bool)cdn
+                customAssetLoader:(nullable LoadAsset)customAssetLoader
+                       completion:(RiveFileImportCompletion)completion;
+
+/// Imports a file from a .riv on disk on a background queue. Reading the
+/// file, as well as parsing it, happens off the calling thread. See
+/// importData:loadCdn:customAssetLoader:completion: for thread safety.
++ (RiveFileImportTask*)importFileURL:(NSURL*)fileURL
+                             loadCdn:(bool)cdn
+                   customAssetLoader:(nullable LoadAsset)customAssetLoader
+                          completion:(RiveFileImportCompletion)completion;
+
+/// Imports a file from a resource in the main bundle on a background queue.
+/// See importData:loadCdn:customAssetLoader:completion: for thread safety.
++ (RiveFileImportTask*)importResource:(NSString*)resourceName
+                        withExtension:(NSString*)extension
+                              loadCdn:(bool)cdn
+                    customAssetLoader:(nullable LoadAsset)customAssetLoader
+                           completion:(RiveFileImportCompletion)completion;
+
 /// Returns a reference to the default artboard
 - (RiveArtboard* __nullable)artboard:(NSError**)error;
 
@@ -15,6 +15,9 @@
 @class RiveFileAsset;
 
 @interface RiveFileAssetLoader : NSObject
+/// Loads the contents of an asset. For embedded assets, data references the
+/// bytes of the file being imported without copying them, and is only valid
+/// until this method returns; copy it to use it later.
 - (BOOL)loadContentsWithAsset:(RiveFileAsset*)asset
                       andData:(NSData*)data
                    andFactory:(RiveFactory*)factory;
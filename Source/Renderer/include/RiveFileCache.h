@@ -0,0 +1,80 @@
+//
+//  RiveFileCache.h
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#ifndef rive_file_cache_h
+#define rive_file_cache_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*
+ * RiveFileCache
+ *
+ * A process-wide cache of imported Rive files. RiveFiles created from the same
+ * bytes, with the same CDN setting and renderer, share a single imported file
+ * rather than each parsing the bytes again; instantiating artboards from a
+ * cached file skips parsing entirely.
+ *
+ * Files are keyed by a SHA-256 hash of their contents plus their loader
+ * configuration. Files imported with a custom asset loader are never cached,
+ * since their assets are provided by the caller and may differ between
+ * imports.
+ *
+ * Cached files are reference counted by the RiveFiles using them. Once the
+ * total size of cached files exceeds the memory budget, files that are no
+ * longer used by any RiveFile are evicted, least recently used first. Files
+ * still in use are never evicted.
+ *
+ * The cache is disabled by default. RiveFiles that share a cached file share
+ * its state, including its view models and assets, and a file must not be
+ * used from more than one thread at a time. Only enable the cache if every
+ * RiveFile created from the same bytes, and everything instantiated from
+ * them, is used from one thread at a time, e.g. only from the main thread.
+ */
+@interface RiveFileCache : NSObject
+
+/// The cache shared by every RiveFile in the process.
+@property(class, nonatomic, readonly) RiveFileCache* shared;
+
+/// Whether newly created RiveFiles look up and populate the cache. Defaults
+/// to NO, in which case imports neither hash their bytes nor share files.
+/// Disabling the cache does not evict files that are already cached.
+@property(atomic, getter=isEnabled) BOOL enabled;
+
+/// The total size, in bytes, of the .riv data that unused files may occupy
+/// before they are evicted. Defaults to 32 MB.
+@property(nonatomic) NSUInteger memoryBudget;
+
+/// The number of files currently cached, whether in use or not.
+@property(nonatomic, readonly) NSUInteger fileCount;
+
+/// The total size, in bytes, of the .riv data of every cached file.
+@property(nonatomic, readonly) NSUInteger totalByteCount;
+
+/// The number of imports that were served from the cache.
+@property(nonatomic, readonly) NSUInteger hitCount;
+
+/// The number of cacheable imports that had to parse the file.
+@property(nonatomic, readonly) NSUInteger missCount;
+
+/// The number of files evicted to stay within the memory budget.
+@property(nonatomic, readonly) NSUInteger evictionCount;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Evicts every cached file that is not in use by a RiveFile.
+- (void)removeAllUnusedFiles;
+
+/// Resets the hit, miss and eviction counters to zero.
+- (void)resetStatistics;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* rive_file_cache_h */
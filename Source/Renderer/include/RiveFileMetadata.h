@@ -0,0 +1,91 @@
+//
+//  RiveFileMetadata.h
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#ifndef rive_file_metadata_h
+#define rive_file_metadata_h
+
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+#import <RiveRuntime/RiveDataBindingViewModelInstancePropertyData.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, RiveStateMachineInputType) {
+    RiveStateMachineInputTypeBoolean,
+    RiveStateMachineInputTypeNumber,
+    RiveStateMachineInputTypeTrigger,
+} NS_SWIFT_NAME(RiveStateMachineInputMetadata.InputType);
+
+/// Describes a state machine input, without instantiating its state machine.
+@interface RiveStateMachineInputMetadata : NSObject <NSSecureCoding>
+/// The name of the input.
+@property(nonatomic, readonly) NSString* name;
+/// The type of the input.
+@property(nonatomic, readonly) RiveStateMachineInputType type;
+@end
+
+/// Describes a state machine, without instantiating it.
+@interface RiveStateMachineMetadata : NSObject <NSSecureCoding>
+/// The name of the state machine.
+@property(nonatomic, readonly) NSString* name;
+/// The inputs of the state machine, in file order.
+@property(nonatomic, readonly) NSArray<RiveStateMachineInputMetadata*>* inputs;
+@end
+
+/// Describes an artboard, without instantiating it.
+@interface RiveArtboardMetadata : NSObject <NSSecureCoding>
+/// The name of the artboard.
+@property(nonatomic, readonly) NSString* name;
+/// The width of the artboard, as authored in the editor.
+@property(nonatomic, readonly) CGFloat width;
+/// The height of the artboard, as authored in the editor.
+@property(nonatomic, readonly) CGFloat height;
+/// The names of the linear animations in the artboard.
+@property(nonatomic, readonly) NSArray<NSString*>* animationNames;
+/// The state machines in the artboard.
+@property(nonatomic, readonly) NSArray<RiveStateMachineMetadata*>* stateMachines;
+@end
+
+/// Describes the schema of a view model, without creating an instance of it.
+@interface RiveViewModelMetadata : NSObject <NSSecureCoding>
+/// The name of the view model.
+@property(nonatomic, readonly) NSString* name;
+/// The properties of the view model.
+@property(nonatomic, readonly)
+    NSArray<RiveDataBindingViewModelInstancePropertyData*>* properties;
+/// The names of the instances of the view model authored in the editor.
+@property(nonatomic, readonly) NSArray<NSString*>* instanceNames;
+@end
+
+/*
+ * RiveFileMetadata
+ *
+ * A lightweight index of the contents of a file: its artboards with their
+ * sizes, animations and state machine inputs, and its view model schemas.
+ * The index is read from the file's definitions, so no artboard, state
+ * machine or view model instance is created to build it.
+ *
+ * Metadata supports secure coding, so that it can be persisted and read back
+ * without importing the file again; see RiveFileMetadataCache.
+ */
+@interface RiveFileMetadata : NSObject <NSSecureCoding>
+/// The artboards in the file, in file order.
+@property(nonatomic, readonly) NSArray<RiveArtboardMetadata*>* artboards;
+/// The view models in the file, in file order.
+@property(nonatomic, readonly) NSArray<RiveViewModelMetadata*>* viewModels;
+
+/// Returns the artboard with the given name, or nil.
+- (nullable RiveArtboardMetadata*)artboardNamed:(NSString*)name;
+/// Returns the view model with the given name, or nil.
+- (nullable RiveViewModelMetadata*)viewModelNamed:(NSString*)name;
+
+- (instancetype)init NS_UNAVAILABLE;
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* rive_file_metadata_h */
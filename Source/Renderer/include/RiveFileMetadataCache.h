@@ -0,0 +1,75 @@
+//
+//  RiveFileMetadataCache.h
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#ifndef rive_file_metadata_cache_h
+#define rive_file_metadata_cache_h
+
+#import <Foundation/Foundation.h>
+
+@class RiveFileMetadata;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*
+ * RiveFileMetadataCache
+ *
+ * An opt-in, on-disk cache of the metadata index of Rive files. Once a
+ * RiveFile's metadata has been built, it is written in the background to a
+ * versioned binary sidecar keyed by a SHA-256 hash of the file's contents,
+ * unless one already exists. On later launches, the artboard names and sizes,
+ * state machine inputs and view model schemas of the file can be read back
+ * with metadataForData: without importing it. A RiveFile that has been
+ * imported builds its metadata from the file in memory, which is cheaper
+ * than reading the sidecar.
+ *
+ * Each sidecar records the runtime's major and minor file format versions.
+ * Sidecars written by a different runtime version, or that are truncated or
+ * otherwise unreadable, are treated as misses and deleted.
+ *
+ * The cache does not store the imported file itself: instantiating artboards
+ * still requires importing the file.
+ */
+@interface RiveFileMetadataCache : NSObject
+
+/// The cache shared by every RiveFile in the process, stored in the app's
+/// caches directory.
+@property(class, nonatomic, readonly) RiveFileMetadataCache* shared;
+
+/// Whether RiveFiles read and write metadata through this cache. Defaults to
+/// NO.
+@property(atomic, getter=isEnabled) BOOL enabled;
+
+/// The directory sidecars are stored in.
+@property(nonatomic, readonly) NSURL* directoryURL;
+
+/// The number of lookups that were served from disk.
+@property(nonatomic, readonly) NSUInteger hitCount;
+
+/// The number of lookups that found no valid sidecar.
+@property(nonatomic, readonly) NSUInteger missCount;
+
+/// Creates a cache storing sidecars in the given directory, which is created
+/// when the first sidecar is written. Caches created this way are enabled.
+- (instancetype)initWithDirectoryURL:(NSURL*)directoryURL;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Returns the cached metadata of the file with the given contents, or nil if
+/// it has not been cached by this runtime version. Does not import the file.
+- (nullable RiveFileMetadata*)metadataForData:(NSData*)data;
+
+/// Deletes every sidecar.
+- (void)removeAllMetadata;
+
+/// Resets the hit and miss counters to zero.
+- (void)resetStatistics;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* rive_file_metadata_cache_h */
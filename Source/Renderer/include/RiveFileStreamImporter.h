@@ -0,0 +1,111 @@
+//
+//  RiveFileStreamImporter.h
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#ifndef rive_file_stream_importer_h
+#define rive_file_stream_importer_h
+
+#import <Foundation/Foundation.h>
+#import <RiveRuntime/RiveFile.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class RiveFileStreamImporter;
+
+/*
+ * Delegate to inform about the progress of a streaming import. All delegate
+ * methods are called on the main queue, in order. The importer stays alive
+ * until its pending delegate calls have been made, even if released sooner.
+ */
+@protocol RiveFileStreamImporterDelegate <NSObject>
+@optional
+/// Called once the file header has arrived and its version has been
+/// validated. No other bytes of the file are required for this.
+- (void)riveFileStreamImporter:(RiveFileStreamImporter*)importer
+    didReadHeaderWithMajorVersion:(uint)majorVersion
+                     minorVersion:(uint)minorVersion;
+
+/// Called once the first artboard has fully arrived, before the rest of the
+/// file has been downloaded. The provisional file contains only the
+/// artboards, assets and view models that precede the second artboard, and
+/// can be used to draw a first frame until the complete file is delivered.
+///
+/// The first artboard is known to be complete only once the second one
+/// starts, so this is not called for a file with a single artboard; the
+/// complete file is its first file delivered. It is also skipped if the
+/// provisional import fails. The provisional file is imported on a
+/// background queue, so it does not hold up the source of the bytes.
+- (void)riveFileStreamImporter:(RiveFileStreamImporter*)importer
+    didImportProvisionalFile:(RiveFile*)file;
+
+/// Called once every byte has arrived and the complete file was imported.
+- (void)riveFileStreamImporter:(RiveFileStreamImporter*)importer
+               didImportFile:(RiveFile*)file;
+
+/// Called if the stream fails, or the file is malformed or of an
+/// unsupported version. No further delegate methods are called afterwards.
+- (void)riveFileStreamImporter:(RiveFileStreamImporter*)importer
+              didFailWithError:(NSError*)error;
+@end
+
+/*
+ * RiveFileStreamImporter
+ *
+ * Imports a .riv file while its bytes are still arriving from a chunked
+ * source, such as a URLSession data delegate or an NSInputStream. Bytes are
+ * accumulated in a single buffer as they arrive, and the object stream is
+ * scanned incrementally so that the header and the first artboard can be
+ * surfaced before the source has finished.
+ *
+ * The importer can be used directly as the delegate of a URLSession, or fed
+ * manually with appendData: followed by finish. Appending bytes and finishing
+ * must happen on one thread at a time; cancel may be called from any thread.
+ *
+ * The custom asset loader may be invoked twice for an asset that precedes the
+ * first artboard: once for the provisional file, and once for the complete
+ * file. CDN assets are only loaded for the complete file.
+ */
+@interface RiveFileStreamImporter : NSObject <NSURLSessionDataDelegate>
+
+@property(nonatomic, weak, nullable) id<RiveFileStreamImporterDelegate>
+    delegate;
+
+/// The number of bytes received so far.
+@property(nonatomic, readonly) NSUInteger bytesReceived;
+
+/// The number of artboards whose first byte has been received so far.
+@property(nonatomic, readonly) NSUInteger artboardsReceived;
+
+- (instancetype)initWithLoadCdn:(bool)cdn;
+- (instancetype)initWithLoadCdn:(bool)cdn
+              customAssetLoader:(nullable LoadAsset)customAssetLoader
+    NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Reserves space for the complete file, if its length is known up front.
+- (void)expectLength:(NSUInteger)length;
+
+/// Appends the next chunk of the file. Returns NO once the import has failed
+/// or been cancelled, at which point the caller should stop its source.
+- (BOOL)appendData:(NSData*)data;
+
+/// Signals that every byte of the file has been appended, and imports the
+/// complete file.
+- (void)finish;
+
+/// Stops the import. No further delegate methods are called.
+- (void)cancel;
+
+/// Reads the stream to its end on the calling thread, appending each chunk
+/// as it arrives, then finishes the import. The stream is opened if needed
+/// and closed when done. Intended to be called from a background queue.
+- (void)importFromInputStream:(NSInputStream*)stream;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* rive_file_stream_importer_h */
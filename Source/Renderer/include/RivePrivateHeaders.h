@@ -93,6 +93,14 @@ NS_ASSUME_NONNULL_BEGIN
 @interface RiveEvent ()
 - (instancetype)initWithRiveEvent:(const rive::Event*)riveEvent
                             delay:(float)delay;
+/// Creates an event from values copied out of the runtime. url and
+/// targetValue are only used by RiveOpenUrlEvent.
+- (instancetype)initWithName:(NSString*)name
+                        type:(NSInteger)type
+                       delay:(float)delay
+                  properties:(nullable NSDictionary<NSString*, id>*)properties
+                         url:(NSString*)url
+                 targetValue:(uint32_t)targetValue;
 @end
 
 /*
@@ -171,6 +179,8 @@ NS_ASSUME_NONNULL_BEGIN
                             useSystemShaper:(BOOL)useSystemShaper;
 - (instancetype)initWithFont:(rive::rcp<rive::Font>)font;
 - (rive::rcp<rive::Font>)instance;
+/// The number of fallback fonts resolved since the fallbacks last changed.
++ (NSUInteger)cachedFallbackFontCount;
 @end
 
 @interface RiveRenderImage ()
@@ -253,6 +263,47 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)initWithArtboard:(rive::ViewModelInstanceArtboardRuntime*)list;
 @end
 
+/*
+ * RiveFileCacheEntry
+ */
+@interface RiveFileCacheEntry : NSObject
+@property(nonatomic, readonly) RenderContext* renderContext;
+- (rive::rcp<rive::File>)file;
+@end
+
+@interface RiveFileCache ()
+/// Returns the hex SHA-256 digest of a file's contents.
++ (NSString*)contentHashForBytes:(const uint8_t*)bytes
+                          length:(NSUInteger)length;
++ (NSString*)keyForContentHash:(NSString*)contentHash loadCdn:(bool)loadCdn;
+/// Returns the entry cached under key, marking it as in use, or nil.
+- (nullable RiveFileCacheEntry*)acquireEntryForKey:(NSString*)key;
+/// Caches a newly imported file and returns its entry, marked as in use. If
+/// the key was cached concurrently, the existing entry is returned instead.
+- (RiveFileCacheEntry*)
+       insertFile:(rive::rcp<rive::File>)file
+      assetLoader:(rive::rcp<rive::FileAssetLoader>)assetLoader
+    fallbackLoader:(FallbackFileAssetLoader*)fallbackLoader
+    renderContext:(RenderContext*)renderContext
+        byteCount:(NSUInteger)byteCount
+           forKey:(NSString*)key;
+/// Marks an entry returned by acquire or insert as no longer in use.
+- (void)releaseEntry:(RiveFileCacheEntry*)entry;
+@end
+
+@interface RiveFileMetadata ()
+- (instancetype)initWithFile:(rive::File*)file;
+@end
+
+@interface RiveFileMetadataCache ()
+/// Returns the metadata stored for the given content hash, or nil.
+- (nullable RiveFileMetadata*)metadataForContentHash:(NSString*)contentHash;
+/// Archives and writes metadata for the given content hash on a background
+/// queue, unless a sidecar for this runtime version already exists.
+- (void)storeMetadata:(RiveFileMetadata*)metadata
+       forContentHash:(NSString*)contentHash;
+@end
+
 @interface RiveBindableArtboard ()
 - (rive::rcp<rive::BindableArtboard>)bindableArtboard;
 - (instancetype)initWithBindableArtboard:
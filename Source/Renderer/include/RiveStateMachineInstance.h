@@ -25,6 +25,22 @@ NS_ASSUME_NONNULL_BEGIN
 /// A type mirroring rive::HitResult, but available in both ObjC and Swift.
 typedef NS_ENUM(NSInteger, RiveHitResult) { none, hit, hitOpaque };
 
+/// Kinds of report in a state machine's report channel.
+typedef NS_OPTIONS(NSUInteger, RiveStateMachineReportKind) {
+    RiveStateMachineReportKindEvent = 1 << 0,
+    RiveStateMachineReportKindStateChange = 1 << 1,
+};
+
+/// An event reported by, or a state entered by, a state machine.
+typedef struct
+{
+    /// Unique across state machines, and increasing in the order reported.
+    uint64_t identifier;
+    RiveStateMachineReportKind kind;
+    /// For events, the seconds since they were fired.
+    float delay;
+} RiveStateMachineReport;
+
 /*
  * RiveStateMachineInstance
  */
@@ -35,6 +51,15 @@ typedef NS_ENUM(NSInteger, RiveHitResult) { none, hit, hitOpaque };
 
 - (NSString*)name;
 - (bool)advanceBy:(double)elapsedSeconds;
+/// Advances like advanceBy:, without logging the advance. Unlike
+/// advanceBy:, may be called off the main thread, provided nothing else uses
+/// this state machine, its artboard, its file or its view model instances
+/// until it returns.
+- (bool)advanceUnloggedBy:(double)elapsedSeconds;
+/// Identifiers of the bound view model instance and of every instance nested
+/// in it, at any depth. State machines whose identifiers overlap share view
+/// model state, and so must not be advanced at the same time.
+- (NSSet<NSNumber*>*)viewModelInstanceIdentifiers;
 - (const RiveSMIBool*)getBool:(NSString*)name;
 - (const RiveSMITrigger*)getTrigger:(NSString*)name;
 - (const RiveSMINumber*)getNumber:(NSString*)name;
@@ -45,6 +70,28 @@ typedef NS_ENUM(NSInteger, RiveHitResult) { none, hit, hitOpaque };
                                      error:(NSError**)error;
 - (RiveSMIInput* __nullable)inputFromName:(NSString*)name
                                     error:(NSError**)error;
+
+// MARK: Indexed Inputs
+
+/// Returns the index of the input with the given name, or NSNotFound.
+///
+/// Resolve an index once, e.g. when setting up a gesture handler, then set
+/// and get the input by index. Indexed access does not format strings, look
+/// up dictionaries, or allocate, so it is suitable for per-frame updates.
+- (NSInteger)inputIndexForName:(NSString*)name;
+/// Sets the boolean input at index.
+/// @return false if there is no boolean input at index.
+- (bool)setBool:(bool)value atIndex:(NSInteger)index;
+/// Returns the value of the boolean input at index, or false if there is none.
+- (bool)boolAtIndex:(NSInteger)index;
+/// Sets the number input at index.
+/// @return false if there is no number input at index.
+- (bool)setNumber:(float)value atIndex:(NSInteger)index;
+/// Returns the value of the number input at index, or 0 if there is none.
+- (float)numberAtIndex:(NSInteger)index;
+/// Fires the trigger input at index.
+/// @return false if there is no trigger input at index.
+- (bool)fireTriggerAtIndex:(NSInteger)index;
 - (NSInteger)stateChangedCount;
 - (RiveLayerState* __nullable)stateChangedFromIndex:(NSInteger)index
                                               error:(NSError**)error;
@@ -54,6 +101,36 @@ typedef NS_ENUM(NSInteger, RiveHitResult) { none, hit, hitOpaque };
 /// Returns a RiveEvent from the list of reported events at the given index
 - (const RiveEvent*)reportedEventAt:(NSInteger)index;
 
+// MARK: Reports
+
+/// Copies up to capacity reports newer than identifier, and of one of kinds,
+/// into buffer, oldest first, and returns the number copied.
+///
+/// Unlike stateChanges and reportedEventAt:, reading reports creates no
+/// objects, so it can be polled after every advance. Pass 0 to read from the
+/// oldest report held, then the identifier of the last report read. Reports
+/// are held until the advance after the one following them, at least, so
+/// reading once per advance misses none.
+- (NSUInteger)readReportsAfter:(uint64_t)identifier
+                         kinds:(RiveStateMachineReportKind)kinds
+                          into:(RiveStateMachineReport*)buffer
+                      capacity:(NSUInteger)capacity
+    NS_SWIFT_NAME(readReports(after:kinds:into:capacity:));
+/// The identifier of the newest report, or 0 if there are none. Reading after
+/// it yields only what is reported from now on.
+- (uint64_t)lastReportIdentifier;
+/// The identifier of the newest report made before the latest advance, or 0
+/// if there has been none. Reading after it yields the reports not yet
+/// cleared from the state machine: those of its latest advance, and any made
+/// since, as reportedEventAt: and stateChanges return them.
+- (uint64_t)reportIdentifierBeforeLatestAdvance;
+/// Returns the event of a report, or nil if it is not an event report or is
+/// no longer held. The event is a copy, and outlives the artboard.
+- (RiveEvent* __nullable)eventForReport:(uint64_t)identifier;
+/// Returns the name of the state a report entered, as stateChanges names it,
+/// or nil if it is not a state change report or is no longer held.
+- (NSString* __nullable)stateNameForReport:(uint64_t)identifier;
+
 // MARK: Touch
 
 /// Tells this StateMachineInstance that a user began touching the artboard
@@ -0,0 +1,127 @@
+//
+//  StateMachineEventChannel.hpp
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+#ifndef StateMachineEventChannel_hpp
+#define StateMachineEventChannel_hpp
+
+#include "rive/animation/state_machine_instance.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rive
+{
+
+/**
+ * Records the events a state machine instance reports, and the states it
+ * enters, in a ring buffer, so that they can be read after the instance has
+ * moved on.
+ *
+ * Each report gets an id that is unique across all channels and increases in
+ * the order reports are collected. Readers keep the id of the last report they
+ * read and pull newer ones into a buffer of their own, so polling allocates
+ * nothing, and costs little more than two comparisons when nothing has been
+ * reported. Reports copy what they need of the runtime's events and states,
+ * so they stay valid once the artboard that reported them is gone.
+ *
+ * The ring holds every report collected since the advance before the latest
+ * one, growing if it has to, so a reader that polls at least once per advance
+ * never misses a report. Older reports are overwritten once the ring is full.
+ */
+class StateMachineEventChannel
+{
+public:
+    /// Kinds of report, which can be combined into a mask for read().
+    enum class Kind : uint32_t
+    {
+        event = 1 << 0,
+        stateChange = 1 << 1,
+    };
+
+    /// A custom property of an event.
+    struct Property
+    {
+        std::string name;
+        uint16_t typeKey = 0;
+        bool boolValue = false;
+        float numberValue = 0;
+        std::string stringValue;
+    };
+
+    struct Report
+    {
+        uint64_t id = 0;
+        Kind kind = Kind::event;
+        /// The event's or the state's type key.
+        uint16_t typeKey = 0;
+        /// For events, the seconds since they were fired.
+        float delay = 0;
+        /// For events, their name. For animation states, their animation's
+        /// name, or empty if they have none.
+        std::string name;
+        /// For open URL events, their URL and target.
+        std::string url;
+        uint32_t target = 0;
+        /// For events, their named custom properties.
+        std::vector<Property> properties;
+        /// The number of advances made before the report was collected.
+        uint64_t advance = 0;
+    };
+
+    /// The number of reports held before the ring first has to grow.
+    static constexpr size_t initialCapacity = 64;
+
+    StateMachineEventChannel();
+
+    /// Appends what instance has reported since the last call. Reports are
+    /// cleared by each advance, so this must be called before advancing it,
+    /// and advanced() after.
+    void collect(StateMachineInstance* instance);
+
+    /// Notes that the instance has been advanced, and so has cleared the
+    /// reports collected from it.
+    void advanced();
+
+    /// Points buffer at up to maxCount reports newer than after, and of one
+    /// of kinds, oldest first. Returns the number found. The pointers are
+    /// valid until the next call to collect().
+    size_t read(uint64_t after,
+                uint32_t kinds,
+                const Report** buffer,
+                size_t maxCount) const;
+
+    /// Returns the report with id, or null if it has been overwritten.
+    const Report* find(uint64_t id) const;
+
+    /// Returns the id of the newest report, or 0 if there are none.
+    uint64_t lastID() const;
+
+    /// Returns the id of the newest report collected before the latest
+    /// advance, or 0 if the instance has not been advanced. Reports after it
+    /// are those the instance itself still holds: those of its latest
+    /// advance, and any made since.
+    uint64_t lastIDBeforeAdvance() const { return m_lastIDBeforeAdvance; }
+
+private:
+    Report& push();
+    void grow();
+
+    std::vector<Report> m_reports;
+    // Index of the oldest report, and the number held.
+    size_t m_start = 0;
+    size_t m_size = 0;
+    size_t m_collectedEvents = 0;
+    size_t m_collectedStates = 0;
+    uint64_t m_advanceCount = 0;
+    uint64_t m_lastIDBeforeAdvance = 0;
+};
+
+} // namespace rive
+
+#endif /* StateMachineEventChannel_hpp */
@@ -0,0 +1,301 @@
+//
+//  RiveAdvanceScheduler.swift
+//  RiveRuntime
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+import Foundation
+
+/// Advances the state machines of many `RiveView`s together, once per frame.
+///
+/// By default, each view advances its state machine from its own display link
+/// tick. Views with `usesAdvanceScheduler` set instead hand their tick to the
+/// shared scheduler, which advances every state machine that ticked in the
+/// same frame as one batch, just before Core Animation commits the frame.
+///
+/// The batch advances one state machine after another on the main thread,
+/// unless `advancesInParallel` is set, in which case state machines that
+/// share no state are spread over the available cores with
+/// `DispatchQueue.concurrentPerform`. Either way, the batch returns only once
+/// every state machine has been advanced, so the views deliver events and draw
+/// after, and never during, an advance.
+///
+/// Delegate callbacks, events and listeners are still delivered on the main
+/// thread, in the same order as when views advance themselves.
+@objc public final class RiveAdvanceScheduler: NSObject {
+    /// The scheduler used by views with `usesAdvanceScheduler` set.
+    @objc public static let shared = RiveAdvanceScheduler()
+
+    /// Whether state machines that share no state are advanced on several
+    /// threads at once. Defaults to false. Must be set on the main thread.
+    ///
+    /// State machines are advanced in parallel only if they come from
+    /// different imported files, have different artboards, and their bound
+    /// view model instances, nested instances included, do not overlap.
+    /// RiveFiles that share an import through `RiveFileCache` count as one
+    /// file. Any others are advanced one after another, in order. Views that
+    /// override `advance(delta:)` are always advanced on the main thread.
+    ///
+    /// Only set this if what the state machines advance is safe to advance
+    /// alongside other files: text, layouts and audio go through the render
+    /// factory and audio engine shared by every file, which do not guard
+    /// against concurrent use.
+    @objc public var advancesInParallel = false
+
+    private struct PendingAdvance {
+        let view: RiveView
+        var elapsedSeconds: Double
+        var steps: Int
+    }
+
+    private var pending: [PendingAdvance] = []
+    private var pendingIndices: [ObjectIdentifier: Int] = [:]
+    private var observer: CFRunLoopObserver?
+
+    deinit {
+        if let observer {
+            CFRunLoopObserverInvalidate(observer)
+        }
+    }
+
+    // MARK: - Views
+
+    /// Schedules view to be advanced by elapsedSeconds, steps times, with the
+    /// current batch. Must be called on the main thread.
+    func schedule(_ view: RiveView, elapsedSeconds: Double, steps: Int = 1) {
+        let key = ObjectIdentifier(view)
+        if let index = pendingIndices[key] {
+            // Ticked twice before the batch ran; advance by both, keeping
+            // fixed steps separate.
+            if pending[index].elapsedSeconds == elapsedSeconds {
+                pending[index].steps += steps
+            } else {
+                pending[index].elapsedSeconds = pending[index].elapsedSeconds * Double(pending[index].steps)
+                    + elapsedSeconds * Double(steps)
+                pending[index].steps = 1
+            }
+        } else {
+            pendingIndices[key] = pending.count
+            pending.append(PendingAdvance(view: view, elapsedSeconds: elapsedSeconds, steps: steps))
+        }
+        installObserverIfNeeded()
+    }
+
+    private func installObserverIfNeeded() {
+        guard observer == nil else { return }
+        // Core Animation commits, and so draws, from its own before-waiting
+        // observer, ordered after this one.
+        let observer = CFRunLoopObserverCreateWithHandler(
+            kCFAllocatorDefault,
+            CFRunLoopActivity.beforeWaiting.rawValue,
+            true,
+            0
+        ) { [weak self] _, _ in
+            self?.advancePending()
+        }
+        CFRunLoopAddObserver(CFRunLoopGetMain(), observer, .commonModes)
+        self.observer = observer
+    }
+
+    private func advancePending() {
+        guard !pending.isEmpty else { return }
+        let batch = pending
+        pending.removeAll(keepingCapacity: true)
+        pendingIndices.removeAll(keepingCapacity: true)
+
+        var wasPlaying: [Bool?] = []
+        var jobs: [Job] = []
+        var jobIndices: [Int?] = []
+        wasPlaying.reserveCapacity(batch.count)
+        jobIndices.reserveCapacity(batch.count)
+        for item in batch {
+            // Subclasses that override advance(delta:) are advanced through it
+            // below, so that the override runs.
+            guard Self.usesBaseAdvance(item.view) else {
+                wasPlaying.append(nil)
+                jobIndices.append(nil)
+                continue
+            }
+            wasPlaying.append(item.view.isPlaying)
+            if let stateMachine = item.view.prepareAdvance() {
+                jobIndices.append(jobs.count)
+                jobs.append(Job(
+                    stateMachine: stateMachine,
+                    artboard: item.view.riveModel?.artboard,
+                    file: item.view.riveModel?.riveFile,
+                    elapsedSeconds: item.elapsedSeconds,
+                    steps: item.steps
+                ))
+            } else {
+                jobIndices.append(nil)
+            }
+        }
+
+        let results = advance(jobs)
+
+        for (index, item) in batch.enumerated() {
+            guard let wasPlaying = wasPlaying[index] else {
+                for _ in 0..<item.steps {
+                    item.view.advance(delta: item.elapsedSeconds)
+                }
+                continue
+            }
+            let job = jobIndices[index].map { (jobs[$0].stateMachine, results[$0]) }
+            item.view.finishAdvance(
+                delta: item.elapsedSeconds * Double(item.steps),
+                wasPlaying: wasPlaying,
+                stateMachine: job?.0,
+                shouldAdvance: job?.1 ?? false
+            )
+        }
+    }
+
+    private static let baseAdvance = class_getInstanceMethod(RiveView.self, #selector(RiveView.advance(delta:)))
+
+    private static func usesBaseAdvance(_ view: RiveView) -> Bool {
+        return class_getInstanceMethod(type(of: view), #selector(RiveView.advance(delta:))) == baseAdvance
+    }
+
+    // MARK: - Models
+
+    /// Advances the state machine of each model by elapsedSeconds, in parallel
+    /// where `advancesInParallel` allows, and returns once all have been
+    /// advanced. Must be called on the main thread.
+    ///
+    /// - Returns: For each model, whether its state machine should keep
+    /// advancing, or false if it has none.
+    public func advance(_ models: [RiveModel], by elapsedSeconds: Double) -> [Bool] {
+        var jobs: [Job] = []
+        var jobIndices: [Int?] = []
+        jobIndices.reserveCapacity(models.count)
+        for model in models {
+            if let stateMachine = model.stateMachine {
+                jobIndices.append(jobs.count)
+                jobs.append(Job(
+                    stateMachine: stateMachine,
+                    artboard: model.artboard,
+                    file: model.riveFile,
+                    elapsedSeconds: elapsedSeconds,
+                    steps: 1
+                ))
+            } else {
+                jobIndices.append(nil)
+            }
+        }
+        let results = advance(jobs)
+        return jobIndices.map { $0.map { results[$0] } ?? false }
+    }
+
+    // MARK: - Batches
+
+    private struct Job {
+        let stateMachine: RiveStateMachineInstance
+        let artboard: RiveArtboard?
+        let file: RiveFile?
+        let elapsedSeconds: Double
+        let steps: Int
+
+        /// Advances the state machine steps times, returning whether it
+        /// should keep advancing after the last. The advances are logged
+        /// beforehand, on the main thread.
+        func run() -> Bool {
+            var result = false
+            for _ in 0..<steps {
+                result = stateMachine.advanceUnlogged(by: elapsedSeconds)
+            }
+            return result
+        }
+    }
+
+    /// State a state machine may change when it advances.
+    private enum Dependency: Hashable {
+        case file(UInt)
+        case artboard(ObjectIdentifier)
+        case viewModelInstance(UInt)
+    }
+
+    private func advance(_ jobs: [Job]) -> [Bool] {
+        for job in jobs {
+            for _ in 0..<job.steps {
+                RiveLogger.log(stateMachine: job.stateMachine, advance: job.elapsedSeconds)
+            }
+        }
+
+        var results = [Bool](repeating: false, count: jobs.count)
+        let groups = advancesInParallel && jobs.count > 1 ? independentGroups(of: jobs) : []
+        guard groups.count > 1 else {
+            for (index, job) in jobs.enumerated() {
+                results[index] = job.run()
+            }
+            return results
+        }
+
+        results.withUnsafeMutableBufferPointer { results in
+            // Each group writes only its own jobs' results.
+            let results = results
+            DispatchQueue.concurrentPerform(iterations: groups.count) { group in
+                for index in groups[group] {
+                    results[index] = jobs[index].run()
+                }
+            }
+        }
+        return results
+    }
+
+    /// Groups jobs that share a file, an artboard or a view model instance,
+    /// and so must be advanced one after another, keeping their order.
+    func independentGroups(of models: [RiveModel]) -> [[Int]] {
+        let jobs = models.compactMap { model in
+            model.stateMachine.map {
+                Job(stateMachine: $0, artboard: model.artboard, file: model.riveFile, elapsedSeconds: 0, steps: 1)
+            }
+        }
+        return independentGroups(of: jobs)
+    }
+
+    private func independentGroups(of jobs: [Job]) -> [[Int]] {
+        var parents = Array(jobs.indices)
+        func root(_ index: Int) -> Int {
+            var index = index
+            while parents[index] != index {
+                parents[index] = parents[parents[index]]
+                index = parents[index]
+            }
+            return index
+        }
+
+        var owners: [Dependency: Int] = [:]
+        for (index, job) in jobs.enumerated() {
+            var dependencies = [Dependency.artboard(ObjectIdentifier(job.artboard ?? job.stateMachine))]
+            if let file = job.file {
+                dependencies.append(.file(file.importIdentifier))
+            }
+            for identifier in job.stateMachine.viewModelInstanceIdentifiers() {
+                dependencies.append(.viewModelInstance(identifier.uintValue))
+            }
+            for dependency in dependencies {
+                if let owner = owners[dependency] {
+                    let jobRoot = root(index)
+                    let ownerRoot = root(owner)
+                    parents[jobRoot] = ownerRoot
+                } else {
+                    owners[dependency] = index
+                }
+            }
+        }
+
+        var groups: [[Int]] = []
+        var groupIndices: [Int: Int] = [:]
+        for index in jobs.indices {
+            let key = root(index)
+            if let group = groupIndices[key] {
+                groups[group].append(index)
+            } else {
+                groupIndices[key] = groups.count
+                groups.append([index])
+            }
+        }
+        return groups
+    }
+}
@@ -63,9 +63,22 @@ open class RiveView: RiveRendererView {
 
     // MARK: Render Loop
     internal private(set) var isPlaying: Bool = false
+    /// Whether the view's state machine is advanced together with those of other views, in
+    /// parallel where possible, by `RiveAdvanceScheduler.shared`, rather than on its own.
+    /// Useful when many views animate at once, e.g. cells in a feed.
+    @objc public var usesAdvanceScheduler: Bool = false
+    /// How the time between display link ticks is turned into state machine advances.
+    public var timestep: Timestep = .variable
     private var lastTime: CFTimeInterval = 0
+    private var fixedTimestepClock: FixedTimestepClock?
     private var displaySync: RiveDisplayLink?
     private var eventQueue = EventQueue()
+    // Reused every frame, so that polling for events and state changes
+    // allocates nothing when there are none.
+    private var reports = [RiveStateMachineReport](repeating: RiveStateMachineReport(), count: 16)
+    private weak var reportingStateMachine: RiveStateMachineInstance?
+    private var lastEventReport: UInt64 = 0
+    private var lastStateChangeReport: UInt64 = 0
 
     // MARK: FPS
     private var userFPS: Any?
@@ -287,6 +300,7 @@ open class RiveView: RiveRendererView {
         RiveLogger.log(view: self, event: .reset)
 
         lastTime = 0
+        fixedTimestepClock?.reset()
 
         if !isPlaying {
             advance(delta: 0)
@@ -326,9 +340,26 @@ open class RiveView: RiveRendererView {
         displaySync?.stop()
         displaySync = nil
         lastTime = 0
+        fixedTimestepClock?.reset()
         fpsCounter?.stopped()
     }
     
+    /// Returns how far to advance, and how many times, for a tick elapsedTime
+    /// seconds after the previous one.
+    private func advanceSteps(for elapsedTime: Double, isFirstTick: Bool) -> (step: Double, count: Int) {
+        fixedTimestepClock = timestep.clock(reusing: fixedTimestepClock)
+        guard var clock = fixedTimestepClock else {
+            return (elapsedTime, 1)
+        }
+        let count = clock.steps(for: elapsedTime)
+        fixedTimestepClock = clock
+        // The first tick still advances by 0 so that it draws.
+        if count == 0, isFirstTick {
+            return (0, 1)
+        }
+        return (clock.step, count)
+    }
+
     private func timestamp() -> CFTimeInterval {
         return displaySync?.targetTimestamp ?? Date().timeIntervalSince1970
     }
@@ -344,8 +375,9 @@ open class RiveView: RiveRendererView {
         }
         
         let timestamp = timestamp()
+        let isFirstTick = lastTime == 0
         // last time needs to be set on the first tick
-        if lastTime == 0 {
+        if isFirstTick {
             lastTime = timestamp
         }
         
@@ -360,7 +392,16 @@ open class RiveView: RiveRendererView {
             
         
         lastTime = timestamp
-        advance(delta: elapsedTime)
+        let (step, count) = advanceSteps(for: elapsedTime, isFirstTick: isFirstTick)
+        if usesAdvanceScheduler {
+            if count > 0 {
+                RiveAdvanceScheduler.shared.schedule(self, elapsedSeconds: step, steps: count)
+            }
+            return
+        }
+        for _ in 0..<count {
+            advance(delta: step)
+        }
         if !isPlaying {
             stopTimer()
         }
@@ -372,26 +413,34 @@ open class RiveView: RiveRendererView {
     /// - Parameter delta: elapsed seconds since the last advance
     @objc open func advance(delta: Double) {
         let wasPlaying = isPlaying
+        let stateMachine = prepareAdvance()
+        let shouldAdvance = stateMachine?.advance(by: delta) ?? false
+        finishAdvance(delta: delta, wasPlaying: wasPlaying, stateMachine: stateMachine, shouldAdvance: shouldAdvance)
+    }
+
+    /// The first part of an advance: fires queued events, and delivers those the state machine
+    /// has reported.
+    ///
+    /// - Returns: The state machine to advance, if any.
+    internal func prepareAdvance() -> RiveStateMachineInstance? {
         eventQueue.fireAll()
-        
-        if let stateMachine = riveModel?.stateMachine {
-            let firedEventCount = stateMachine.reportedEventCount()
-            if (firedEventCount > 0) {
-                for i in 0..<firedEventCount {
-                    let event = stateMachine.reportedEvent(at: i)
-                    RiveLogger.log(view: self, event: .eventReceived(event.name()))
-                    stateMachineDelegate?.onRiveEventReceived?(onRiveEvent: event)
-                }
-            }
-            var shouldAdvance = stateMachine.advance(by: delta)
-            if delta == 0 {
-                shouldAdvance = true
-            }
-            isPlaying = shouldAdvance && wasPlaying
+        guard let stateMachine = riveModel?.stateMachine else { return nil }
+        deliverReports(.event, from: stateMachine)
+        return stateMachine
+    }
 
-            if let delegate = stateMachineDelegate {
-                stateMachine.stateChanges().forEach { delegate.stateMachine?(stateMachine, didChangeState: $0) }
-            }
+    /// The last part of an advance, once stateMachine, if any, has been advanced by delta:
+    /// advances the animation otherwise, then updates the play state and requests a redraw.
+    internal func finishAdvance(
+        delta: Double,
+        wasPlaying: Bool,
+        stateMachine: RiveStateMachineInstance?,
+        shouldAdvance: Bool
+    ) {
+        if let stateMachine {
+            isPlaying = (shouldAdvance || delta == 0) && wasPlaying
+
+            deliverReports(.stateChange, from: stateMachine)
 
             stateMachine.viewModelInstance?.updateListeners()
         } else if let animation = riveModel?.animation {
@@ -806,24 +855,50 @@ open class RiveView: RiveRendererView {
     private func advanceStateMachine(by delta: Double) {
         guard let stateMachine = riveModel?.stateMachine else { return }
 
-        let firedEventCount = stateMachine.reportedEventCount()
-        if firedEventCount > 0 {
-            for i in 0..<firedEventCount {
-                let event = stateMachine.reportedEvent(at: i)
-                RiveLogger.log(view: self, event: .eventReceived(event.name()))
-                stateMachineDelegate?.onRiveEventReceived?(onRiveEvent: event)
-            }
-        }
-
+        deliverReports(.event, from: stateMachine)
         stateMachine.advance(by: delta)
+        deliverReports(.stateChange, from: stateMachine)
 
-        if let delegate = stateMachineDelegate {
-            stateMachine.stateChanges().forEach {
-                delegate.stateMachine?(stateMachine, didChangeState: $0)
+        stateMachine.viewModelInstance?.updateListeners()
+    }
+
+    /// Delivers the events, or state changes, that the state machine has reported since the last
+    /// delivery of that kind. Objects are only created for reports there are.
+    private func deliverReports(_ kind: RiveStateMachineReportKind, from stateMachine: RiveStateMachineInstance) {
+        if stateMachine !== reportingStateMachine {
+            // Start from the oldest report not yet delivered: what the state machine has reported
+            // since its latest advance began, including what it reported before it was first shown.
+            reportingStateMachine = stateMachine
+            lastEventReport = stateMachine.reportIdentifierBeforeLatestAdvance()
+            lastStateChangeReport = lastEventReport
+        }
+        var lastReport = kind == .event ? lastEventReport : lastStateChangeReport
+        while true {
+            let count = reports.withUnsafeMutableBufferPointer { buffer in
+                Int(stateMachine.readReports(after: lastReport, kinds: kind, into: buffer.baseAddress!, capacity: UInt(buffer.count)))
+            }
+            for report in reports[0..<count] {
+                if kind == .event, let event = stateMachine.event(forReport: report.identifier) {
+                    RiveLogger.log(view: self, event: .eventReceived(event.name()))
+                    stateMachineDelegate?.onRiveEventReceived?(onRiveEvent: event)
+                } else if kind == .stateChange,
+                          let delegate = stateMachineDelegate,
+                          let name = stateMachine.stateName(forReport: report.identifier) {
+                    delegate.stateMachine?(stateMachine, didChangeState: name)
+                }
+            }
+            if count > 0 {
+                lastReport = reports[count - 1].identifier
+            }
+            if count < reports.count {
+                break
             }
         }
-
-        stateMachine.viewModelInstance?.updateListeners()
+        if kind == .event {
+            lastEventReport = lastReport
+        } else {
+            lastStateChangeReport = lastReport
+        }
     }
 
     private func redrawIfNecessary() {
@@ -33,7 +33,8 @@ public extension RiveFile {
             fatalError(errorMessage)
         }
 
-        guard let data = try? Data(contentsOf: url) else {
+        // Map rather than read the file, so that its pages stay clean and reclaimable.
+        guard let data = try? Data(contentsOf: url, options: .mappedIfSafe) else {
             let errorMessage = "Failed to load \(url) from bundle."
             RiveLogger.log(file: nil, event: .fatalError(errorMessage))
             fatalError()
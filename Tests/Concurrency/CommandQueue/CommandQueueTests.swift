@@ -0,0 +1,99 @@
+//
+//  CommandQueueTests.swift
+//  RiveRuntimeTests
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+import XCTest
+@testable import RiveRuntime
+
+/// Exercises the property write buffer of a command queue with no server attached. Commands are
+/// only queued, so these tests observe which writes the buffer sends rather than their effect.
+class CommandQueueTests: XCTestCase {
+
+    // MARK: - Property Write Coalescing
+
+    @MainActor
+    func test_setValue_repeatedBetweenFrames_sendsLatestWriteOnly() {
+        let commandQueue = CommandQueue()
+
+        for index in 0..<100 {
+            commandQueue.setViewModelInstanceNumber(1, path: "offset", value: Float(index), requestID: commandQueue.nextRequestID)
+        }
+        commandQueue.processMessages()
+
+        XCTAssertEqual(commandQueue.coalescedPropertyWriteCount, 99)
+    }
+
+    @MainActor
+    func test_setValue_coalescesPerInstanceAndPath() {
+        let commandQueue = CommandQueue()
+
+        for index in 0..<10 {
+            commandQueue.setViewModelInstanceNumber(1, path: "offset", value: Float(index), requestID: commandQueue.nextRequestID)
+            commandQueue.setViewModelInstanceNumber(1, path: "progress", value: Float(index), requestID: commandQueue.nextRequestID)
+            commandQueue.setViewModelInstanceNumber(2, path: "offset", value: Float(index), requestID: commandQueue.nextRequestID)
+            commandQueue.setViewModelInstanceString(1, path: "title", value: "\(index)", requestID: commandQueue.nextRequestID)
+        }
+        commandQueue.processMessages()
+
+        XCTAssertEqual(commandQueue.coalescedPropertyWriteCount, 4 * 9)
+    }
+
+    @MainActor
+    func test_setValue_isNotCoalescedAcrossFrames() {
+        let commandQueue = CommandQueue()
+
+        for index in 0..<10 {
+            commandQueue.setViewModelInstanceNumber(1, path: "offset", value: Float(index), requestID: commandQueue.nextRequestID)
+            commandQueue.processMessages()
+        }
+
+        XCTAssertEqual(commandQueue.coalescedPropertyWriteCount, 0)
+    }
+
+    @MainActor
+    func test_setValue_isNotCoalescedAcrossTrigger() {
+        let commandQueue = CommandQueue()
+
+        commandQueue.setViewModelInstanceBool(1, path: "pressed", value: true, requestID: commandQueue.nextRequestID)
+        commandQueue.fireViewModelTrigger(1, path: "tap", requestID: commandQueue.nextRequestID)
+        commandQueue.setViewModelInstanceBool(1, path: "pressed", value: false, requestID: commandQueue.nextRequestID)
+        commandQueue.processMessages()
+
+        XCTAssertEqual(commandQueue.coalescedPropertyWriteCount, 0)
+    }
+
+    @MainActor
+    func test_setValue_isNotCoalescedAcrossListOperation() {
+        let commandQueue = CommandQueue()
+
+        commandQueue.setViewModelInstanceString(2, path: "title", value: "first", requestID: commandQueue.nextRequestID)
+        commandQueue.appendViewModelInstanceListViewModel(1, path: "items", value: 2, requestID: commandQueue.nextRequestID)
+        commandQueue.setViewModelInstanceString(2, path: "title", value: "second", requestID: commandQueue.nextRequestID)
+        commandQueue.processMessages()
+
+        XCTAssertEqual(commandQueue.coalescedPropertyWriteCount, 0)
+    }
+
+    /// A 120 Hz sensor feeding two properties of a view drawing at 60 Hz: half the writes never
+    /// become commands.
+    @MainActor
+    func test_setValue_atTwiceTheFrameRate_eliminatesHalfOfTheCommands() {
+        let commandQueue = CommandQueue()
+        let frames = 600
+        let writesPerFrame = 2
+
+        for frame in 0..<frames {
+            for _ in 0..<writesPerFrame {
+                commandQueue.setViewModelInstanceNumber(1, path: "pitch", value: Float(frame), requestID: commandQueue.nextRequestID)
+                commandQueue.setViewModelInstanceNumber(1, path: "roll", value: Float(frame), requestID: commandQueue.nextRequestID)
+            }
+            commandQueue.processMessages()
+        }
+
+        let writes = frames * writesPerFrame * 2
+        XCTAssertEqual(Int(commandQueue.coalescedPropertyWriteCount), writes / 2)
+    }
+}
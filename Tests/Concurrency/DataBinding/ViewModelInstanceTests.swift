@@ -385,6 +385,97 @@ class ViewModelInstanceTests: XCTestCase {
         XCTAssertEqual(values[0], 42.5, accuracy: 0.001)
     }
     
+    @MainActor
+    func test_valueStream_withBatch_deliversToEachStreamInOrder() async throws {
+        let mockCommandQueue = MockCommandQueue()
+
+        let viewModelInstance = makeViewModelInstance(mockCommandQueue: mockCommandQueue)
+
+        let first = viewModelInstance.valueStream(of: NumberProperty(path: "first"))
+        let second = viewModelInstance.valueStream(of: NumberProperty(path: "second"))
+        XCTAssertEqual(mockCommandQueue.subscribeToViewModelPropertyCalls.count, 2)
+        let firstRequestID = mockCommandQueue.subscribeToViewModelPropertyCalls[0].requestID
+        let secondRequestID = mockCommandQueue.subscribeToViewModelPropertyCalls[1].requestID
+
+        let firstTask = Task {
+            var values: [Float] = []
+            for try await value in first {
+                values.append(value)
+                if values.count == 2 { break }
+            }
+            return values
+        }
+        let secondTask = Task {
+            var values: [Float] = []
+            for try await value in second {
+                values.append(value)
+                break
+            }
+            return values
+        }
+
+        let observer = mockCommandQueue.getObserver(for: 99)
+        observer?.onViewModelDataBatchReceived(99, batch: [
+            (firstRequestID, MockRiveViewModelInstanceData(numberValue: 1)),
+            (secondRequestID, MockRiveViewModelInstanceData(numberValue: 2)),
+            (firstRequestID, MockRiveViewModelInstanceData(numberValue: 3))
+        ])
+
+        let firstValues = try await firstTask.value
+        let secondValues = try await secondTask.value
+        XCTAssertEqual(firstValues, [1, 3])
+        XCTAssertEqual(secondValues, [2])
+    }
+
+    /// Delivers a change to each of 300 subscribed properties per iteration, one callback per
+    /// change, as observers that do not receive batches are.
+    @MainActor
+    func test_valueStream_perChangeDelivery_performance() {
+        measureStreamDelivery(batched: false)
+    }
+
+    /// As above, with all 300 changes in one batch.
+    @MainActor
+    func test_valueStream_batchedDelivery_performance() {
+        measureStreamDelivery(batched: true)
+    }
+
+    @MainActor
+    private func measureStreamDelivery(batched: Bool) {
+        let propertyCount = 300
+        let mockCommandQueue = MockCommandQueue()
+        let viewModelInstance = makeViewModelInstance(mockCommandQueue: mockCommandQueue)
+        let observer = mockCommandQueue.getObserver(for: 99)
+
+        let received = DeliveryExpectation()
+        let tasks = (0..<propertyCount).map { index in
+            let stream = viewModelInstance.valueStream(of: NumberProperty(path: "property \(index)"))
+            return Task {
+                for try await _ in stream {
+                    received.expectation?.fulfill()
+                }
+            }
+        }
+        let requestIDs = mockCommandQueue.subscribeToViewModelPropertyCalls.map(\.requestID)
+        let data = MockRiveViewModelInstanceData(numberValue: 1)
+
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            let expectation = XCTestExpectation(description: "Delivered")
+            expectation.expectedFulfillmentCount = propertyCount
+            received.expectation = expectation
+            if batched {
+                observer?.onViewModelDataBatchReceived(99, batch: requestIDs.map { ($0, data) })
+            } else {
+                for requestID in requestIDs {
+                    observer?.onViewModelDataReceived(99, requestID: requestID, data: data)
+                }
+            }
+            wait(for: [expectation], timeout: 5)
+        }
+
+        tasks.forEach { $0.cancel() }
+    }
+
     @MainActor
     func test_valueStream_withNumberProperty_unsubscribesOnTermination() async throws {
         let mockCommandQueue = MockCommandQueue()
@@ -1288,6 +1379,7 @@ class ViewModelInstanceTests: XCTestCase {
         viewModelInstance.removeInstance(at: 0, from: listProperty)
         viewModelInstance.removeInstance(nestedInstance, from: listProperty)
         viewModelInstance.swapInstance(atIndex: 0, withIndex: 1, in: listProperty)
+        viewModelInstance.setInstances(of: listProperty, to: [nestedInstance])
 
         // Trigger mutation
         viewModelInstance.fire(trigger: TriggerProperty(path: "test.trigger"))
@@ -1672,6 +1764,25 @@ class ViewModelInstanceTests: XCTestCase {
         XCTAssertEqual(call.withIndex, withIndex)
     }
     
+    @MainActor
+    func test_setInstances_withListProperty_sendsHandlesInOrderToCommandQueue() async {
+        let mockCommandQueue = MockCommandQueue()
+        let viewModelInstance = makeViewModelInstance(mockCommandQueue: mockCommandQueue)
+        let service = ViewModelInstanceService(dependencies: .init(commandQueue: mockCommandQueue, messageGate: CommandQueueMessageGate(driver: mockCommandQueue)))
+        let handles: [UInt64] = [3, 1, 2]
+        let items = handles.map {
+            ViewModelInstance(handle: $0, dependencies: .init(viewModelInstanceService: service))
+        }
+
+        viewModelInstance.setInstances(of: ListProperty(path: "test.list.path"), to: items)
+
+        XCTAssertEqual(mockCommandQueue.applyViewModelInstanceListDiffCalls.count, 1)
+        let call = mockCommandQueue.applyViewModelInstanceListDiffCalls[0]
+        XCTAssertEqual(call.viewModelInstanceHandle, 99)
+        XCTAssertEqual(call.path, "test.list.path")
+        XCTAssertEqual(call.values, [3, 1, 2])
+    }
+    
     // MARK: - Cancellation
 
     @MainActor
@@ -2099,4 +2210,144 @@ class ViewModelInstanceTests: XCTestCase {
         }
     }
 
+
+    @MainActor
+    func test_snapshot_returnsSnapshotData() async throws {
+        let mockCommandQueue = MockCommandQueue()
+        var capturedObserver: ViewModelInstanceListener?
+        let viewModelInstance = makeViewModelInstance(mockCommandQueue: mockCommandQueue) { observer in
+            capturedObserver = observer
+        }
+
+        let snapshotData = Data([0x52, 0x56, 0x4d, 0x53, 1, 0])
+        mockCommandQueue.stubRequestViewModelInstanceSnapshot { instanceHandle, requestID in
+            capturedObserver?.onViewModelInstanceSnapshotReceived(instanceHandle, requestID: requestID, snapshot: snapshotData)
+        }
+
+        let snapshot = try await viewModelInstance.snapshot()
+        XCTAssertEqual(snapshot, snapshotData)
+        XCTAssertEqual(mockCommandQueue.requestViewModelInstanceSnapshotCallCount, 1)
+    }
+
+    @MainActor
+    func test_restore_sendsSnapshotInOneCommand() async throws {
+        let mockCommandQueue = MockCommandQueue()
+        var capturedObserver: ViewModelInstanceListener?
+        let viewModelInstance = makeViewModelInstance(mockCommandQueue: mockCommandQueue) { observer in
+            capturedObserver = observer
+        }
+
+        mockCommandQueue.stubRestoreViewModelInstance { instanceHandle, _, requestID in
+            capturedObserver?.onViewModelInstanceRestored(instanceHandle, requestID: requestID)
+        }
+
+        let snapshotData = Data([0x52, 0x56, 0x4d, 0x53, 1, 0])
+        try await viewModelInstance.restore(from: snapshotData)
+        XCTAssertEqual(mockCommandQueue.restoreViewModelInstanceCalls.count, 1)
+        XCTAssertEqual(mockCommandQueue.restoreViewModelInstanceCalls[0].viewModelInstanceHandle, 99)
+        XCTAssertEqual(mockCommandQueue.restoreViewModelInstanceCalls[0].snapshot, snapshotData)
+    }
+
+    @MainActor
+    func test_restore_withServerError_throwsMessageError() async throws {
+        let mockCommandQueue = MockCommandQueue()
+        var capturedObserver: ViewModelInstanceListener?
+        let viewModelInstance = makeViewModelInstance(mockCommandQueue: mockCommandQueue) { observer in
+            capturedObserver = observer
+        }
+
+        mockCommandQueue.stubRestoreViewModelInstance { instanceHandle, _, requestID in
+            capturedObserver?.onViewModelInstanceError(instanceHandle, requestID: requestID, message: "Malformed snapshot")
+        }
+
+        do {
+            try await viewModelInstance.restore(from: Data())
+            XCTFail("Expected ViewModelInstanceError.message to be thrown")
+        } catch let error as ViewModelInstanceError {
+            guard case .message = error else {
+                XCTFail("Expected .message error, got \(error)")
+                return
+            }
+        } catch {
+            XCTFail("Expected ViewModelInstanceError.message, got \(type(of: error)): \(error)")
+        }
+    }
+
+    @MainActor
+    func test_applyJSON_sendsDocumentAndMappingInOneCommand() async throws {
+        let mockCommandQueue = MockCommandQueue()
+        var capturedObserver: ViewModelInstanceListener?
+        let viewModelInstance = makeViewModelInstance(mockCommandQueue: mockCommandQueue) { observer in
+            capturedObserver = observer
+        }
+
+        mockCommandQueue.stubApplyViewModelInstanceJSON { instanceHandle, _, _, requestID in
+            capturedObserver?.onViewModelInstanceJSONApplied(
+                instanceHandle,
+                requestID: requestID,
+                appliedCount: 1,
+                skippedFields: ["user/avatar"],
+                missingFields: ["user/score"]
+            )
+        }
+
+        let json = Data(#"{"user": {"name": "Ada", "avatar": {"url": 1}}}"#.utf8)
+        let mapping = ["user/name": "Name", "user/score": "Score"]
+        let result = try await viewModelInstance.apply(json: json, mapping: mapping)
+
+        XCTAssertEqual(result, JSONBindingResult(appliedCount: 1, skippedFields: ["user/avatar"], missingFields: ["user/score"]))
+        XCTAssertEqual(mockCommandQueue.applyViewModelInstanceJSONCalls.count, 1)
+        let call = mockCommandQueue.applyViewModelInstanceJSONCalls[0]
+        XCTAssertEqual(call.viewModelInstanceHandle, 99)
+        XCTAssertEqual(call.json, json)
+        XCTAssertEqual(call.mapping, mapping)
+    }
+
+    @MainActor
+    func test_applyJSON_withoutMapping_sendsNoMapping() async throws {
+        let mockCommandQueue = MockCommandQueue()
+        var capturedObserver: ViewModelInstanceListener?
+        let viewModelInstance = makeViewModelInstance(mockCommandQueue: mockCommandQueue) { observer in
+            capturedObserver = observer
+        }
+
+        mockCommandQueue.stubApplyViewModelInstanceJSON { instanceHandle, _, _, requestID in
+            capturedObserver?.onViewModelInstanceJSONApplied(instanceHandle, requestID: requestID, appliedCount: 0, skippedFields: [], missingFields: [])
+        }
+
+        try await viewModelInstance.apply(json: Data("{}".utf8))
+        XCTAssertEqual(mockCommandQueue.applyViewModelInstanceJSONCalls.count, 1)
+        XCTAssertNil(mockCommandQueue.applyViewModelInstanceJSONCalls[0].mapping)
+    }
+
+    @MainActor
+    func test_applyJSON_withServerError_throwsMessageError() async throws {
+        let mockCommandQueue = MockCommandQueue()
+        var capturedObserver: ViewModelInstanceListener?
+        let viewModelInstance = makeViewModelInstance(mockCommandQueue: mockCommandQueue) { observer in
+            capturedObserver = observer
+        }
+
+        mockCommandQueue.stubApplyViewModelInstanceJSON { instanceHandle, _, _, requestID in
+            capturedObserver?.onViewModelInstanceError(instanceHandle, requestID: requestID, message: "Malformed JSON at offset 1")
+        }
+
+        do {
+            try await viewModelInstance.apply(json: Data("{".utf8))
+            XCTFail("Expected ViewModelInstanceError.message to be thrown")
+        } catch let error as ViewModelInstanceError {
+            guard case .message = error else {
+                XCTFail("Expected .message error, got \(error)")
+                return
+            }
+        } catch {
+            XCTFail("Expected ViewModelInstanceError.message, got \(type(of: error)): \(error)")
+        }
+    }
+}
+
+/// The expectation fulfilled by stream consumers for the current measured iteration.
+@MainActor
+private final class DeliveryExpectation {
+    var expectation: XCTestExpectation?
 }
@@ -234,4 +234,42 @@ class FileLoaderTests: XCTestCase {
             XCTFail("Expected FileError.invalidFile, got \(type(of: error)): \(error)")
         }
     }
+
+    @MainActor
+    func test_fileSource_ifExists_returnsFile() async throws {
+        let url = try XCTUnwrap(Bundle(for: Self.self).url(forResource: "defaultstatemachine", withExtension: "riv"))
+        let loader = FileLoader(
+            source: .file(url),
+            dependencies: .init(
+                urlSession: MockURLSession()
+            )
+        )
+
+        let data = try await loader.load()
+        XCTAssertEqual(data, try Data(contentsOf: url))
+    }
+
+    @MainActor
+    func test_fileSource_ifNotExists_throwsError() async {
+        let url = FileManager.default.temporaryDirectory.appendingPathComponent("404.riv")
+        let loader = FileLoader(
+            source: .file(url),
+            dependencies: .init(
+                urlSession: MockURLSession()
+            )
+        )
+
+        do {
+            _ = try await loader.load()
+            XCTFail("load() should have thrown")
+        } catch let error as FileError {
+            if case .missingFile(let path) = error {
+                XCTAssertEqual(path, url.path)
+            } else {
+                XCTFail("Expected FileError.missingFile, got \(error)")
+            }
+        } catch {
+            XCTFail("Expected FileError.missingFile, got \(type(of: error)): \(error)")
+        }
+    }
 }
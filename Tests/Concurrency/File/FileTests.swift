@@ -113,6 +113,83 @@ class FileTests: XCTestCase {
         await fulfillment(of: [expectation], timeout: 1)
     }
     
+    @MainActor
+    func test_getMetadata_withValidFileHandle_returnsParsedMetadata() async throws {
+        let (file, mockCommandQueue, _, _) = await File.mock(fileHandle: 1)
+        let fileService = file.dependencies.fileService
+
+        let expectation = expectation(description: "metadata received")
+        mockCommandQueue.stubRequestFileMetadata { fileHandle, requestID in
+            XCTAssertEqual(fileHandle, 1)
+            fileService.onFileMetadataListed(1, requestID: requestID, metadata: [
+                "artboards": [
+                    [
+                        "name": "Main",
+                        "width": 500,
+                        "height": 250,
+                        "animationNames": ["Idle"],
+                        "stateMachines": [
+                            [
+                                "name": "State Machine 1",
+                                "inputs": [
+                                    ["name": "hover", "type": RiveStateMachineInputMetadata.InputType.boolean.rawValue],
+                                    ["name": "level", "type": RiveStateMachineInputMetadata.InputType.number.rawValue],
+                                    ["name": "fire", "type": RiveStateMachineInputMetadata.InputType.trigger.rawValue]
+                                ]
+                            ]
+                        ]
+                    ]
+                ],
+                "viewModels": [
+                    [
+                        "name": "Person",
+                        "properties": [
+                            ["type": RiveViewModelInstanceDataType.string.rawValue, "name": "name", "metaData": ""]
+                        ],
+                        "instanceNames": ["Alice"]
+                    ]
+                ]
+            ])
+            expectation.fulfill()
+        }
+
+        let metadata = try await file.getMetadata()
+        await fulfillment(of: [expectation], timeout: 1)
+
+        XCTAssertEqual(metadata.artboards.count, 1)
+        let artboard = try XCTUnwrap(metadata.artboard(named: "Main"))
+        XCTAssertEqual(artboard.size, CGSize(width: 500, height: 250))
+        XCTAssertEqual(artboard.animationNames, ["Idle"])
+        XCTAssertEqual(artboard.stateMachines.first?.inputs, [
+            .init(name: "hover", type: .boolean),
+            .init(name: "level", type: .number),
+            .init(name: "fire", type: .trigger)
+        ])
+        let viewModel = try XCTUnwrap(metadata.viewModel(named: "Person"))
+        XCTAssertEqual(viewModel.properties, [ViewModelProperty(type: .string, name: "name", metaData: "")])
+        XCTAssertEqual(viewModel.instanceNames, ["Alice"])
+    }
+
+    @MainActor
+    func test_getMetadata_withInvalidFileHandle_throwsInvalidFile() async throws {
+        let (file, mockCommandQueue, _, _) = await File.mock(fileHandle: 1)
+        let fileService = file.dependencies.fileService
+
+        mockCommandQueue.stubRequestFileMetadata { fileHandle, requestID in
+            fileService.onFileError(fileHandle, requestID: requestID, message: "Invalid file handle")
+        }
+
+        do {
+            _ = try await file.getMetadata()
+            XCTFail("Expected FileError.invalidFile to be thrown")
+        } catch let error as FileError {
+            guard case .invalidFile = error else {
+                XCTFail("Expected FileError.invalidFile, got \(error)")
+                return
+            }
+        }
+    }
+
     @MainActor
     func test_createDefaultArtboard_resumesOnInstantiatedCallback() async throws {
         let (file, mockCommandQueue, _, _) = await File.mock(fileHandle: 123)
@@ -7,6 +7,7 @@
 //
 
 import XCTest
+import ImageIO
 @testable import RiveRuntime
 
 class ImageTests: XCTestCase {
@@ -73,6 +74,63 @@ class ImageTests: XCTestCase {
         XCTAssertEqual(commandQueue.decodeImageCalls.first?.data, testData)
     }
     
+    @MainActor
+    func test_init_withMaximumPixelSize_decodesReducedData() async throws {
+        let commandQueue = MockCommandQueue()
+        let imageService = ImageService(dependencies: .init(commandQueue: commandQueue, messageGate: CommandQueueMessageGate(driver: commandQueue)))
+        let dependencies = Image.Dependencies(imageService: imageService)
+
+        let testData = try XCTUnwrap(Self.pngData(width: 1024, height: 512))
+        commandQueue.stubDecodeImage { _, listener, requestID in
+            listener.onRenderImageDecoded(42, requestID: requestID)
+            return 42
+        }
+
+        let image = try await Image(data: testData, maximumPixelSize: CGSize(width: 300, height: 0), dependencies: dependencies)
+
+        let downsampling = try XCTUnwrap(image.downsampling)
+        XCTAssertEqual(downsampling.sourcePixelSize, CGSize(width: 1024, height: 512))
+        XCTAssertEqual(downsampling.pixelSize, CGSize(width: 512, height: 256))
+        XCTAssertEqual(downsampling.savedCPUByteCount, (1024 * 512 - 512 * 256) * 4)
+        XCTAssertEqual(downsampling.savedGPUByteCount, downsampling.savedCPUByteCount * 4 / 3)
+        XCTAssertNotEqual(commandQueue.decodeImageCalls.first?.data, testData)
+    }
+
+    @MainActor
+    func test_init_withMaximumPixelSize_passesUnreadableDataThrough() async throws {
+        let commandQueue = MockCommandQueue()
+        let imageService = ImageService(dependencies: .init(commandQueue: commandQueue, messageGate: CommandQueueMessageGate(driver: commandQueue)))
+        let dependencies = Image.Dependencies(imageService: imageService)
+
+        let testData = Data([0x89, 0x50, 0x4E, 0x47])
+        commandQueue.stubDecodeImage { _, listener, requestID in
+            listener.onRenderImageDecoded(42, requestID: requestID)
+            return 42
+        }
+
+        let image = try await Image(data: testData, maximumPixelSize: CGSize(width: 100, height: 100), dependencies: dependencies)
+
+        XCTAssertNil(image.downsampling)
+        XCTAssertEqual(commandQueue.decodeImageCalls.first?.data, testData)
+    }
+
+    private static func pngData(width: Int, height: Int) -> Data? {
+        guard let context = CGContext(
+            data: nil,
+            width: width,
+            height: height,
+            bitsPerComponent: 8,
+            bytesPerRow: 0,
+            space: CGColorSpaceCreateDeviceRGB(),
+            bitmapInfo: CGImageAlphaInfo.premultipliedLast.rawValue
+        ), let image = context.makeImage() else { return nil }
+        let data = NSMutableData()
+        guard let destination = CGImageDestinationCreateWithData(data, "public.png" as CFString, 1, nil) else { return nil }
+        CGImageDestinationAddImage(destination, image, nil)
+        guard CGImageDestinationFinalize(destination) else { return nil }
+        return data as Data
+    }
+
     // MARK: - Cancellation
 
     @MainActor
@@ -30,6 +30,7 @@ class MockCommandQueue: CommandQueueProtocol, _CommandQueueMessagePumpDriver {
     private var deleteFileStub: ((UInt64, UInt64) -> Void)?
     private var deleteFileListenerStub: ((UInt64) -> Void)?
     private var requestArtboardNamesStub: ((UInt64, UInt64) -> Void)?
+    private var requestFileMetadataStub: ((UInt64, UInt64) -> Void)?
     private var requestViewModelNamesStub: ((UInt64, UInt64) -> Void)?
     private var requestViewModelEnumsStub: ((UInt64, UInt64) -> Void)?
     private var requestViewModelInstanceNamesStub: ((UInt64, String, UInt64) -> Void)?
@@ -58,8 +59,14 @@ class MockCommandQueue: CommandQueueProtocol, _CommandQueueMessagePumpDriver {
     private var requestViewModelInstanceListSizeStub: ((UInt64, String, UInt64) -> Void)?
     private var requestViewModelInstanceViewModelNameStub: ((UInt64, UInt64) -> Void)?
     private var requestViewModelInstanceNameStub: ((UInt64, UInt64) -> Void)?
+    private var requestViewModelInstanceSnapshotStub: ((UInt64, UInt64) -> Void)?
+    private var restoreViewModelInstanceStub: ((UInt64, Data, UInt64) -> Void)?
+    private var applyViewModelInstanceJSONStub: ((UInt64, Data, [String: String]?, UInt64) -> Void)?
     private(set) var requestViewModelInstanceViewModelNameCallCount = 0
     private(set) var requestViewModelInstanceNameCallCount = 0
+    private(set) var requestViewModelInstanceSnapshotCallCount = 0
+    private(set) var restoreViewModelInstanceCalls: [RestoreViewModelInstanceCall] = []
+    private(set) var applyViewModelInstanceJSONCalls: [ApplyViewModelInstanceJSONCall] = []
     private(set) var setViewModelInstanceStringCalls: [SetViewModelInstanceStringCall] = []
     private(set) var setViewModelInstanceNumberCalls: [SetViewModelInstanceNumberCall] = []
     private(set) var setViewModelInstanceBoolCalls: [SetViewModelInstanceBoolCall] = []
@@ -78,6 +85,7 @@ class MockCommandQueue: CommandQueueProtocol, _CommandQueueMessagePumpDriver {
     private(set) var removeViewModelInstanceListViewModelAtIndexCalls: [RemoveViewModelInstanceListViewModelAtIndexCall] = []
     private(set) var removeViewModelInstanceListViewModelByValueCalls: [RemoveViewModelInstanceListViewModelByValueCall] = []
     private(set) var swapViewModelInstanceListValuesCalls: [SwapViewModelInstanceListValuesCall] = []
+    private(set) var applyViewModelInstanceListDiffCalls: [ApplyViewModelInstanceListDiffCall] = []
     private var viewModelInstanceObservers: [UInt64: ViewModelInstanceListener] = [:]
     private var unsubscribeStub: ((UInt64, String, RiveViewModelInstanceDataType, UInt64) -> Void)?
 
@@ -88,6 +96,7 @@ class MockCommandQueue: CommandQueueProtocol, _CommandQueueMessagePumpDriver {
     private(set) var deleteFileCalls: [DeleteFileCall] = []
     private(set) var deleteFileListenerCalls: [DeleteFileListenerCall] = []
     private(set) var requestArtboardNamesCalls: [RequestArtboardNamesCall] = []
+    private(set) var requestFileMetadataCalls: [RequestFileMetadataCall] = []
     private(set) var requestViewModelNamesCalls: [RequestViewModelNamesCall] = []
     private(set) var requestViewModelEnumsCalls: [RequestViewModelEnumsCall] = []
     private(set) var requestViewModelInstanceNamesCalls: [RequestViewModelInstanceNamesCall] = []
@@ -177,6 +186,12 @@ class MockCommandQueue: CommandQueueProtocol, _CommandQueueMessagePumpDriver {
     private var audioHandle: UInt64 = 0
     private var audioListeners: [UInt64: AudioListener] = [:]
 
+    var globalAssetMemoryBudget: Int = 128 * 1024 * 1024
+    var globalAssetResidentByteCount: Int = 0
+    private var globalAssetStatisticsStub: (() -> [[String: Any]])?
+    private var trimGlobalAssetsStub: (() -> Int)?
+    private(set) var trimGlobalAssetsCalls: [TrimGlobalAssetsCall] = []
+
     func stubStart(_ stub: @escaping () -> Void) {
         startStub = stub
     }
@@ -231,6 +246,10 @@ class MockCommandQueue: CommandQueueProtocol, _CommandQueueMessagePumpDriver {
     func stubRequestArtboardNames(_ stub: @escaping (UInt64, UInt64) -> Void) {
         requestArtboardNamesStub = stub
     }
+
+    func stubRequestFileMetadata(_ stub: @escaping (UInt64, UInt64) -> Void) {
+        requestFileMetadataStub = stub
+    }
     
     func stubRequestViewModelNames(_ stub: @escaping (UInt64, UInt64) -> Void) {
         requestViewModelNamesStub = stub
@@ -456,6 +475,11 @@ class MockCommandQueue: CommandQueueProtocol, _CommandQueueMessagePumpDriver {
         requestArtboardNamesCalls.append(RequestArtboardNamesCall(fileHandle: fileHandle, requestID: requestID))
         requestArtboardNamesStub?(fileHandle, requestID)
     }
+
+    func requestFileMetadata(_ fileHandle: UInt64, requestID: UInt64) {
+        requestFileMetadataCalls.append(RequestFileMetadataCall(fileHandle: fileHandle, requestID: requestID))
+        requestFileMetadataStub?(fileHandle, requestID)
+    }
     
     func requestViewModelNames(_ fileHandle: UInt64, requestID: UInt64) {
         requestViewModelNamesCalls.append(RequestViewModelNamesCall(fileHandle: fileHandle, requestID: requestID))
@@ -829,6 +853,42 @@ class MockCommandQueue: CommandQueueProtocol, _CommandQueueMessagePumpDriver {
         requestViewModelInstanceNameStub?(viewModelInstanceHandle, requestID)
     }
 
+    func stubRequestViewModelInstanceSnapshot(_ stub: @escaping (UInt64, UInt64) -> Void) {
+        requestViewModelInstanceSnapshotStub = stub
+    }
+
+    func requestViewModelInstanceSnapshot(_ viewModelInstanceHandle: UInt64, requestID: UInt64) {
+        requestViewModelInstanceSnapshotCallCount += 1
+        requestViewModelInstanceSnapshotStub?(viewModelInstanceHandle, requestID)
+    }
+
+    func stubRestoreViewModelInstance(_ stub: @escaping (UInt64, Data, UInt64) -> Void) {
+        restoreViewModelInstanceStub = stub
+    }
+
+    func restoreViewModelInstance(_ viewModelInstanceHandle: UInt64, fromSnapshot snapshot: Data, requestID: UInt64) {
+        restoreViewModelInstanceCalls.append(RestoreViewModelInstanceCall(
+            viewModelInstanceHandle: viewModelInstanceHandle,
+            snapshot: snapshot,
+            requestID: requestID
+        ))
+        restoreViewModelInstanceStub?(viewModelInstanceHandle, snapshot, requestID)
+    }
+
+    func stubApplyViewModelInstanceJSON(_ stub: @escaping (UInt64, Data, [String: String]?, UInt64) -> Void) {
+        applyViewModelInstanceJSONStub = stub
+    }
+
+    func applyViewModelInstanceJSON(_ viewModelInstanceHandle: UInt64, json: Data, mapping: [String: String]?, requestID: UInt64) {
+        applyViewModelInstanceJSONCalls.append(ApplyViewModelInstanceJSONCall(
+            viewModelInstanceHandle: viewModelInstanceHandle,
+            json: json,
+            mapping: mapping,
+            requestID: requestID
+        ))
+        applyViewModelInstanceJSONStub?(viewModelInstanceHandle, json, mapping, requestID)
+    }
+
     func setViewModelInstanceString(_ viewModelInstanceHandle: UInt64, path: String, value: String, requestID: UInt64) {
         setViewModelInstanceStringCalls.append(SetViewModelInstanceStringCall(
             viewModelInstanceHandle: viewModelInstanceHandle,
@@ -977,8 +1037,8 @@ class MockCommandQueue: CommandQueueProtocol, _CommandQueueMessagePumpDriver {
         deleteImageListenerStub?(renderImage)
     }
     
-    func addGlobalImageAsset(_ name: String, imageHandle: UInt64, requestID: UInt64) {
-        addGlobalImageAssetCalls.append(AddGlobalImageAssetCall(name: name, imageHandle: imageHandle, requestID: requestID))
+    func addGlobalImageAsset(_ name: String, imageHandle: UInt64, encodedData: Data?, requestID: UInt64) {
+        addGlobalImageAssetCalls.append(AddGlobalImageAssetCall(name: name, imageHandle: imageHandle, encodedData: encodedData, requestID: requestID))
     }
     
     func removeGlobalImageAsset(_ name: String, requestID: UInt64) {
@@ -1019,8 +1079,8 @@ class MockCommandQueue: CommandQueueProtocol, _CommandQueueMessagePumpDriver {
         deleteFontListenerStub?(font)
     }
     
-    func addGlobalFontAsset(_ name: String, fontHandle: UInt64, requestID: UInt64) {
-        addGlobalFontAssetCalls.append(AddGlobalFontAssetCall(name: name, fontHandle: fontHandle, requestID: requestID))
+    func addGlobalFontAsset(_ name: String, fontHandle: UInt64, encodedData: Data?, requestID: UInt64) {
+        addGlobalFontAssetCalls.append(AddGlobalFontAssetCall(name: name, fontHandle: fontHandle, encodedData: encodedData, requestID: requestID))
     }
     
     func removeGlobalFontAsset(_ name: String, requestID: UInt64) {
@@ -1049,13 +1109,30 @@ class MockCommandQueue: CommandQueueProtocol, _CommandQueueMessagePumpDriver {
         deleteAudioListenerStub?(audio)
     }
     
-    func addGlobalAudioAsset(_ name: String, audioHandle: UInt64, requestID: UInt64) {
-        addGlobalAudioAssetCalls.append(AddGlobalAudioAssetCall(name: name, audioHandle: audioHandle, requestID: requestID))
+    func addGlobalAudioAsset(_ name: String, audioHandle: UInt64, encodedData: Data?, requestID: UInt64) {
+        addGlobalAudioAssetCalls.append(AddGlobalAudioAssetCall(name: name, audioHandle: audioHandle, encodedData: encodedData, requestID: requestID))
     }
     
     func removeGlobalAudioAsset(_ name: String, requestID: UInt64) {
         removeGlobalAudioAssetCalls.append(RemoveGlobalAudioAssetCall(name: name, requestID: requestID))
     }
+
+    func stubGlobalAssetStatistics(_ stub: @escaping () -> [[String: Any]]) {
+        globalAssetStatisticsStub = stub
+    }
+
+    func globalAssetStatistics() -> [[String: Any]] {
+        globalAssetStatisticsStub?() ?? []
+    }
+
+    func stubTrimGlobalAssets(_ stub: @escaping () -> Int) {
+        trimGlobalAssetsStub = stub
+    }
+
+    func trimGlobalAssets() -> Int {
+        trimGlobalAssetsCalls.append(TrimGlobalAssetsCall())
+        return trimGlobalAssetsStub?() ?? 0
+    }
     
     func appendViewModelInstanceListViewModel(_ viewModelInstanceHandle: UInt64, path: String, value: UInt64, requestID: UInt64) {
         appendViewModelInstanceListViewModelCalls.append(AppendViewModelInstanceListViewModelCall(
@@ -1105,6 +1182,15 @@ class MockCommandQueue: CommandQueueProtocol, _CommandQueueMessagePumpDriver {
         ))
     }
     
+    func applyViewModelInstanceListDiff(_ viewModelInstanceHandle: UInt64, path: String, values: [NSNumber], requestID: UInt64) {
+        applyViewModelInstanceListDiffCalls.append(ApplyViewModelInstanceListDiffCall(
+            viewModelInstanceHandle: viewModelInstanceHandle,
+            path: path,
+            values: values.map(\.uint64Value),
+            requestID: requestID
+        ))
+    }
+    
     func getRenderImageListener(for handle: UInt64) -> RenderImageListener? {
         return renderImageListeners[handle]
     }
@@ -1144,6 +1230,24 @@ extension MockCommandQueue {
         let fileHandle: UInt64
         let requestID: UInt64
     }
+
+    struct RestoreViewModelInstanceCall {
+        let viewModelInstanceHandle: UInt64
+        let snapshot: Data
+        let requestID: UInt64
+    }
+
+    struct ApplyViewModelInstanceJSONCall {
+        let viewModelInstanceHandle: UInt64
+        let json: Data
+        let mapping: [String: String]?
+        let requestID: UInt64
+    }
+
+    struct RequestFileMetadataCall {
+        let fileHandle: UInt64
+        let requestID: UInt64
+    }
     
     struct RequestViewModelNamesCall {
         let fileHandle: UInt64
@@ -1482,10 +1586,18 @@ extension MockCommandQueue {
         let withIndex: Int32
         let requestID: UInt64
     }
+
+    struct ApplyViewModelInstanceListDiffCall {
+        let viewModelInstanceHandle: UInt64
+        let path: String
+        let values: [UInt64]
+        let requestID: UInt64
+    }
     
     struct AddGlobalImageAssetCall {
         let name: String
         let imageHandle: UInt64
+        let encodedData: Data?
         let requestID: UInt64
     }
     
@@ -1518,6 +1630,7 @@ extension MockCommandQueue {
     struct AddGlobalFontAssetCall {
         let name: String
         let fontHandle: UInt64
+        let encodedData: Data?
         let requestID: UInt64
     }
     
@@ -1544,6 +1657,7 @@ extension MockCommandQueue {
     struct AddGlobalAudioAssetCall {
         let name: String
         let audioHandle: UInt64
+        let encodedData: Data?
         let requestID: UInt64
     }
     
@@ -1551,4 +1665,6 @@ extension MockCommandQueue {
         let name: String
         let requestID: UInt64
     }
+
+    struct TrimGlobalAssetsCall {}
 }
@@ -18,6 +18,7 @@ class MockFileListener: NSObject, FileListener {
     private(set) var capturedViewModelName: String?
     private(set) var capturedViewModelEnums: [[String: Any]]?
     private(set) var capturedViewModelProperties: [[String: Any]]?
+    private(set) var capturedFileMetadata: [String: Any]?
     private(set) var capturedArtboardHandle: UInt64?
     private(set) var capturedViewModelInstanceHandle: UInt64?
 
@@ -74,6 +75,12 @@ class MockFileListener: NSObject, FileListener {
         capturedViewModelEnums = enums
     }
 
+    func onFileMetadataListed(_ fileHandle: UInt64, requestID: UInt64, metadata: [String: Any]) {
+        capturedFileHandle = fileHandle
+        capturedRequestID = requestID
+        capturedFileMetadata = metadata
+    }
+
     func onViewModelPropertiesListed(_ fileHandle: UInt64, requestID: UInt64, viewModelName: String, properties: [[String: Any]]) {
         capturedFileHandle = fileHandle
         capturedRequestID = requestID
@@ -57,5 +57,16 @@ extension ViewModelInstanceListener {
             data: data.dictionary
         )
     }
-}
 
+    func onViewModelDataBatchReceived(
+        _ viewModelInstanceHandle: UInt64,
+        batch: [(requestID: UInt64, data: MockRiveViewModelInstanceData)]
+    ) {
+        onViewModelDataBatchReceived?(batch.map { entry in
+            var dictionary = entry.data.dictionary
+            dictionary["viewModelInstanceHandle"] = NSNumber(value: viewModelInstanceHandle)
+            dictionary["requestID"] = NSNumber(value: entry.requestID)
+            return dictionary
+        })
+    }
+}
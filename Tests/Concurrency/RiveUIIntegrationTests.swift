@@ -260,4 +260,462 @@ class RiveUIIntegrationTests: XCTestCase {
         XCTAssertEqual(viewModelName, info.viewModelName)
         XCTAssertEqual(name, info.instanceName)
     }
+
+    // MARK: - View Model Instance Snapshots
+
+    @MainActor
+    func test_snapshot_restoredOntoAnotherInstance_copiesValues() async throws {
+        let worker = try await Worker()
+        let file = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+
+        let source = try await file.createViewModelInstance(.name("Editor Defaults", from: .name("Test")))
+        source.setValue(of: StringProperty(path: "String"), to: "Snapshot")
+        source.setValue(of: NumberProperty(path: "Number"), to: 42)
+        source.setValue(of: BoolProperty(path: "Boolean"), to: true)
+        source.setValue(of: StringProperty(path: "Nested/String"), to: "Nested snapshot")
+        let snapshot = try await source.snapshot()
+
+        let target = try await file.createViewModelInstance(.viewModelDefault(from: .name("Test")))
+        try await target.restore(from: snapshot)
+
+        let string = try await target.value(of: StringProperty(path: "String"))
+        let number = try await target.value(of: NumberProperty(path: "Number"))
+        let boolean = try await target.value(of: BoolProperty(path: "Boolean"))
+        let nestedString = try await target.value(of: StringProperty(path: "Nested/String"))
+        XCTAssertEqual(string, "Snapshot")
+        XCTAssertEqual(number, 42)
+        XCTAssertTrue(boolean)
+        XCTAssertEqual(nestedString, "Nested snapshot")
+        let restoredSnapshot = try await target.snapshot()
+        XCTAssertEqual(restoredSnapshot, snapshot)
+    }
+
+    @MainActor
+    func test_restore_withMalformedSnapshot_throwsAndLeavesInstanceUnchanged() async throws {
+        let worker = try await Worker()
+        let file = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+
+        let target = try await file.createViewModelInstance(.viewModelDefault(from: .name("Test")))
+        let before = try await target.snapshot()
+
+        do {
+            try await target.restore(from: before.dropLast())
+            XCTFail("Expected restore to throw")
+        } catch is ViewModelInstanceError {
+        }
+
+        let after = try await target.snapshot()
+        XCTAssertEqual(after, before)
+    }
+
+    // MARK: - Property Write Coalescing
+
+    @MainActor
+    func test_setValue_repeatedBeforeRead_readsLatestValue() async throws {
+        let worker = try await Worker()
+        let file = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+        let instance = try await file.createViewModelInstance(.viewModelDefault(from: .name("Test")))
+
+        for index in 0..<100 {
+            instance.setValue(of: NumberProperty(path: "Number"), to: Float(index))
+        }
+        let number = try await instance.value(of: NumberProperty(path: "Number"))
+
+        XCTAssertEqual(number, 99)
+    }
+
+    @MainActor
+    func test_setValue_beforeAndAfterRestore_keepsCommandOrder() async throws {
+        let worker = try await Worker()
+        let file = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+        let instance = try await file.createViewModelInstance(.viewModelDefault(from: .name("Test")))
+
+        instance.setValue(of: StringProperty(path: "String"), to: "before")
+        let snapshot = try await instance.snapshot()
+        instance.setValue(of: StringProperty(path: "String"), to: "pending")
+        // The pending write must reach the server before the restore, which then replaces it.
+        try await instance.restore(from: snapshot)
+        let restored = try await instance.value(of: StringProperty(path: "String"))
+        instance.setValue(of: StringProperty(path: "String"), to: "after")
+        let written = try await instance.value(of: StringProperty(path: "String"))
+
+        XCTAssertEqual(restored, "before")
+        XCTAssertEqual(written, "after")
+    }
+
+    @MainActor
+    func test_setValue_sameNestedPropertyThroughTwoPaths_keepsLatestWrite() async throws {
+        let worker = try await Worker()
+        let file = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+        let instance = try await file.createViewModelInstance(.viewModelDefault(from: .name("Test")))
+        let nested = instance.value(of: ViewModelInstanceProperty(path: "Nested"))
+
+        // Both paths reach the same property, so the last write must be sent last.
+        instance.setValue(of: StringProperty(path: "Nested/String"), to: "first")
+        nested.setValue(of: StringProperty(path: "String"), to: "second")
+        instance.setValue(of: StringProperty(path: "Nested/String"), to: "third")
+        let string = try await nested.value(of: StringProperty(path: "String"))
+
+        XCTAssertEqual(string, "third")
+    }
+
+    // MARK: - JSON Binding
+
+    @MainActor
+    func test_applyJSON_setsPropertiesAndNestedInstances() async throws {
+        let worker = try await Worker()
+        let file = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+        let instance = try await file.createViewModelInstance(.viewModelDefault(from: .name("Test")))
+
+        let json = #"""
+        {
+            "String": "From JSON",
+            "Number": "12.5",
+            "Boolean": "true",
+            "Nested": { "String": "Nested from JSON" },
+            "Unknown": true,
+            "List": [1, 2, 3]
+        }
+        """#
+        let result = try await instance.apply(json: Data(json.utf8))
+
+        XCTAssertEqual(result.appliedCount, 4)
+        XCTAssertEqual(result.skippedFields, ["Unknown", "List"])
+        XCTAssertEqual(result.missingFields, [])
+        let string = try await instance.value(of: StringProperty(path: "String"))
+        let number = try await instance.value(of: NumberProperty(path: "Number"))
+        let boolean = try await instance.value(of: BoolProperty(path: "Boolean"))
+        let nestedString = try await instance.value(of: StringProperty(path: "Nested/String"))
+        XCTAssertEqual(string, "From JSON")
+        XCTAssertEqual(number, 12.5)
+        XCTAssertTrue(boolean)
+        XCTAssertEqual(nestedString, "Nested from JSON")
+    }
+
+    @MainActor
+    func test_applyJSON_withMapping_bindsOnlyMappedFields() async throws {
+        let worker = try await Worker()
+        let file = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+        let instance = try await file.createViewModelInstance(.viewModelDefault(from: .name("Test")))
+        let before = try await instance.value(of: StringProperty(path: "String"))
+
+        let json = #"{"title": "Mapped", "profile": {"String": "Mapped nested"}, "String": "Unmapped"}"#
+        let mapping = ["title": "Number", "profile": "Nested", "score": "Number"]
+        let result = try await instance.apply(json: Data(json.utf8), mapping: mapping)
+
+        // "Mapped" is not a number, so it is skipped rather than zeroing the property.
+        XCTAssertEqual(result.appliedCount, 1)
+        XCTAssertEqual(result.skippedFields, ["title"])
+        XCTAssertEqual(result.missingFields, ["score"])
+        let string = try await instance.value(of: StringProperty(path: "String"))
+        let nestedString = try await instance.value(of: StringProperty(path: "Nested/String"))
+        XCTAssertEqual(string, before)
+        XCTAssertEqual(nestedString, "Mapped nested")
+    }
+
+    @MainActor
+    func test_applyJSON_withLossyOrNonDecimalValues_skipsThem() async throws {
+        let worker = try await Worker()
+        let file = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+        let instance = try await file.createViewModelInstance(.viewModelDefault(from: .name("Test")))
+        let number = try await instance.value(of: NumberProperty(path: "Number"))
+        let boolean = try await instance.value(of: BoolProperty(path: "Boolean"))
+
+        for json in [
+            #"{"Number": "0x10"}"#,
+            #"{"Number": " 12"}"#,
+            #"{"Number": "inf"}"#,
+            #"{"Number": 1e39}"#,
+            #"{"Boolean": 2}"#,
+        ] {
+            let result = try await instance.apply(json: Data(json.utf8))
+            XCTAssertEqual(result.appliedCount, 0, json)
+            XCTAssertEqual(result.skippedFields.count, 1, json)
+        }
+
+        XCTAssertEqual(try await instance.value(of: NumberProperty(path: "Number")), number)
+        XCTAssertEqual(try await instance.value(of: BoolProperty(path: "Boolean")), boolean)
+    }
+
+    @MainActor
+    func test_applyJSON_withMalformedDocument_throwsAndLeavesInstanceUnchanged() async throws {
+        let worker = try await Worker()
+        let file = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+        let instance = try await file.createViewModelInstance(.viewModelDefault(from: .name("Test")))
+        let before = try await instance.snapshot()
+
+        do {
+            try await instance.apply(json: Data(#"{"String": "Partial", "Number": }"#.utf8))
+            XCTFail("Expected apply to throw")
+        } catch is ViewModelInstanceError {
+        }
+
+        let after = try await instance.snapshot()
+        XCTAssertEqual(after, before)
+    }
+
+    /// Decodes a 10 KB payload with JSONSerialization and sets its fields one by one, as a
+    /// baseline for the native binder.
+    @MainActor
+    func test_applySmallJSON_decodedInSwift_performance() {
+        measureJSONBinding(payloadSize: 10 * 1024, native: false)
+    }
+
+    @MainActor
+    func test_applySmallJSON_native_performance() {
+        measureJSONBinding(payloadSize: 10 * 1024, native: true)
+    }
+
+    /// As above, with a 1 MB payload.
+    @MainActor
+    func test_applyLargeJSON_decodedInSwift_performance() {
+        measureJSONBinding(payloadSize: 1024 * 1024, native: false)
+    }
+
+    @MainActor
+    func test_applyLargeJSON_native_performance() {
+        measureJSONBinding(payloadSize: 1024 * 1024, native: true)
+    }
+
+    /// Binds a feed-style payload: the few fields the view model shows, padded to size with
+    /// records it does not.
+    @MainActor
+    private func measureJSONBinding(payloadSize: Int, native: Bool) {
+        var records: [String] = []
+        var size = 0
+        while size < payloadSize {
+            let record = #"{"id": \#(records.count), "title": "Record \#(records.count)", "score": 4.5, "tags": ["a", "b"]}"#
+            records.append(record)
+            size += record.utf8.count + 1
+        }
+        let header = #"{"String": "Feed", "Number": 42, "Boolean": true, "Nested": {"String": "Nested"}, "records": ["#
+        let json = Data((header + records.joined(separator: ",") + "]}").utf8)
+
+        let fixture = MeasurementFixture()
+        let setUp = expectation(description: "Set up")
+        Task { @MainActor in
+            let worker = try await Worker()
+            let file = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+            fixture.worker = worker
+            fixture.file = file
+            fixture.instance = try await file.createViewModelInstance(.viewModelDefault(from: .name("Test")))
+            setUp.fulfill()
+        }
+        wait(for: [setUp], timeout: 30)
+        guard let instance = fixture.instance else {
+            return XCTFail("Failed to set up JSON fixture")
+        }
+
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            let applied = expectation(description: "Applied")
+            Task { @MainActor in
+                if native {
+                    try await instance.apply(json: json)
+                } else {
+                    let object = try JSONSerialization.jsonObject(with: json) as? [String: Any] ?? [:]
+                    if let string = object["String"] as? String {
+                        instance.setValue(of: StringProperty(path: "String"), to: string)
+                    }
+                    if let number = object["Number"] as? NSNumber {
+                        instance.setValue(of: NumberProperty(path: "Number"), to: number.floatValue)
+                    }
+                    if let boolean = object["Boolean"] as? Bool {
+                        instance.setValue(of: BoolProperty(path: "Boolean"), to: boolean)
+                    }
+                    if let nested = object["Nested"] as? [String: Any], let string = nested["String"] as? String {
+                        instance.setValue(of: StringProperty(path: "Nested/String"), to: string)
+                    }
+                }
+                let number = try await instance.value(of: NumberProperty(path: "Number"))
+                XCTAssertEqual(number, 42)
+                applied.fulfill()
+            }
+            wait(for: [applied], timeout: 10)
+        }
+    }
+
+    // MARK: - List Diffs
+    //
+    // Fixture: the "List" property of "Test" holds instances of the "Nested" view model.
+
+    @MainActor
+    func test_setInstances_insertsMovesAndRemovesItems() async throws {
+        let worker = try await Worker()
+        let file = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+        let instance = try await file.createViewModelInstance(.viewModelDefault(from: .name("Test")))
+        let list = ListProperty(path: "List")
+
+        var items: [ViewModelInstance] = []
+        for name in ["A", "B", "C", "D", "E"] {
+            let item = try await file.createViewModelInstance(.blank(from: .name("Nested")))
+            item.setValue(of: StringProperty(path: "String"), to: name)
+            items.append(item)
+        }
+
+        instance.setInstances(of: list, to: Array(items[0..<4]))
+        let populated = try await itemNames(of: list, in: instance)
+        XCTAssertEqual(populated, ["A", "B", "C", "D"])
+
+        instance.setInstances(of: list, to: [items[3], items[0], items[2], items[4]])
+        let diffed = try await itemNames(of: list, in: instance)
+        XCTAssertEqual(diffed, ["D", "A", "C", "E"])
+
+        instance.setInstances(of: list, to: [])
+        let size = try await instance.size(of: list)
+        XCTAssertEqual(size, 0)
+    }
+
+    /// Populates a 500-row list with one append command per row, as a baseline for the diff below.
+    @MainActor
+    func test_populateList_withAppends_performance() {
+        measureListPopulation(withDiff: false)
+    }
+
+    /// Populates the same list with a single diff command.
+    @MainActor
+    func test_populateList_withDiff_performance() {
+        measureListPopulation(withDiff: true)
+    }
+
+    @MainActor
+    private func measureListPopulation(withDiff: Bool) {
+        let rowCount = 500
+        let fixture = MeasurementFixture()
+        let setUp = expectation(description: "Set up")
+        Task { @MainActor in
+            let worker = try await Worker()
+            let file = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+            fixture.worker = worker
+            fixture.file = file
+            fixture.instance = try await file.createViewModelInstance(.viewModelDefault(from: .name("Test")))
+            for _ in 0..<rowCount {
+                fixture.rows.append(try await file.createViewModelInstance(.blank(from: .name("Nested"))))
+            }
+            setUp.fulfill()
+        }
+        wait(for: [setUp], timeout: 30)
+        guard let instance = fixture.instance else {
+            return XCTFail("Failed to set up list fixture")
+        }
+        let list = ListProperty(path: "List")
+
+        measure(metrics: [XCTClockMetric()]) {
+            let populated = expectation(description: "Populated")
+            instance.setInstances(of: list, to: [])
+            if withDiff {
+                instance.setInstances(of: list, to: fixture.rows)
+            } else {
+                for row in fixture.rows {
+                    instance.appendInstance(row, to: list)
+                }
+            }
+            Task { @MainActor in
+                let size = try await instance.size(of: list)
+                XCTAssertEqual(size, rowCount)
+                populated.fulfill()
+            }
+            wait(for: [populated], timeout: 10)
+        }
+    }
+
+    // MARK: - Global Assets
+
+    @MainActor
+    func test_replaceGlobalAsset_thenDeleteOlderFile_keepsNewerFileReference() async throws {
+        let worker = try await Worker()
+        let url = try XCTUnwrap(Bundle(for: Self.self).url(forResource: "1x1_png", withExtension: "png"))
+        let data = try Data(contentsOf: url)
+
+        let first = try await worker.decodeImage(from: data)
+        worker.addGlobalImageAsset(first, name: "shared")
+        var older: File? = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+
+        let second = try await worker.decodeImage(from: data)
+        worker.addGlobalImageAsset(second, name: "shared")
+        let newer = try await File(source: .local("data_binding_test", Bundle(for: Self.self)), worker: worker)
+
+        XCTAssertNotNil(older)
+        older = nil
+        // The older file is deleted from a task scheduled when it is released.
+        try await Task.sleep(nanoseconds: 200_000_000)
+
+        let statistics = try XCTUnwrap(worker.globalAssetStatistics.first { $0.name == "shared" })
+        XCTAssertEqual(statistics.fileReferenceCount, 1)
+        withExtendedLifetime((first, second, newer)) {}
+    }
+
+    @MainActor
+    func test_deleteGlobalImage_isDeliveredAfterEarlierImageMessages() async throws {
+        let worker = try await Worker()
+        let commandQueue = worker.dependencies.workerService.dependencies.commandQueue
+        let url = try XCTUnwrap(Bundle(for: Self.self).url(forResource: "1x1_png", withExtension: "png"))
+        let data = try Data(contentsOf: url)
+        let listener = RecordingRenderImageListener()
+
+        commandQueue.decodeImage(data, listener: listener, requestID: 1)
+        try await pumpMessages(of: commandQueue) { listener.events.count == 1 }
+        let shared = try XCTUnwrap(listener.events.first?.handle)
+        commandQueue.addGlobalImageAsset("shared", imageHandle: shared, encodedData: data, requestID: 2)
+
+        // The registry absorbs the delete, which must still be confirmed after
+        // the decode that was requested before it.
+        commandQueue.decodeImage(data, listener: listener, requestID: 3)
+        commandQueue.deleteImage(shared, requestID: 4)
+        try await pumpMessages(of: commandQueue) { listener.events.count == 3 }
+
+        XCTAssertEqual(listener.events.map(\.name), ["decoded", "decoded", "deleted"])
+        XCTAssertEqual(listener.events.map(\.requestID), [1, 3, 4])
+    }
+
+    @MainActor
+    private func pumpMessages(of commandQueue: CommandQueueProtocol, until done: () -> Bool) async throws {
+        for _ in 0..<200 where !done() {
+            try await Task.sleep(nanoseconds: 10_000_000)
+            commandQueue.processMessages()
+        }
+        XCTAssertTrue(done())
+    }
+
+    @MainActor
+    private func itemNames(of list: ListProperty, in instance: ViewModelInstance) async throws -> [String] {
+        let size = try await instance.size(of: list)
+        var names: [String] = []
+        for index in 0..<size {
+            let item = instance.value(of: list, at: Int32(index))
+            names.append(try await item.value(of: StringProperty(path: "String")))
+        }
+        return names
+    }
+}
+
+/// Objects created asynchronously before a measured block, kept alive for its iterations.
+@MainActor
+private final class MeasurementFixture {
+    var worker: Worker?
+    var file: File?
+    var instance: ViewModelInstance?
+    var rows: [ViewModelInstance] = []
+}
+
+/// Records the image messages it receives, in order.
+private final class RecordingRenderImageListener: NSObject, RenderImageListener {
+    struct Event {
+        let name: String
+        let handle: UInt64
+        let requestID: UInt64
+    }
+
+    var events: [Event] = []
+
+    func onRenderImageDecoded(_ renderImageHandle: UInt64, requestID: UInt64) {
+        events.append(Event(name: "decoded", handle: renderImageHandle, requestID: requestID))
+    }
+
+    func onRenderImageError(_ renderImageHandle: UInt64, requestID: UInt64, message: String) {
+        events.append(Event(name: "error", handle: renderImageHandle, requestID: requestID))
+    }
+
+    func onRenderImageDeleted(_ renderImageHandle: UInt64, requestID: UInt64) {
+        events.append(Event(name: "deleted", handle: renderImageHandle, requestID: requestID))
+    }
 }
@@ -147,6 +147,66 @@ final class RiveControllerTests: XCTestCase {
         }
     }
 
+    @MainActor
+    func test_handleInput_pointerMoves_sendsEveryMoveImmediately() async throws {
+        let fixture = try await makeController(dataBind: .none)
+
+        for x in 0..<3 {
+            fixture.controller.handleInput(.pointerMove(makePointerEvent(id: "touch-1", x: CGFloat(x))))
+        }
+
+        XCTAssertEqual(fixture.commandQueue.pointerMoveCalls.map(\.position.x), [0, 1, 2])
+    }
+
+    @MainActor
+    func test_handleInput_coalescedPointerMovesInOneFrame_sendsLatestMovePerPointerOnAdvance() async throws {
+        let fixture = try await makeController(dataBind: .none, coalescesPointerMoves: true)
+
+        for x in 0..<1000 {
+            fixture.controller.handleInput(.pointerMove(makePointerEvent(id: "touch-1", x: CGFloat(x))))
+            fixture.controller.handleInput(.pointerMove(makePointerEvent(id: "touch-2", x: CGFloat(-x))))
+        }
+        XCTAssertTrue(fixture.commandQueue.pointerMoveCalls.isEmpty)
+
+        _ = fixture.controller.advance(
+            now: 10,
+            isOnscreen: true,
+            drawableSize: CGSize(width: 100, height: 200),
+            scaleProvider: MockScaleProvider()
+        )
+
+        XCTAssertEqual(fixture.commandQueue.pointerMoveCalls.map(\.position.x), [999, -999])
+    }
+
+    @MainActor
+    func test_handleInput_pointerDownAfterCoalescedMoves_sendsMoveFirst() async throws {
+        let fixture = try await makeController(dataBind: .none, coalescesPointerMoves: true)
+
+        fixture.controller.handleInput(.pointerMove(makePointerEvent(id: "touch-1", x: 1)))
+        fixture.controller.handleInput(.pointerMove(makePointerEvent(id: "touch-1", x: 2)))
+        fixture.controller.handleInput(.pointerDown(makePointerEvent(id: "touch-1", x: 2)))
+
+        XCTAssertEqual(fixture.commandQueue.pointerMoveCalls.count, 1)
+        XCTAssertEqual(fixture.commandQueue.pointerDownCalls.count, 1)
+        XCTAssertEqual(fixture.commandQueue.pointerMoveCalls[0].position.x, 2)
+        XCTAssertLessThan(
+            fixture.commandQueue.pointerMoveCalls[0].requestID,
+            fixture.commandQueue.pointerDownCalls[0].requestID
+        )
+    }
+
+    @MainActor
+    func test_handleInput_coalescedPointerMoveWhilePaused_sendsImmediately() async throws {
+        let fixture = try await makeController(dataBind: .none, coalescesPointerMoves: true)
+        fixture.controller.handleInput(.pointerMove(makePointerEvent(id: "touch-1", x: 1)))
+
+        fixture.controller.isPaused = true
+        XCTAssertEqual(fixture.commandQueue.pointerMoveCalls.map(\.position.x), [1])
+
+        fixture.controller.handleInput(.pointerMove(makePointerEvent(id: "touch-1", x: 2)))
+        XCTAssertEqual(fixture.commandQueue.pointerMoveCalls.map(\.position.x), [1, 2])
+    }
+
     @MainActor
     func test_advance_whenSettledAndFirstDraw_returnsConfiguration_andAdvances() async throws {
         let fixture = try await makeController(dataBind: .none)
@@ -601,6 +661,105 @@ final class RiveControllerTests: XCTestCase {
         XCTAssertEqual(fixture.commandQueue.advanceStateMachineCalls[1].time, 0)
     }
 
+    @MainActor
+    func test_advance_whenFixedTimestep_advancesInWholeSteps_andCapsCatchUp() async throws {
+        let fixture = try await makeController(dataBind: .none, timestep: .fixed(rate: 60, maxStepsPerFrame: 4))
+
+        for now in [10, 10 + 1.0 / 60, 10 + 1.0 / 60 + 1.0 / 120, 10.5] {
+            _ = fixture.controller.advance(
+                now: now,
+                isOnscreen: false,
+                drawableSize: CGSize(width: 100, height: 200),
+                scaleProvider: MockScaleProvider()
+            )
+        }
+
+        // The first frame advances by 0, the second by one step, the third is
+        // not yet due, and the fourth catches up at most four steps.
+        let times = fixture.commandQueue.advanceStateMachineCalls.map(\.time)
+        XCTAssertEqual(times, [0] + Array(repeating: 1.0 / 60, count: 5))
+    }
+
+    @MainActor
+    func test_advance_whenFixedTimestepAndFramesJitter_advancesOneStepPerFrame() async throws {
+        let fixture = try await makeController(dataBind: .none, timestep: .fixed(rate: 60))
+
+        var now: TimeInterval = 10
+        for frame in 0..<120 {
+            now += 1.0 / 60 + (frame.isMultiple(of: 2) ? 0.001 : -0.001)
+            _ = fixture.controller.advance(
+                now: now,
+                isOnscreen: false,
+                drawableSize: CGSize(width: 100, height: 200),
+                scaleProvider: MockScaleProvider()
+            )
+        }
+
+        let times = fixture.commandQueue.advanceStateMachineCalls.map(\.time)
+        XCTAssertEqual(times, [0] + Array(repeating: 1.0 / 60, count: 119))
+    }
+
+    @MainActor
+    func test_advance_whenFixedTimestepStepNotDue_skipsDrawAndKeepsDirty() async throws {
+        let fixture = try await makeController(dataBind: .none, timestep: .fixed(rate: 60))
+        let size = CGSize(width: 100, height: 200)
+
+        let first = fixture.controller.advance(
+            now: 10,
+            isOnscreen: true,
+            drawableSize: size,
+            scaleProvider: MockScaleProvider()
+        )
+        XCTAssertNotNil(first)
+
+        fixture.controller.handleInput(.pointerDown(makePointerEvent(id: "touch-1", x: 1)))
+        let notDue = fixture.controller.advance(
+            now: 10 + 1.0 / 240,
+            isOnscreen: true,
+            drawableSize: size,
+            scaleProvider: MockScaleProvider()
+        )
+        XCTAssertNil(notDue)
+        XCTAssertEqual(fixture.commandQueue.advanceStateMachineCalls.count, 1)
+
+        // The input has not been advanced over yet, so a settle must not settle the view.
+        await emitSettledAndAwaitPending(within: fixture, requestID: 2)
+        fixture.controller.resolveForTesting()
+        XCTAssertFalse(fixture.controller.isSettled)
+
+        let resized = fixture.controller.advance(
+            now: 10 + 2.0 / 240,
+            isOnscreen: true,
+            drawableSize: CGSize(width: 200, height: 400),
+            scaleProvider: MockScaleProvider()
+        )
+        XCTAssertNotNil(resized)
+        XCTAssertEqual(fixture.commandQueue.advanceStateMachineCalls.count, 1)
+    }
+
+    @MainActor
+    func test_advance_whenFixedTimestep_repeatedRunsAdvanceIdentically() async throws {
+        var runs: [[Double]] = []
+        for _ in 0..<2 {
+            let fixture = try await makeController(dataBind: .none, timestep: .fixed(rate: 60))
+            var now: TimeInterval = 10
+            // Irregular frames, including hitches, as when a test runs on a loaded machine.
+            for delta in [0.016, 0.017, 0.05, 0.004, 0.2, 0.016, 0.033, 0.001] {
+                now += delta
+                _ = fixture.controller.advance(
+                    now: now,
+                    isOnscreen: false,
+                    drawableSize: CGSize(width: 100, height: 200),
+                    scaleProvider: MockScaleProvider()
+                )
+            }
+            runs.append(fixture.commandQueue.advanceStateMachineCalls.map(\.time))
+        }
+
+        XCTAssertEqual(runs[0], runs[1])
+        XCTAssertEqual(Set(runs[0].dropFirst()), [1.0 / 60])
+    }
+
     @MainActor
     func test_advance_whenPaused_allowsFirstDraw_thenBlocksSubsequentDraws() async throws {
         let fixture = try await makeController(dataBind: .none)
@@ -1096,10 +1255,23 @@ final class RiveControllerTests: XCTestCase {
 
     // MARK: - Helpers
 
+    private func makePointerEvent(id: String, x: CGFloat) -> PointerEvent {
+        return PointerEvent(
+            id: id,
+            position: CGPoint(x: x, y: 20),
+            bounds: CGSize(width: 100, height: 200),
+            fit: .contain,
+            alignment: .center,
+            scaleFactor: 1
+        )
+    }
+
     @MainActor
     private func makeController(
         dataBind: DataBind = .none,
         fit: Fit = .contain(alignment: .center),
+        timestep: Timestep = .variable,
+        coalescesPointerMoves: Bool = false,
         delegate: MockControllerDelegate? = nil
     ) async throws -> ControllerFixture {
         let delegate = delegate ?? MockControllerDelegate()
@@ -1130,7 +1302,9 @@ final class RiveControllerTests: XCTestCase {
             artboard: artboard,
             stateMachine: stateMachine,
             dataBind: dataBind,
-            fit: fit
+            fit: fit,
+            timestep: timestep,
+            coalescesPointerMoves: coalescesPointerMoves
         )
 
         let controller = RiveController(rive: rive, delegate: delegate)
@@ -115,7 +115,8 @@ class WorkerTests: XCTestCase {
         let mockRenderImageService = ImageService(dependencies: .init(commandQueue: mockCommandQueue, messageGate: CommandQueueMessageGate(driver: mockCommandQueue)))
         let renderImageDependencies = Image.Dependencies(imageService: mockRenderImageService)
         let imageHandle: UInt64 = 123
-        let renderImage = Image(handle: imageHandle, dependencies: renderImageDependencies)
+        let encodedData = Data([0x89, 0x50, 0x4E, 0x47])
+        let renderImage = Image(handle: imageHandle, dependencies: renderImageDependencies, encodedData: encodedData)
         
         let imageName = "testImage"
         
@@ -125,6 +126,7 @@ class WorkerTests: XCTestCase {
         let addCall = mockCommandQueue.addGlobalImageAssetCalls.first!
         XCTAssertEqual(addCall.name, imageName)
         XCTAssertEqual(addCall.imageHandle, imageHandle)
+        XCTAssertEqual(addCall.encodedData, encodedData)
         XCTAssertEqual(addCall.requestID, 0)
         
         worker.removeGlobalImageAsset(name: imageName)
@@ -212,4 +214,52 @@ class WorkerTests: XCTestCase {
         XCTAssertEqual(removeCall.name, audioName)
         XCTAssertEqual(removeCall.requestID, 1)
     }
+
+    @MainActor
+    func test_globalAssetBudgetStatisticsAndTrim_passThroughToCommandQueue() async {
+        let mockCommandQueue = MockCommandQueue()
+        let mockCommandServer = MockCommandServer()
+        let device = await MetalDevice.shared.defaultDevice()!.value
+        let workerService = WorkerService(
+            dependencies: .init(
+                commandQueue: mockCommandQueue,
+                commandServer: mockCommandServer,
+                renderContext: RiveUIRenderContext(device: device),
+                messagePumpDriver: mockCommandQueue
+            )
+        )
+        let worker = Worker(dependencies: .init(workerService: workerService))
+
+        worker.globalAssetMemoryBudget = 1024
+        XCTAssertEqual(mockCommandQueue.globalAssetMemoryBudget, 1024)
+        XCTAssertEqual(worker.globalAssetMemoryBudget, 1024)
+
+        mockCommandQueue.stubGlobalAssetStatistics {
+            [
+                [
+                    "name": "hero", "type": "image", "byteCount": 4096, "resident": false,
+                    "heldByClient": false, "fileReferenceCount": 0, "redecodeCount": 2
+                ],
+                ["name": "unknown", "type": "video"]
+            ]
+        }
+        XCTAssertEqual(
+            worker.globalAssetStatistics,
+            [
+                GlobalAssetStatistics(
+                    name: "hero",
+                    type: .image,
+                    byteCount: 4096,
+                    isResident: false,
+                    isHeldByClient: false,
+                    fileReferenceCount: 0,
+                    redecodeCount: 2
+                )
+            ]
+        )
+
+        mockCommandQueue.stubTrimGlobalAssets { 4096 }
+        XCTAssertEqual(worker.trimGlobalAssets(), 4096)
+        XCTAssertEqual(mockCommandQueue.trimGlobalAssetsCalls.count, 1)
+    }
 }
@@ -224,6 +224,17 @@ class DataBindingTests: XCTestCase {
         XCTAssertTrue(stringPropertyFromNested === nestedStringProperty)
     }
 
+    func test_viewModelInstance_properties_withPath_cachedLookup_performance() throws {
+        let instance = file.viewModelNamed("Test")!.createDefaultInstance()!
+        XCTAssertNotNil(instance.stringProperty(fromPath: "Nested/String"))
+
+        measure(metrics: [XCTClockMetric()]) {
+            for _ in 0..<10_000 {
+                _ = instance.stringProperty(fromPath: "Nested/String")
+            }
+        }
+    }
+
     // MARK: String
 
     func test_viewModelInstance_stringProperty_returnsPropertyOrNil() {
@@ -1249,6 +1260,59 @@ class DataBindingTests: XCTestCase {
 
         wait(for: [expectation], timeout: 1)
     }
+
+    func test_updateListeners_clearsChangesOfUnobservedProperties() throws {
+        let instance = file.viewModelNamed("Test")!.createDefaultInstance()!
+        let artboard = try file.artboard()
+        let stateMachine = try artboard.stateMachine(from: 0)
+        stateMachine.bind(viewModelInstance: instance)
+        let string = instance.stringProperty(fromPath: "String")!
+        let observed = instance.numberProperty(fromPath: "Number")!
+        observed.addListener { _ in }
+
+        string.value = "Before"
+        stateMachine.advance(by: 0)
+        XCTAssertTrue(string.hasChanged)
+        instance.updateListeners()
+        XCTAssertFalse(string.hasChanged)
+
+        var values: [String] = []
+        string.addListener { value in
+            values.append(value)
+        }
+        stateMachine.advance(by: 0)
+        instance.updateListeners()
+        XCTAssertEqual(values, [])
+
+        string.value = "After"
+        stateMachine.advance(by: 0)
+        instance.updateListeners()
+        XCTAssertEqual(values, ["After"])
+    }
+
+    func test_updateListeners_withManyUnobservedProperties_performance() throws {
+        let instance = file.viewModelNamed("Test")!.createDefaultInstance()!
+        let list = instance.listProperty(fromPath: "List")!
+        var properties: [Any] = []
+        for _ in 0..<200 {
+            let item = file.viewModelNamed("Test")!.createDefaultInstance()!
+            list.append(item)
+            properties.append(item.stringProperty(fromPath: "String")!)
+            properties.append(item.numberProperty(fromPath: "Number")!)
+            properties.append(item.booleanProperty(fromPath: "Boolean")!)
+            properties.append(item.colorProperty(fromPath: "Color")!)
+            properties.append(item.enumProperty(fromPath: "Enum")!)
+        }
+        let string = instance.stringProperty(fromPath: "String")!
+        string.addListener { _ in }
+
+        measure(metrics: [XCTClockMetric()]) {
+            for _ in 0..<100 {
+                instance.updateListeners()
+            }
+        }
+        XCTAssertEqual(properties.count, 1000)
+    }
 }
 
 // MARK: - Helpers
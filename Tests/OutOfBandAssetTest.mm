@@ -249,4 +249,77 @@
     XCTAssertEqual(image.size.height, 240);
 }
 
+- (void)testEmbeddedAssetDataIsNotCopied
+{
+    NSData* data = [Util loadTestData:@"embedded_assets"];
+    const uint8_t* begin = (const uint8_t*)data.bytes;
+    const uint8_t* end = begin + data.length;
+    __block NSUInteger assetCount = 0;
+    __block NSMutableSet<NSValue*>* factories = [NSMutableSet set];
+
+    RiveFile* file = [[RiveFile alloc]
+             initWithData:data
+                  loadCdn:false
+        customAssetLoader:^bool(
+            RiveFileAsset* asset, NSData* assetData, RiveFactory* factory) {
+          if (assetData.length > 0)
+          {
+              // Embedded bytes reference the imported buffer.
+              const uint8_t* bytes = (const uint8_t*)assetData.bytes;
+              XCTAssertTrue(bytes >= begin && bytes + assetData.length <= end);
+              assetCount++;
+          }
+          [factories addObject:[NSValue valueWithNonretainedObject:factory]];
+          return false;
+        }
+                    error:nil];
+
+    XCTAssertNotNil(file);
+    XCTAssertEqual(assetCount, 2);
+    // A single factory wrapper is shared by every asset of an import.
+    XCTAssertEqual(factories.count, 1);
+}
+
+- (void)testEmbeddedAssetsImportMemory
+{
+    NSData* data = [Util loadTestData:@"embedded_assets"];
+    [self measureWithMetrics:@[ [[XCTMemoryMetric alloc] init] ]
+                       block:^{
+                         for (int i = 0; i < 100; i++)
+                         {
+                             RiveFile* file = [[RiveFile alloc]
+                                      initWithData:data
+                                           loadCdn:false
+                                 customAssetLoader:^bool(RiveFileAsset* asset,
+                                                         NSData* assetData,
+                                                         RiveFactory* factory) {
+                                   return false;
+                                 }
+                                             error:nil];
+                             XCTAssertNotNil(file);
+                         }
+                       }];
+}
+
+/// Resident memory of many instances of a file with embedded audio, none of
+/// which has played its audio.
+- (void)testAudioInstancesMemory
+{
+    NSData* data = [Util loadTestData:@"audio_test"];
+    [self measureWithMetrics:@[ [[XCTMemoryMetric alloc] init] ]
+                       block:^{
+                         RiveFile* file = [[RiveFile alloc] initWithData:data
+                                                                 loadCdn:false
+                                                                   error:nil];
+                         NSMutableArray* artboards = [NSMutableArray array];
+                         for (int i = 0; i < 100; i++)
+                         {
+                             RiveArtboard* artboard = [file artboard:nil];
+                             XCTAssertNotNil(artboard);
+                             [artboard advanceBy:0];
+                             [artboards addObject:artboard];
+                         }
+                       }];
+}
+
 @end
@@ -101,4 +101,106 @@
                                     scale:scale]);
 }
 
+- (void)testBufferRingStatsStartEmpty
+{
+    RenderContext* context = [[RenderContextManager shared]
+        newCGContextWithBufferRingDepth:2
+                        blockingAcquire:NO];
+    RenderContextBufferRingStats stats = [context bufferRingStats];
+    XCTAssertEqual(stats.acquireCount, 0);
+    XCTAssertEqual(stats.waitCount, 0);
+    XCTAssertEqual(stats.skipCount, 0);
+    XCTAssertEqual(stats.totalWaitTime, 0);
+    XCTAssertEqual(stats.maxWaitTime, 0);
+
+    context = [[RenderContextManager shared] newRiveContext];
+    stats = [context bufferRingStats];
+    XCTAssertEqual(stats.acquireCount, 0);
+}
+
+- (void)testAcquireSkipsWhenEveryBufferIsHeld
+{
+    CGRendererContext* context =
+        [[CGRendererContext alloc] initWithBufferRingDepth:2
+                                           blockingAcquire:NO];
+    XCTAssertTrue([context acquireBuffer]);
+    XCTAssertTrue([context acquireBuffer]);
+    XCTAssertFalse([context acquireBuffer]);
+
+    RenderContextBufferRingStats stats = [context bufferRingStats];
+    XCTAssertEqual(stats.acquireCount, 2);
+    XCTAssertEqual(stats.skipCount, 1);
+    XCTAssertEqual(stats.waitCount, 0);
+
+    [context releaseBuffer];
+    XCTAssertTrue([context acquireBuffer]);
+    [context releaseBuffer];
+    [context releaseBuffer];
+}
+
+- (void)testBlockingAcquireWaitsForReleasedBuffer
+{
+    CGRendererContext* context =
+        [[CGRendererContext alloc] initWithBufferRingDepth:1
+                                           blockingAcquire:YES];
+    XCTAssertTrue([context acquireBuffer]);
+
+    dispatch_after(
+        dispatch_time(DISPATCH_TIME_NOW, (int64_t)(50 * NSEC_PER_MSEC)),
+        dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0),
+        ^{
+          [context releaseBuffer];
+        });
+    XCTAssertTrue([context acquireBuffer]);
+
+    RenderContextBufferRingStats stats = [context bufferRingStats];
+    XCTAssertEqual(stats.acquireCount, 2);
+    XCTAssertEqual(stats.waitCount, 1);
+    XCTAssertEqual(stats.skipCount, 0);
+    XCTAssertGreaterThan(stats.maxWaitTime, 0);
+    XCTAssertEqual(stats.totalWaitTime, stats.maxWaitTime);
+    [context releaseBuffer];
+}
+
+- (void)testCommandBufferCompletionReleasesBuffer
+{
+    CGRendererContext* context =
+        [[CGRendererContext alloc] initWithBufferRingDepth:1
+                                           blockingAcquire:NO];
+    XCTAssertTrue([context acquireBuffer]);
+
+    id<MTLCommandBuffer> commandBuffer = [context.metalQueue commandBuffer];
+    [context releaseBufferOnCompletionOfCommandBuffer:commandBuffer];
+    // Completed handlers run in the order they were added.
+    XCTestExpectation* completed =
+        [self expectationWithDescription:@"command buffer completed"];
+    [commandBuffer addCompletedHandler:^(id<MTLCommandBuffer> buffer) {
+      [completed fulfill];
+    }];
+    XCTAssertFalse([context acquireBuffer]);
+    [commandBuffer commit];
+    [self waitForExpectations:@[ completed ] timeout:5];
+
+    XCTAssertTrue([context acquireBuffer]);
+    RenderContextBufferRingStats stats = [context bufferRingStats];
+    XCTAssertEqual(stats.acquireCount, 2);
+    XCTAssertEqual(stats.skipCount, 1);
+    [context releaseBuffer];
+}
+
+- (void)testBufferRingDepthOfZeroCanStillDraw
+{
+    CGRect rect = CGRectMake(0, 0, 320, 240);
+    CGSize drawableSize = CGSizeMake(320, 240);
+    CGFloat scale = 1.0f;
+
+    RenderContext* context = [[RenderContextManager shared]
+        newCGContextWithBufferRingDepth:0
+                        blockingAcquire:YES];
+    XCTAssertNotNil(context);
+    XCTAssertTrue([context canDrawInRect:rect
+                            drawableSize:drawableSize
+                                   scale:scale]);
+}
+
 @end
@@ -0,0 +1,143 @@
+//
+//  RiveAdvanceSchedulerTests.swift
+//  RiveRuntimeTests
+//
+//  Copyright © 2026 Rive. All rights reserved.
+//
+
+import XCTest
+@testable import RiveRuntime
+
+class RiveAdvanceSchedulerTests: XCTestCase {
+    func test_advance_matchesAdvancingOneByOne() throws {
+        let file = try RiveFile(testfileName: "what_a_state")
+        let serial = try makeModels(count: 8, from: file, stateMachineName: "State Machine 2")
+        let scheduled = try makeModels(count: 8, from: file, stateMachineName: "State Machine 2")
+
+        for delta in [0.1, 0.5, 0.6, 0.1] {
+            let serialResults = serial.map { $0.stateMachine!.advance(by: delta) }
+            let scheduledResults = RiveAdvanceScheduler.shared.advance(scheduled, by: delta)
+            XCTAssertEqual(scheduledResults, serialResults)
+            XCTAssertEqual(
+                scheduled.map { $0.stateMachine!.stateChanges() },
+                serial.map { $0.stateMachine!.stateChanges() }
+            )
+        }
+    }
+
+    func test_advance_withoutStateMachine_returnsFalse() throws {
+        let file = try RiveFile(testfileName: "what_a_state")
+        let models = try makeModels(count: 2, from: file, stateMachineName: "State Machine 2")
+        let withoutStateMachine = RiveModel(riveFile: file)
+        try withoutStateMachine.setArtboard()
+
+        let results = RiveAdvanceScheduler.shared.advance([models[0], withoutStateMachine, models[1]], by: 0.1)
+        XCTAssertEqual(results.count, 3)
+        XCTAssertFalse(results[1])
+        XCTAssertEqual(results[0], results[2])
+    }
+
+    func test_advance_inParallel_matchesAdvancingOneByOne() throws {
+        let scheduler = RiveAdvanceScheduler()
+        scheduler.advancesInParallel = true
+        let serial = try (0..<8).map { _ in try makeModel(testfileName: "what_a_state", stateMachineName: "State Machine 2") }
+        let scheduled = try (0..<8).map { _ in try makeModel(testfileName: "what_a_state", stateMachineName: "State Machine 2") }
+        XCTAssertEqual(scheduler.independentGroups(of: scheduled).count, 8)
+
+        for delta in [0.1, 0.5, 0.6, 0.1] {
+            let serialResults = serial.map { $0.stateMachine!.advance(by: delta) }
+            XCTAssertEqual(scheduler.advance(scheduled, by: delta), serialResults)
+            XCTAssertEqual(
+                scheduled.map { $0.stateMachine!.stateChanges() },
+                serial.map { $0.stateMachine!.stateChanges() }
+            )
+        }
+    }
+
+    func test_independentGroups_sameFile_areGrouped() throws {
+        let file = try RiveFile(testfileName: "what_a_state")
+        let models = try makeModels(count: 3, from: file, stateMachineName: "State Machine 2")
+        XCTAssertEqual(RiveAdvanceScheduler.shared.independentGroups(of: models), [[0, 1, 2]])
+    }
+
+    func test_independentGroups_filesSharingCachedImport_areGrouped() throws {
+        let cache = RiveFileCache.shared
+        let wasEnabled = cache.isEnabled
+        cache.isEnabled = true
+        defer { cache.isEnabled = wasEnabled }
+
+        let first = try RiveFile(testfileName: "what_a_state")
+        let second = try RiveFile(testfileName: "what_a_state")
+        XCTAssertEqual(first.importIdentifier, second.importIdentifier)
+
+        let models = [
+            try makeModels(count: 1, from: first, stateMachineName: "State Machine 2")[0],
+            try makeModels(count: 1, from: second, stateMachineName: "State Machine 2")[0],
+        ]
+        XCTAssertEqual(RiveAdvanceScheduler.shared.independentGroups(of: models), [[0, 1]])
+    }
+
+    func test_independentGroups_sharedNestedViewModelInstance_areGrouped() throws {
+        let first = try makeModel(testfileName: "data_binding_test", stateMachineName: nil)
+        let second = try makeModel(testfileName: "data_binding_test", stateMachineName: nil)
+        let third = try makeModel(testfileName: "data_binding_test", stateMachineName: nil)
+        let instance = first.riveFile.viewModelNamed("Test")!.createDefaultInstance()!
+        first.stateMachine!.bind(viewModelInstance: instance)
+        third.stateMachine!.bind(viewModelInstance: third.riveFile.viewModelNamed("Test")!.createDefaultInstance()!)
+        XCTAssertEqual(RiveAdvanceScheduler.shared.independentGroups(of: [first, second, third]), [[0], [1], [2]])
+
+        // Only the instance nested two levels down is shared.
+        second.stateMachine!.bind(viewModelInstance: instance.viewModelInstanceProperty(fromPath: "Nested/DeeperNested")!)
+        XCTAssertEqual(RiveAdvanceScheduler.shared.independentGroups(of: [first, second, third]), [[0, 1], [2]])
+    }
+
+    // MARK: - Performance
+
+    /// Advances 40 state machines one after another, as 40 views each advancing on their own
+    /// would, for a second at 60 fps. The models have no views or renderer, so only advancing is
+    /// measured.
+    func test_advanceFeed_oneByOne_performance() throws {
+        let models = try makeFeed()
+        measure(metrics: [XCTClockMetric()]) {
+            for _ in 0..<60 {
+                for model in models {
+                    model.stateMachine?.advance(by: 1.0 / 60)
+                }
+            }
+        }
+    }
+
+    /// As above, advancing all 40 state machines as one batch per frame.
+    func test_advanceFeed_scheduled_performance() throws {
+        let models = try makeFeed()
+        measure(metrics: [XCTClockMetric()]) {
+            for _ in 0..<60 {
+                _ = RiveAdvanceScheduler.shared.advance(models, by: 1.0 / 60)
+            }
+        }
+    }
+
+    // MARK: - Helpers
+
+    private func makeFeed() throws -> [RiveModel] {
+        let file = try RiveFile(testfileName: "off_road_car_blog")
+        return try makeModels(count: 40, from: file, stateMachineName: nil)
+    }
+
+    private func makeModel(testfileName: String, stateMachineName: String?) throws -> RiveModel {
+        return try makeModels(count: 1, from: RiveFile(testfileName: testfileName), stateMachineName: stateMachineName)[0]
+    }
+
+    private func makeModels(count: Int, from file: RiveFile, stateMachineName: String?) throws -> [RiveModel] {
+        return try (0..<count).map { _ in
+            let model = RiveModel(riveFile: file)
+            try model.setArtboard()
+            if let stateMachineName {
+                try model.setStateMachine(stateMachineName)
+            } else {
+                try model.setStateMachine()
+            }
+            return model
+        }
+    }
+}
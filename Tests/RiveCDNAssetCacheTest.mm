@@ -0,0 +1,380 @@
+//
+//  RiveCDNAssetCacheTest.mm
+//  RiveRuntimeTests
+//
+//  Tests the CDN asset cache against a stand-in CDN served by a URL
+//  protocol, so that no network access is needed.
+//
+
+#import <XCTest/XCTest.h>
+#import "Rive.h"
+#import "util.h"
+
+/// The stand-in CDN. Serves fixed bodies with an ETag, answers matching
+/// If-None-Match requests with 304, and records every request it sees.
+@interface RiveCDNStubProtocol : NSURLProtocol
+@end
+
+static NSMutableDictionary<NSString*, NSData*>* stubBodies;
+static NSMutableArray<NSURLRequest*>* stubRequests;
+static NSUInteger stubActiveCount;
+static NSUInteger stubMaximumActiveCount;
+static NSTimeInterval stubDelay;
+static BOOL stubOffline;
+
+@implementation RiveCDNStubProtocol
+
++ (void)reset
+{
+    @synchronized(self)
+    {
+        stubBodies = [NSMutableDictionary dictionary];
+        stubRequests = [NSMutableArray array];
+        stubActiveCount = 0;
+        stubMaximumActiveCount = 0;
+        stubDelay = 0;
+        stubOffline = NO;
+    }
+}
+
++ (NSArray<NSURLRequest*>*)requests
+{
+    @synchronized(self)
+    {
+        return [stubRequests copy];
+    }
+}
+
++ (BOOL)canInitWithRequest:(NSURLRequest*)request
+{
+    return [request.URL.host isEqualToString:@"cdn.test"];
+}
+
++ (NSURLRequest*)canonicalRequestForRequest:(NSURLRequest*)request
+{
+    return request;
+}
+
+- (void)startLoading
+{
+    NSData* body = nil;
+    NSTimeInterval delay = 0;
+    BOOL offline = NO;
+    @synchronized([RiveCDNStubProtocol class])
+    {
+        [stubRequests addObject:self.request];
+        body = stubBodies[self.request.URL.lastPathComponent];
+        delay = stubDelay;
+        offline = stubOffline;
+        stubActiveCount++;
+        stubMaximumActiveCount = MAX(stubMaximumActiveCount, stubActiveCount);
+    }
+
+    dispatch_after(
+        dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)),
+        dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0),
+        ^{
+          @synchronized([RiveCDNStubProtocol class])
+          {
+              stubActiveCount--;
+          }
+          if (offline)
+          {
+              [self.client
+                        URLProtocol:self
+                   didFailWithError:
+                       [NSError
+                           errorWithDomain:NSURLErrorDomain
+                                      code:NSURLErrorNotConnectedToInternet
+                                  userInfo:nil]];
+              return;
+          }
+
+          NSString* etag = [NSString
+              stringWithFormat:@"\"%lu\"", (unsigned long)body.hash];
+          NSInteger status = body == nil ? 404 : 200;
+          if (body != nil &&
+              [[self.request valueForHTTPHeaderField:@"If-None-Match"]
+                  isEqualToString:etag])
+          {
+              status = 304;
+          }
+          NSHTTPURLResponse* response =
+              [[NSHTTPURLResponse alloc] initWithURL:self.request.URL
+                                          statusCode:status
+                                         HTTPVersion:@"HTTP/1.1"
+                                        headerFields:@{@"ETag" : etag}];
+          [self.client URLProtocol:self
+                didReceiveResponse:response
+                cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+          if (status == 200)
+          {
+              [self.client URLProtocol:self didLoadData:body];
+          }
+          [self.client URLProtocolDidFinishLoading:self];
+        });
+}
+
+- (void)stopLoading
+{}
+
+@end
+
+@interface RiveCDNAssetCacheTest : XCTestCase
+@property(nonatomic) NSURL* directoryURL;
+@end
+
+@implementation RiveCDNAssetCacheTest
+
+- (void)setUp
+{
+    [RiveCDNStubProtocol reset];
+    self.directoryURL = [[NSURL fileURLWithPath:NSTemporaryDirectory()]
+        URLByAppendingPathComponent:[NSUUID UUID].UUIDString
+                        isDirectory:YES];
+}
+
+- (void)tearDown
+{
+    [[NSFileManager defaultManager] removeItemAtURL:self.directoryURL
+                                              error:nil];
+}
+
+- (RiveCDNAssetCache*)makeCache
+{
+    NSURLSessionConfiguration* configuration =
+        [NSURLSessionConfiguration ephemeralSessionConfiguration];
+    configuration.protocolClasses = @[ [RiveCDNStubProtocol class] ];
+    return [[RiveCDNAssetCache alloc] initWithDirectoryURL:self.directoryURL
+                                      sessionConfiguration:configuration];
+}
+
+- (NSURL*)urlForUUID:(NSString*)uuid
+{
+    return [NSURL
+        URLWithString:[NSString stringWithFormat:@"https://cdn.test/%@", uuid]];
+}
+
+- (NSData*)fetchUUID:(NSString*)uuid
+           fromCache:(RiveCDNAssetCache*)cache
+               error:(NSError**)error
+{
+    XCTestExpectation* done = [self expectationWithDescription:uuid];
+    __block NSData* result = nil;
+    __block NSError* resultError = nil;
+    [cache fetchAssetWithUUID:uuid
+                          url:[self urlForUUID:uuid]
+                   completion:^(NSData* data, NSError* fetchError) {
+                     result = data;
+                     resultError = fetchError;
+                     [done fulfill];
+                   }];
+    [self waitForExpectations:@[ done ] timeout:5];
+    if (error != nil)
+    {
+        *error = resultError;
+    }
+    return result;
+}
+
+/// The first fetch downloads the asset; later fetches, including from a new
+/// cache over the same directory, are served from disk.
+- (void)testFetchesAreServedFromDisk
+{
+    NSData* body = [Util loadTestData:@"flux_capacitor"];
+    stubBodies[@"uuid-a"] = body;
+
+    RiveCDNAssetCache* cache = [self makeCache];
+    XCTAssertEqualObjects([self fetchUUID:@"uuid-a" fromCache:cache error:nil],
+                          body);
+    XCTAssertEqualObjects([self fetchUUID:@"uuid-a" fromCache:cache error:nil],
+                          body);
+    XCTAssertEqual(RiveCDNStubProtocol.requests.count, 1);
+    XCTAssertEqual(cache.downloadCount, 1);
+    XCTAssertEqual(cache.hitCount, 1);
+    XCTAssertEqual(cache.totalByteCount, body.length);
+
+    RiveCDNAssetCache* relaunched = [self makeCache];
+    XCTAssertEqualObjects([self fetchUUID:@"uuid-a"
+                                fromCache:relaunched
+                                    error:nil],
+                          body);
+    XCTAssertEqual(RiveCDNStubProtocol.requests.count, 1);
+    XCTAssertEqual(relaunched.hitCount, 1);
+}
+
+/// Concurrent fetches of the same UUID share a single download.
+- (void)testConcurrentFetchesAreCoalesced
+{
+    NSData* body = [Util loadTestData:@"multipleartboards"];
+    stubBodies[@"uuid-b"] = body;
+    stubDelay = 0.2;
+
+    RiveCDNAssetCache* cache = [self makeCache];
+    NSMutableArray<XCTestExpectation*>* expectations = [NSMutableArray array];
+    for (int i = 0; i < 8; i++)
+    {
+        XCTestExpectation* done =
+            [self expectationWithDescription:[NSString
+                                                 stringWithFormat:@"%d", i]];
+        [expectations addObject:done];
+        [cache fetchAssetWithUUID:@"uuid-b"
+                              url:[self urlForUUID:@"uuid-b"]
+                       completion:^(NSData* data, NSError* error) {
+                         XCTAssertEqualObjects(data, body);
+                         [done fulfill];
+                       }];
+    }
+    [self waitForExpectations:expectations timeout:5];
+    XCTAssertEqual(RiveCDNStubProtocol.requests.count, 1);
+    XCTAssertEqual(cache.coalescedCount, 7);
+}
+
+/// Cancelling one of several coalesced requests does not cancel the others.
+- (void)testCancellingOneRequestKeepsOthers
+{
+    NSData* body = [Util loadTestData:@"sample6"];
+    stubBodies[@"uuid-c"] = body;
+    stubDelay = 0.2;
+
+    RiveCDNAssetCache* cache = [self makeCache];
+    XCTestExpectation* cancelled = [self expectationWithDescription:@"cancel"];
+    XCTestExpectation* loaded = [self expectationWithDescription:@"loaded"];
+    RiveCDNAssetRequest* request =
+        [cache fetchAssetWithUUID:@"uuid-c"
+                              url:[self urlForUUID:@"uuid-c"]
+                       completion:^(NSData* data, NSError* error) {
+                         XCTAssertEqual(error.code, NSURLErrorCancelled);
+                         [cancelled fulfill];
+                       }];
+    [cache fetchAssetWithUUID:@"uuid-c"
+                          url:[self urlForUUID:@"uuid-c"]
+                   completion:^(NSData* data, NSError* error) {
+                     XCTAssertEqualObjects(data, body);
+                     [loaded fulfill];
+                   }];
+    [request cancel];
+    [self waitForExpectations:@[ cancelled, loaded ] timeout:5];
+}
+
+/// Hits update access times in memory, and save them later rather than
+/// rewriting the asset's info on every hit.
+- (void)testHitsSaveAccessTimesLater
+{
+    stubBodies[@"uuid-f"] = [Util loadTestData:@"flux_capacitor"];
+    NSURL* infoURL =
+        [self.directoryURL URLByAppendingPathComponent:@"uuid-f.plist"];
+
+    NSDate* downloadedAccess = nil;
+    @autoreleasepool
+    {
+        RiveCDNAssetCache* cache = [self makeCache];
+        [self fetchUUID:@"uuid-f" fromCache:cache error:nil];
+        downloadedAccess =
+            [NSDictionary dictionaryWithContentsOfURL:infoURL][@"lastAccess"];
+        XCTAssertNotNil(downloadedAccess);
+
+        [self fetchUUID:@"uuid-f" fromCache:cache error:nil];
+        XCTAssertEqual(cache.hitCount, 1);
+        XCTAssertEqualObjects(
+            [NSDictionary dictionaryWithContentsOfURL:infoURL][@"lastAccess"],
+            downloadedAccess);
+    }
+
+    // Releasing the cache saves what it held.
+    NSDate* savedAccess =
+        [NSDictionary dictionaryWithContentsOfURL:infoURL][@"lastAccess"];
+    XCTAssertEqual([savedAccess compare:downloadedAccess],
+                   NSOrderedDescending);
+}
+
+/// Stale assets are revalidated with their ETag, and reused when unchanged.
+- (void)testStaleAssetsAreRevalidated
+{
+    NSData* body = [Util loadTestData:@"what_a_state"];
+    stubBodies[@"uuid-d"] = body;
+
+    RiveCDNAssetCache* cache = [self makeCache];
+    cache.revalidationInterval = 0;
+    [self fetchUUID:@"uuid-d" fromCache:cache error:nil];
+    XCTAssertEqualObjects([self fetchUUID:@"uuid-d" fromCache:cache error:nil],
+                          body);
+
+    NSArray<NSURLRequest*>* requests = RiveCDNStubProtocol.requests;
+    XCTAssertEqual(requests.count, 2);
+    XCTAssertNil([requests[0] valueForHTTPHeaderField:@"If-None-Match"]);
+    XCTAssertNotNil([requests[1] valueForHTTPHeaderField:@"If-None-Match"]);
+    XCTAssertEqual(cache.revalidationCount, 1);
+    XCTAssertEqual(cache.downloadCount, 1);
+}
+
+/// Stale assets are used when the CDN cannot be reached.
+- (void)testStaleAssetsAreUsedOffline
+{
+    NSData* body = [Util loadTestData:@"what_a_state"];
+    stubBodies[@"uuid-e"] = body;
+
+    RiveCDNAssetCache* cache = [self makeCache];
+    cache.revalidationInterval = 0;
+    [self fetchUUID:@"uuid-e" fromCache:cache error:nil];
+    stubOffline = YES;
+    XCTAssertEqualObjects([self fetchUUID:@"uuid-e" fromCache:cache error:nil],
+                          body);
+
+    NSError* error = nil;
+    XCTAssertNil([self fetchUUID:@"uuid-missing" fromCache:cache error:&error]);
+    XCTAssertEqual(error.code, NSURLErrorNotConnectedToInternet);
+}
+
+/// No more than maximumConcurrentDownloads downloads run at once.
+- (void)testConcurrentDownloadsAreCapped
+{
+    stubDelay = 0.1;
+    RiveCDNAssetCache* cache = [self makeCache];
+    cache.maximumConcurrentDownloads = 2;
+
+    NSMutableArray<XCTestExpectation*>* expectations = [NSMutableArray array];
+    for (int i = 0; i < 8; i++)
+    {
+        NSString* uuid = [NSString stringWithFormat:@"uuid-cap-%d", i];
+        stubBodies[uuid] = [uuid dataUsingEncoding:NSUTF8StringEncoding];
+        XCTestExpectation* done = [self expectationWithDescription:uuid];
+        [expectations addObject:done];
+        [cache fetchAssetWithUUID:uuid
+                              url:[self urlForUUID:uuid]
+                       completion:^(NSData* data, NSError* error) {
+                         XCTAssertNotNil(data);
+                         [done fulfill];
+                       }];
+    }
+    [self waitForExpectations:expectations timeout:10];
+    XCTAssertEqual(RiveCDNStubProtocol.requests.count, 8);
+    XCTAssertLessThanOrEqual(stubMaximumActiveCount, 2);
+}
+
+/// Least recently used assets are deleted to stay within the disk budget.
+- (void)testDiskBudgetEvictsLeastRecentlyUsed
+{
+    NSData* body = [Util loadTestData:@"flux_capacitor"];
+    stubBodies[@"uuid-old"] = body;
+    stubBodies[@"uuid-recent"] = body;
+    stubBodies[@"uuid-new"] = body;
+
+    RiveCDNAssetCache* cache = [self makeCache];
+    cache.diskBudget = body.length * 2;
+    [self fetchUUID:@"uuid-old" fromCache:cache error:nil];
+    [self fetchUUID:@"uuid-recent" fromCache:cache error:nil];
+    // Use the older asset, so that the other one is evicted.
+    [self fetchUUID:@"uuid-old" fromCache:cache error:nil];
+    [self fetchUUID:@"uuid-new" fromCache:cache error:nil];
+    XCTAssertEqual(cache.totalByteCount, body.length * 2);
+
+    [cache resetStatistics];
+    [self fetchUUID:@"uuid-old" fromCache:cache error:nil];
+    [self fetchUUID:@"uuid-new" fromCache:cache error:nil];
+    [self fetchUUID:@"uuid-recent" fromCache:cache error:nil];
+    XCTAssertEqual(cache.hitCount, 2);
+    XCTAssertEqual(cache.downloadCount, 1);
+}
+
+@end
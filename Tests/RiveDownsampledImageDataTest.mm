@@ -0,0 +1,132 @@
+//
+//  RiveDownsampledImageDataTest.mm
+//  RiveRuntimeTests
+//
+//  Tests that images are reduced by powers of two to cover the requested
+//  size, and that the memory saved is reported.
+//
+
+#import <XCTest/XCTest.h>
+#import <ImageIO/ImageIO.h>
+#import "Rive.h"
+#import "util.h"
+
+@interface RiveDownsampledImageDataTest : XCTestCase
+@end
+
+@implementation RiveDownsampledImageDataTest
+
+/// Returns a PNG of the given size.
++ (NSData*)pngWithWidth:(size_t)width height:(size_t)height
+{
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGContextRef context =
+        CGBitmapContextCreate(nil,
+                              width,
+                              height,
+                              8,
+                              0,
+                              colorSpace,
+                              (CGBitmapInfo)kCGImageAlphaPremultipliedLast);
+    CGContextSetRGBFillColor(context, 1, 0, 0, 1);
+    CGContextFillRect(context, CGRectMake(0, 0, width / 2.0, height));
+    CGImageRef image = CGBitmapContextCreateImage(context);
+
+    NSMutableData* data = [NSMutableData data];
+    CGImageDestinationRef destination = CGImageDestinationCreateWithData(
+        (__bridge CFMutableDataRef)data, CFSTR("public.png"), 1, nil);
+    CGImageDestinationAddImage(destination, image, nil);
+    CGImageDestinationFinalize(destination);
+
+    CFRelease(destination);
+    CGImageRelease(image);
+    CGContextRelease(context);
+    CGColorSpaceRelease(colorSpace);
+    return data;
+}
+
+/// A 2048px image shown at 300pt on a 3x screen is halved once, to the
+/// smallest power of two reduction that still covers 900px.
+- (void)testReducesByPowersOfTwo
+{
+    NSData* png = [RiveDownsampledImageDataTest pngWithWidth:2048 height:1024];
+    RiveDownsampledImageData* downsampled =
+        [[RiveDownsampledImageData alloc] initWithData:png
+                                      maximumPixelSize:CGSizeMake(900, 450)];
+    XCTAssertNotNil(downsampled);
+    XCTAssertTrue(CGSizeEqualToSize(downsampled.sourcePixelSize,
+                                    CGSizeMake(2048, 1024)));
+    XCTAssertTrue(
+        CGSizeEqualToSize(downsampled.pixelSize, CGSizeMake(1024, 512)));
+    XCTAssertEqual(downsampled.savedCPUByteCount,
+                   (2048 * 1024 - 1024 * 512) * 4);
+    XCTAssertEqual(downsampled.savedGPUByteCount,
+                   downsampled.savedCPUByteCount * 4 / 3);
+
+    // Only the constrained axis is considered.
+    downsampled = [[RiveDownsampledImageData alloc]
+            initWithData:png
+        maximumPixelSize:CGSizeMake(0, 100)];
+    XCTAssertTrue(
+        CGSizeEqualToSize(downsampled.pixelSize, CGSizeMake(256, 128)));
+}
+
+/// Images that already fit are left untouched.
+- (void)testImagesThatFitAreNotReduced
+{
+    NSData* png = [RiveDownsampledImageDataTest pngWithWidth:256 height:256];
+    RiveDownsampledImageData* downsampled =
+        [[RiveDownsampledImageData alloc] initWithData:png
+                                      maximumPixelSize:CGSizeMake(200, 200)];
+    XCTAssertEqual(downsampled.data, png);
+    XCTAssertTrue(
+        CGSizeEqualToSize(downsampled.pixelSize, CGSizeMake(256, 256)));
+    XCTAssertEqual(downsampled.savedCPUByteCount, 0);
+    XCTAssertEqual(downsampled.savedGPUByteCount, 0);
+}
+
+- (void)testNonImageDataIsRejected
+{
+    XCTAssertNil([[RiveDownsampledImageData alloc]
+            initWithData:[Util loadTestData:@"junk"]
+        maximumPixelSize:CGSizeMake(100, 100)]);
+}
+
+/// Images decoded by the factory in an asset loader, at a size the caller
+/// chooses, report their reduction.
+- (void)testFactoryDecodesAssetAtCallerSize
+{
+    NSData* png = [RiveDownsampledImageDataTest pngWithWidth:2048 height:2048];
+    __block RiveRenderImage* renderImage = nil;
+    __block CGSize assetSize = CGSizeZero;
+    RiveFile* file = [[RiveFile alloc]
+             initWithData:[Util loadTestData:@"embedded_assets"]
+                  loadCdn:false
+        customAssetLoader:^bool(
+            RiveFileAsset* asset, NSData* data, RiveFactory* factory) {
+          if ([asset isKindOfClass:[RiveImageAsset class]])
+          {
+              RiveImageAsset* imageAsset = (RiveImageAsset*)asset;
+              assetSize = imageAsset.size;
+              renderImage = [factory
+                       decodeImage:png
+                  maximumPixelSize:CGSizeMake(assetSize.width * 2,
+                                              assetSize.height * 2)];
+              [imageAsset renderImage:renderImage];
+              return true;
+          }
+          return false;
+        }
+                    error:nil];
+
+    XCTAssertNotNil(file);
+    XCTAssertNotNil(renderImage);
+    XCTAssertTrue(CGSizeEqualToSize(renderImage.sourcePixelSize,
+                                    CGSizeMake(2048, 2048)));
+    XCTAssertGreaterThanOrEqual(renderImage.pixelSize.width,
+                                assetSize.width * 2);
+    XCTAssertLessThan(renderImage.pixelSize.width, 2048);
+    XCTAssertGreaterThan(renderImage.savedGPUByteCount, 0);
+}
+
+@end
@@ -0,0 +1,197 @@
+//
+//  RiveFileAsyncImportTest.mm
+//  RiveRuntimeTests
+//
+//  Tests that RiveFiles can be imported off the main thread, concurrently,
+//  with results delivered on the main queue.
+//
+
+#import <XCTest/XCTest.h>
+#import "Rive.h"
+#import "util.h"
+
+@interface RiveFileAsyncImportTest : XCTestCase
+@end
+
+@implementation RiveFileAsyncImportTest
+
+- (NSArray<NSURL*>*)testAssetURLs
+{
+    NSBundle* bundle = [NSBundle bundleForClass:[self class]];
+    return [bundle URLsForResourcesWithExtension:@"riv" subdirectory:nil];
+}
+
+/// Files are parsed off the calling thread, and delivered on the main queue.
+- (void)testImportDataDeliversOnMainQueue
+{
+    XCTestExpectation* done = [self expectationWithDescription:@"imported"];
+    NSData* data = [Util loadTestData:@"multipleartboards"];
+    [RiveFile importData:data
+                  loadCdn:false
+        customAssetLoader:nil
+               completion:^(RiveFile* file, NSError* error) {
+                 XCTAssertTrue([NSThread isMainThread]);
+                 XCTAssertNil(error);
+                 XCTAssertTrue(file.isLoaded);
+                 XCTAssertEqualObjects(
+                     [file artboardNames],
+                     [[Util loadTestFile:@"multipleartboards"
+                                   error:nil] artboardNames]);
+                 [done fulfill];
+               }];
+    [self waitForExpectations:@[ done ] timeout:5];
+}
+
+/// Malformed files deliver the same error as a synchronous import.
+- (void)testImportMalformedDataFails
+{
+    XCTestExpectation* done = [self expectationWithDescription:@"failed"];
+    [RiveFile importData:[Util loadTestData:@"junk"]
+                  loadCdn:false
+        customAssetLoader:nil
+               completion:^(RiveFile* file, NSError* error) {
+                 XCTAssertNil(file);
+                 XCTAssertEqualObjects(error.domain, RiveErrorDomain);
+                 XCTAssertEqual(error.code, RiveMalformedFile);
+                 [done fulfill];
+               }];
+    [self waitForExpectations:@[ done ] timeout:5];
+}
+
+/// Missing files deliver a read error.
+- (void)testImportMissingFileURLFails
+{
+    XCTestExpectation* done = [self expectationWithDescription:@"failed"];
+    NSURL* url = [NSURL fileURLWithPath:@"/nonexistent/missing.riv"];
+    [RiveFile importFileURL:url
+                    loadCdn:false
+          customAssetLoader:nil
+                 completion:^(RiveFile* file, NSError* error) {
+                   XCTAssertNil(file);
+                   XCTAssertNotNil(error);
+                   [done fulfill];
+                 }];
+    [self waitForExpectations:@[ done ] timeout:5];
+}
+
+/// Missing resources fail without throwing.
+- (void)testImportMissingResourceFails
+{
+    XCTestExpectation* done = [self expectationWithDescription:@"failed"];
+    [RiveFile importResource:@"missing"
+               withExtension:@"riv"
+                     loadCdn:false
+           customAssetLoader:nil
+                  completion:^(RiveFile* file, NSError* error) {
+                    XCTAssertNil(file);
+                    XCTAssertEqual(error.code, NSFileReadNoSuchFileError);
+                    [done fulfill];
+                  }];
+    [self waitForExpectations:@[ done ] timeout:5];
+}
+
+/// Cancelling on the main thread prevents the completion from being called.
+- (void)testCancelledImportDoesNotComplete
+{
+    XCTestExpectation* completed =
+        [self expectationWithDescription:@"completed"];
+    completed.inverted = YES;
+    RiveFileImportTask* task =
+        [RiveFile importData:[Util loadTestData:@"off_road_car_blog"]
+                      loadCdn:false
+            customAssetLoader:nil
+                   completion:^(RiveFile* file, NSError* error) {
+                     [completed fulfill];
+                   }];
+    [task cancel];
+    XCTAssertTrue(task.isCancelled);
+    [self waitForExpectations:@[ completed ] timeout:1];
+}
+
+/// Every test asset, imported many times concurrently from many threads,
+/// yields the same result as a synchronous import on the main thread, with
+/// imports of the same bytes racing to share a cached file.
+- (void)testConcurrentImportOfAllAssets
+{
+    RiveFileCache* cache = [RiveFileCache shared];
+    BOOL enabled = cache.isEnabled;
+    cache.enabled = YES;
+    [self importAllAssetsConcurrently];
+    cache.enabled = enabled;
+}
+
+/// As above, with every import parsing its file rather than sharing a
+/// cached one.
+- (void)testConcurrentImportOfAllAssetsUncached
+{
+    RiveFileCache* cache = [RiveFileCache shared];
+    BOOL enabled = cache.isEnabled;
+    cache.enabled = NO;
+    [self importAllAssetsConcurrently];
+    cache.enabled = enabled;
+}
+
+- (void)importAllAssetsConcurrently
+{
+    const NSUInteger kRepeats = 4;
+    NSArray<NSURL*>* urls = [self testAssetURLs];
+    XCTAssertGreaterThan(urls.count, 0);
+
+    // Expected results, from synchronous imports.
+    NSMutableDictionary<NSURL*, id>* expected =
+        [NSMutableDictionary dictionary];
+    for (NSURL* url in urls)
+    {
+        NSError* error = nil;
+        RiveFile* file = [[RiveFile alloc] initWithFileURL:url
+                                                   loadCdn:false
+                                                     error:&error];
+        expected[url] = file != nil ? (id)[file artboardNames]
+                                    : (id)@(error.code);
+    }
+
+    NSMutableArray<XCTestExpectation*>* expectations = [NSMutableArray array];
+    for (NSUInteger i = 0; i < urls.count * kRepeats; i++)
+    {
+        [expectations
+            addObject:[self expectationWithDescription:
+                                [NSString stringWithFormat:@"import %lu",
+                                                           (unsigned long)i]]];
+    }
+
+    // Start imports from many threads at once, half from data and half from
+    // file URLs.
+    dispatch_apply(
+        urls.count * kRepeats,
+        dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0),
+        ^(size_t i) {
+          NSURL* url = urls[i % urls.count];
+          XCTestExpectation* expectation = expectations[i];
+          RiveFileImportCompletion completion = ^(RiveFile* file,
+                                                  NSError* error) {
+            XCTAssertTrue([NSThread isMainThread]);
+            id result = file != nil ? (id)[file artboardNames]
+                                    : (id)@(error.code);
+            XCTAssertEqualObjects(result, expected[url], @"%@", url);
+            [expectation fulfill];
+          };
+          if (i % 2 == 0)
+          {
+              [RiveFile importFileURL:url
+                              loadCdn:false
+                    customAssetLoader:nil
+                           completion:completion];
+          }
+          else
+          {
+              [RiveFile importData:[NSData dataWithContentsOfURL:url]
+                            loadCdn:false
+                  customAssetLoader:nil
+                         completion:completion];
+          }
+        });
+
+    [self waitForExpectations:expectations timeout:60];
+}
+
+@end
@@ -0,0 +1,177 @@
+//
+//  RiveFileCacheTest.mm
+//  RiveRuntimeTests
+//
+//  Tests that RiveFiles created from the same bytes share a single imported
+//  file through RiveFileCache.
+//
+
+#import <XCTest/XCTest.h>
+#import "Rive.h"
+#import "util.h"
+
+@interface RiveFileCacheTest : XCTestCase
+@end
+
+@implementation RiveFileCacheTest
+{
+    NSUInteger _memoryBudget;
+}
+
+- (void)setUp
+{
+    RiveFileCache* cache = [RiveFileCache shared];
+    _memoryBudget = cache.memoryBudget;
+    cache.enabled = YES;
+    [cache removeAllUnusedFiles];
+    [cache resetStatistics];
+}
+
+- (void)tearDown
+{
+    RiveFileCache* cache = [RiveFileCache shared];
+    cache.enabled = NO;
+    cache.memoryBudget = _memoryBudget;
+    [cache removeAllUnusedFiles];
+}
+
+/// Importing the same bytes twice parses them once.
+- (void)testSameBytesHitCache
+{
+    RiveFileCache* cache = [RiveFileCache shared];
+    NSData* data = [Util loadTestData:@"multipleartboards"];
+
+    NSError* error = nil;
+    RiveFile* first = [[RiveFile alloc] initWithData:data
+                                             loadCdn:false
+                                               error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqual(cache.missCount, 1);
+    XCTAssertEqual(cache.hitCount, 0);
+
+    RiveFile* second = [[RiveFile alloc] initWithData:data
+                                              loadCdn:false
+                                                error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqual(cache.missCount, 1);
+    XCTAssertEqual(cache.hitCount, 1);
+    XCTAssertEqual(cache.fileCount, 1);
+    XCTAssertEqual(cache.totalByteCount, data.length);
+
+    XCTAssertEqualObjects([first artboardNames], [second artboardNames]);
+    XCTAssertNotNil([second artboard:&error]);
+    XCTAssertNil(error);
+}
+
+/// The CDN setting is part of the cache key.
+- (void)testDifferentCdnSettingMisses
+{
+    RiveFileCache* cache = [RiveFileCache shared];
+    NSData* data = [Util loadTestData:@"flux_capacitor"];
+
+    RiveFile* first = [[RiveFile alloc] initWithData:data
+                                             loadCdn:false
+                                               error:nil];
+    RiveFile* second = [[RiveFile alloc] initWithData:data
+                                              loadCdn:true
+                                                error:nil];
+    XCTAssertNotNil(first);
+    XCTAssertNotNil(second);
+    XCTAssertEqual(cache.missCount, 2);
+    XCTAssertEqual(cache.hitCount, 0);
+    XCTAssertEqual(cache.fileCount, 2);
+}
+
+/// Files imported with a custom asset loader are never cached.
+- (void)testCustomAssetLoaderBypassesCache
+{
+    RiveFileCache* cache = [RiveFileCache shared];
+    NSData* data = [Util loadTestData:@"flux_capacitor"];
+
+    for (int i = 0; i < 2; i++)
+    {
+        RiveFile* file = [[RiveFile alloc]
+                 initWithData:data
+                      loadCdn:false
+            customAssetLoader:^bool(RiveFileAsset* asset,
+                                    NSData* assetData,
+                                    RiveFactory* factory) {
+              return false;
+            }
+                        error:nil];
+        XCTAssertNotNil(file);
+    }
+    XCTAssertEqual(cache.missCount, 0);
+    XCTAssertEqual(cache.hitCount, 0);
+    XCTAssertEqual(cache.fileCount, 0);
+}
+
+/// Files in use are kept regardless of the budget, and evicted once released.
+- (void)testUnusedFilesEvictedOverBudget
+{
+    RiveFileCache* cache = [RiveFileCache shared];
+    cache.memoryBudget = 0;
+
+    @autoreleasepool
+    {
+        RiveFile* file = [Util loadTestFile:@"flux_capacitor" error:nil];
+        XCTAssertNotNil(file);
+        XCTAssertEqual(cache.fileCount, 1);
+        XCTAssertEqual(cache.evictionCount, 0);
+        file = nil;
+    }
+
+    XCTAssertEqual(cache.fileCount, 0);
+    XCTAssertEqual(cache.totalByteCount, 0);
+    XCTAssertEqual(cache.evictionCount, 1);
+}
+
+/// Unused files stay cached within the budget, and are reused by later
+/// imports.
+- (void)testUnusedFilesReusedWithinBudget
+{
+    RiveFileCache* cache = [RiveFileCache shared];
+
+    @autoreleasepool
+    {
+        RiveFile* file = [Util loadTestFile:@"flux_capacitor" error:nil];
+        XCTAssertNotNil(file);
+        file = nil;
+    }
+    XCTAssertEqual(cache.fileCount, 1);
+
+    RiveFile* file = [Util loadTestFile:@"flux_capacitor" error:nil];
+    XCTAssertNotNil(file);
+    XCTAssertEqual(cache.hitCount, 1);
+
+    [cache removeAllUnusedFiles];
+    XCTAssertEqual(cache.fileCount, 1);
+}
+
+/// A disabled cache neither serves nor stores files.
+- (void)testDisabledCache
+{
+    RiveFileCache* cache = [RiveFileCache shared];
+    cache.enabled = NO;
+
+    RiveFile* first = [Util loadTestFile:@"flux_capacitor" error:nil];
+    RiveFile* second = [Util loadTestFile:@"flux_capacitor" error:nil];
+    XCTAssertNotNil(first);
+    XCTAssertNotNil(second);
+    XCTAssertEqual(cache.hitCount, 0);
+    XCTAssertEqual(cache.missCount, 0);
+    XCTAssertEqual(cache.fileCount, 0);
+}
+
+/// Malformed files are not cached.
+- (void)testMalformedFileNotCached
+{
+    RiveFileCache* cache = [RiveFileCache shared];
+    NSError* error = nil;
+    RiveFile* file = [Util loadTestFile:@"junk" error:&error];
+    XCTAssertNil(file);
+    XCTAssertNotNil(error);
+    XCTAssertEqual(cache.fileCount, 0);
+}
+
+@end
@@ -82,4 +82,64 @@
     XCTAssertEqual(artboard.animationCount, 5);
 }
 
+/*
+ * Test loading a file from disk by memory-mapping it.
+ */
+- (void)testLoadFromFileURL
+{
+    NSBundle* bundle = [NSBundle bundleForClass:[self class]];
+    NSURL* url = [bundle URLForResource:@"flux_capacitor" withExtension:@"riv"];
+    NSError* error = nil;
+    RiveFile* file = [[RiveFile alloc] initWithFileURL:url
+                                               loadCdn:false
+                                                 error:&error];
+    XCTAssertNil(error);
+    RiveArtboard* artboard = [file artboard:&error];
+    XCTAssertEqual(artboard.animationCount, 1);
+}
+
+/*
+ * Test loading a file that does not exist reports the read error.
+ */
+- (void)testLoadFromMissingFileURL
+{
+    NSURL* url = [[NSURL fileURLWithPath:NSTemporaryDirectory()]
+        URLByAppendingPathComponent:@"404.riv"];
+    NSError* error = nil;
+    RiveFile* file = [[RiveFile alloc] initWithFileURL:url
+                                               loadCdn:false
+                                                 error:&error];
+    XCTAssertNil(file);
+    XCTAssertNotNil(error);
+}
+
+/*
+ * Measure peak memory with every test asset loaded at once, memory-mapped.
+ */
+- (void)testLoadAllAssetsMappedMemory
+{
+    NSBundle* bundle = [NSBundle bundleForClass:[self class]];
+    NSArray<NSURL*>* urls = [bundle URLsForResourcesWithExtension:@"riv"
+                                                     subdirectory:nil];
+    XCTAssertGreaterThan(urls.count, 0);
+
+    [self measureWithMetrics:@[ [[XCTMemoryMetric alloc] init] ]
+                       block:^{
+                         NSMutableArray<RiveFile*>* files =
+                             [NSMutableArray array];
+                         for (NSURL* url in urls)
+                         {
+                             RiveFile* file =
+                                 [[RiveFile alloc] initWithFileURL:url
+                                                           loadCdn:false
+                                                             error:nil];
+                             if (file != nil)
+                             {
+                                 [files addObject:file];
+                             }
+                         }
+                         XCTAssertGreaterThan(files.count, 0);
+                       }];
+}
+
 @end
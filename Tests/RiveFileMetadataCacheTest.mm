@@ -0,0 +1,242 @@
+//
+//  RiveFileMetadataCacheTest.mm
+//  RiveRuntimeTests
+//
+//  Tests that file metadata persisted to disk round-trips, and is discarded
+//  when it was written by a different runtime version.
+//
+
+#import <XCTest/XCTest.h>
+#import "Rive.h"
+#import "util.h"
+
+// Declared privately by the runtime.
+@interface RiveFileCache (Testing)
++ (NSString*)contentHashForBytes:(const uint8_t*)bytes
+                          length:(NSUInteger)length;
+@end
+
+@interface RiveFileMetadataCache (Testing)
+- (void)storeMetadata:(RiveFileMetadata*)metadata
+       forContentHash:(NSString*)contentHash;
+@end
+
+@interface RiveFileMetadataCacheTest : XCTestCase
+@property(nonatomic) NSURL* directoryURL;
+@end
+
+@implementation RiveFileMetadataCacheTest
+
+- (void)setUp
+{
+    self.directoryURL = [[NSURL fileURLWithPath:NSTemporaryDirectory()]
+        URLByAppendingPathComponent:[NSUUID UUID].UUIDString
+                        isDirectory:YES];
+}
+
+- (void)tearDown
+{
+    RiveFileMetadataCache.shared.enabled = NO;
+    [[NSFileManager defaultManager] removeItemAtURL:self.directoryURL
+                                              error:nil];
+}
+
+- (void)assertMetadata:(RiveFileMetadata*)metadata
+            equalsFile:(RiveFile*)file
+{
+    RiveFileMetadata* expected = file.metadata;
+    XCTAssertEqual(metadata.artboards.count, expected.artboards.count);
+    for (NSUInteger i = 0; i < expected.artboards.count; i++)
+    {
+        RiveArtboardMetadata* artboard = metadata.artboards[i];
+        RiveArtboardMetadata* expectedArtboard = expected.artboards[i];
+        XCTAssertEqualObjects(artboard.name, expectedArtboard.name);
+        XCTAssertEqual(artboard.width, expectedArtboard.width);
+        XCTAssertEqual(artboard.height, expectedArtboard.height);
+        XCTAssertEqualObjects(artboard.animationNames,
+                              expectedArtboard.animationNames);
+        XCTAssertEqualObjects(
+            [artboard.stateMachines valueForKeyPath:@"inputs.name"],
+            [expectedArtboard.stateMachines valueForKeyPath:@"inputs.name"]);
+        XCTAssertEqualObjects(
+            [artboard.stateMachines valueForKeyPath:@"inputs.type"],
+            [expectedArtboard.stateMachines valueForKeyPath:@"inputs.type"]);
+    }
+    XCTAssertEqualObjects([metadata.viewModels valueForKey:@"name"],
+                          [expected.viewModels valueForKey:@"name"]);
+    XCTAssertEqualObjects(
+        [metadata.viewModels valueForKeyPath:@"properties.name"],
+        [expected.viewModels valueForKeyPath:@"properties.name"]);
+    XCTAssertEqualObjects(
+        [metadata.viewModels valueForKey:@"instanceNames"],
+        [expected.viewModels valueForKey:@"instanceNames"]);
+}
+
+/// Metadata read back from disk matches the metadata of the imported file.
+- (void)testMetadataRoundTrips
+{
+    RiveFileMetadataCache* cache =
+        [[RiveFileMetadataCache alloc] initWithDirectoryURL:self.directoryURL];
+    for (NSString* name in @[ @"multiple_state_machines", @"data_binding_test" ])
+    {
+        NSData* data = [Util loadTestData:name];
+        XCTAssertNil([cache metadataForData:data]);
+
+        RiveFile* file = [Util loadTestFile:name error:nil];
+        [cache storeMetadata:file.metadata
+              forContentHash:[RiveFileCache
+                                 contentHashForBytes:(const uint8_t*)data.bytes
+                                              length:data.length]];
+        RiveFileMetadata* metadata = [cache metadataForData:data];
+        XCTAssertNotNil(metadata, @"%@", name);
+        [self assertMetadata:metadata equalsFile:file];
+    }
+    XCTAssertEqual(cache.hitCount, 2);
+    XCTAssertEqual(cache.missCount, 2);
+}
+
+/// With the shared cache enabled, RiveFiles build their metadata from the
+/// imported file, without reading the cache, and write it to the cache for
+/// later launches. Files whose sidecar exists do not rewrite it.
+- (void)testRiveFilesPopulateSharedCache
+{
+    RiveFileMetadataCache* cache = RiveFileMetadataCache.shared;
+    cache.enabled = YES;
+    [cache removeAllMetadata];
+    [cache resetStatistics];
+
+    NSData* data = [Util loadTestData:@"what_a_state"];
+    RiveFile* first = [[RiveFile alloc] initWithData:data
+                                             loadCdn:false
+                                               error:nil];
+    XCTAssertNotNil(first.metadata);
+    XCTAssertEqual(cache.hitCount, 0);
+    XCTAssertEqual(cache.missCount, 0);
+    [self assertMetadata:[cache metadataForData:data] equalsFile:first];
+
+    NSString* hash =
+        [RiveFileCache contentHashForBytes:(const uint8_t*)data.bytes
+                                    length:data.length];
+    NSURL* url = [[cache.directoryURL URLByAppendingPathComponent:hash]
+        URLByAppendingPathExtension:@"rivmeta"];
+    NSDate* written = [[NSFileManager defaultManager]
+        attributesOfItemAtPath:url.path
+                         error:nil]
+                          .fileModificationDate;
+
+    RiveFile* second = [[RiveFile alloc] initWithData:data
+                                              loadCdn:false
+                                                error:nil];
+    [self assertMetadata:second.metadata equalsFile:first];
+    XCTAssertNotNil([cache metadataForData:data]);
+    XCTAssertEqualObjects([[NSFileManager defaultManager]
+                              attributesOfItemAtPath:url.path
+                                               error:nil]
+                              .fileModificationDate,
+                          written);
+    XCTAssertEqual(cache.hitCount, 2);
+    [cache removeAllMetadata];
+}
+
+/// Sidecars written by another runtime version are misses, and are deleted.
+- (void)testRuntimeVersionChangeInvalidates
+{
+    RiveFileMetadataCache* cache =
+        [[RiveFileMetadataCache alloc] initWithDirectoryURL:self.directoryURL];
+    NSData* data = [Util loadTestData:@"multipleartboards"];
+    NSString* hash =
+        [RiveFileCache contentHashForBytes:(const uint8_t*)data.bytes
+                                    length:data.length];
+    RiveFile* file = [Util loadTestFile:@"multipleartboards" error:nil];
+    [cache storeMetadata:file.metadata forContentHash:hash];
+    XCTAssertNotNil([cache metadataForData:data]);
+
+    NSURL* url = [[self.directoryURL URLByAppendingPathComponent:hash]
+        URLByAppendingPathExtension:@"rivmeta"];
+    NSMutableData* sidecar = [NSMutableData dataWithContentsOfURL:url];
+    // The major version follows the magic and the sidecar format version.
+    uint32_t otherMajorVersion =
+        CFSwapInt32HostToLittle(RiveFile.majorVersion + 1);
+    [sidecar replaceBytesInRange:NSMakeRange(8, sizeof(uint32_t))
+                       withBytes:&otherMajorVersion];
+    XCTAssertTrue([sidecar writeToURL:url atomically:YES]);
+
+    XCTAssertNil([cache metadataForData:data]);
+    XCTAssertFalse([[NSFileManager defaultManager] fileExistsAtPath:url.path]);
+}
+
+/// Truncated sidecars are misses.
+- (void)testTruncatedSidecarIsDiscarded
+{
+    RiveFileMetadataCache* cache =
+        [[RiveFileMetadataCache alloc] initWithDirectoryURL:self.directoryURL];
+    NSData* data = [Util loadTestData:@"flux_capacitor"];
+    NSString* hash =
+        [RiveFileCache contentHashForBytes:(const uint8_t*)data.bytes
+                                    length:data.length];
+    [cache storeMetadata:[Util loadTestFile:@"flux_capacitor" error:nil]
+                             .metadata
+          forContentHash:hash];
+    XCTAssertNotNil([cache metadataForData:data]);
+
+    NSURL* url = [[self.directoryURL URLByAppendingPathComponent:hash]
+        URLByAppendingPathExtension:@"rivmeta"];
+    NSData* sidecar = [NSData dataWithContentsOfURL:url];
+    [[sidecar subdataWithRange:NSMakeRange(0, sidecar.length / 2)]
+        writeToURL:url
+        atomically:YES];
+    XCTAssertNil([cache metadataForData:data]);
+}
+
+/// The shared cache is opt-in, and writes nothing while disabled.
+- (void)testSharedCacheIsDisabledByDefault
+{
+    RiveFileMetadataCache* cache = RiveFileMetadataCache.shared;
+    XCTAssertFalse(cache.isEnabled);
+    [cache removeAllMetadata];
+
+    NSData* data = [Util loadTestData:@"sample6"];
+    RiveFile* file = [[RiveFile alloc] initWithData:data
+                                            loadCdn:false
+                                              error:nil];
+    XCTAssertNotNil(file.metadata);
+    XCTAssertNil([cache metadataForData:data]);
+}
+
+/// Listing the metadata of a large file by importing it. Compare with
+/// testMetadataFromSidecarPerformance; neither measures time to first frame.
+- (void)testMetadataByImportingPerformance
+{
+    NSData* data = [Util loadTestData:@"off_road_car_blog"];
+    RiveFileCache* fileCache = [RiveFileCache shared];
+    BOOL enabled = fileCache.isEnabled;
+    fileCache.enabled = NO;
+    [self measureWithMetrics:@[ [[XCTClockMetric alloc] init] ]
+                       block:^{
+                         RiveFile* file = [[RiveFile alloc] initWithData:data
+                                                                 loadCdn:false
+                                                                   error:nil];
+                         XCTAssertNotNil(file.metadata);
+                       }];
+    fileCache.enabled = enabled;
+}
+
+/// Listing the metadata of the same file from its sidecar, without importing
+/// it.
+- (void)testMetadataFromSidecarPerformance
+{
+    RiveFileMetadataCache* cache =
+        [[RiveFileMetadataCache alloc] initWithDirectoryURL:self.directoryURL];
+    NSData* data = [Util loadTestData:@"off_road_car_blog"];
+    [cache storeMetadata:[Util loadTestFile:@"off_road_car_blog" error:nil]
+                             .metadata
+          forContentHash:[RiveFileCache
+                             contentHashForBytes:(const uint8_t*)data.bytes
+                                          length:data.length]];
+    [self measureWithMetrics:@[ [[XCTClockMetric alloc] init] ]
+                       block:^{
+                         XCTAssertNotNil([cache metadataForData:data]);
+                       }];
+}
+
+@end
@@ -0,0 +1,132 @@
+//
+//  RiveFileMetadataTest.mm
+//  RiveRuntimeTests
+//
+//  Tests that the metadata index of a file matches what instantiating its
+//  artboards, state machines and view models reports.
+//
+
+#import <XCTest/XCTest.h>
+#import "Rive.h"
+#import "util.h"
+
+@interface RiveFileMetadataTest : XCTestCase
+@end
+
+@implementation RiveFileMetadataTest
+
+/// Every artboard, animation, state machine and input listed in the index
+/// matches its instantiated counterpart.
+- (void)testMetadataMatchesInstances
+{
+    NSArray* names = @[
+        @"multipleartboards", @"multiple_state_machines", @"what_a_state",
+        @"state_machine_configurations", @"data_binding_test"
+    ];
+    for (NSString* name in names)
+    {
+        RiveFile* file = [Util loadTestFile:name error:nil];
+        RiveFileMetadata* metadata = file.metadata;
+        XCTAssertEqual(metadata.artboards.count, [file artboardCount], @"%@",
+                       name);
+
+        for (NSInteger i = 0; i < [file artboardCount]; i++)
+        {
+            RiveArtboard* artboard = [file artboardFromIndex:i error:nil];
+            RiveArtboardMetadata* artboardMetadata = metadata.artboards[i];
+            XCTAssertEqualObjects(artboardMetadata.name, [artboard name]);
+            XCTAssertEqual(artboardMetadata.width, [artboard width]);
+            XCTAssertEqual(artboardMetadata.height, [artboard height]);
+            XCTAssertEqualObjects(artboardMetadata.animationNames,
+                                  [artboard animationNames]);
+            XCTAssertEqual(artboardMetadata.stateMachines.count,
+                           [artboard stateMachineCount]);
+
+            for (RiveStateMachineMetadata* stateMachineMetadata in
+                     artboardMetadata.stateMachines)
+            {
+                RiveStateMachineInstance* stateMachine =
+                    [artboard stateMachineFromName:stateMachineMetadata.name
+                                             error:nil];
+                XCTAssertNotNil(stateMachine);
+                XCTAssertEqualObjects(
+                    [stateMachineMetadata.inputs valueForKey:@"name"],
+                    [stateMachine inputNames]);
+                for (RiveStateMachineInputMetadata* inputMetadata in
+                         stateMachineMetadata.inputs)
+                {
+                    RiveSMIInput* input =
+                        [stateMachine inputFromName:inputMetadata.name
+                                              error:nil];
+                    switch (inputMetadata.type)
+                    {
+                        case RiveStateMachineInputTypeBoolean:
+                            XCTAssertTrue([input isBoolean]);
+                            break;
+                        case RiveStateMachineInputTypeNumber:
+                            XCTAssertTrue([input isNumber]);
+                            break;
+                        case RiveStateMachineInputTypeTrigger:
+                            XCTAssertTrue([input isTrigger]);
+                            break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// View model schemas match the file's view models.
+- (void)testViewModelMetadata
+{
+    RiveFile* file = [Util loadTestFile:@"data_binding_test" error:nil];
+    RiveFileMetadata* metadata = file.metadata;
+    XCTAssertEqual(metadata.viewModels.count, file.viewModelCount);
+    XCTAssertGreaterThan(metadata.viewModels.count, 0);
+
+    for (NSUInteger i = 0; i < file.viewModelCount; i++)
+    {
+        RiveDataBindingViewModel* viewModel = [file viewModelAtIndex:i];
+        RiveViewModelMetadata* viewModelMetadata = metadata.viewModels[i];
+        XCTAssertEqualObjects(viewModelMetadata.name, viewModel.name);
+        XCTAssertEqualObjects(viewModelMetadata.instanceNames,
+                              viewModel.instanceNames);
+        XCTAssertEqualObjects(
+            [viewModelMetadata.properties valueForKey:@"name"],
+            [viewModel.properties valueForKey:@"name"]);
+        XCTAssertEqual([metadata viewModelNamed:viewModel.name],
+                       viewModelMetadata);
+    }
+    XCTAssertNil([metadata viewModelNamed:@"does not exist"]);
+}
+
+/// The index is built once and shared between accesses.
+- (void)testMetadataIsCached
+{
+    RiveFile* file = [Util loadTestFile:@"multipleartboards" error:nil];
+    XCTAssertEqual(file.metadata, file.metadata);
+    XCTAssertEqualObjects([file artboardNames],
+                          [file.metadata.artboards valueForKey:@"name"]);
+    RiveArtboardMetadata* first = file.metadata.artboards.firstObject;
+    XCTAssertEqual([file.metadata artboardNamed:first.name], first);
+}
+
+/// Listing names from the index allocates far less than instantiating every
+/// artboard did.
+- (void)testArtboardNamesMemory
+{
+    NSData* data = [Util loadTestData:@"multipleartboards"];
+    [self measureWithMetrics:@[ [[XCTMemoryMetric alloc] init] ]
+                       block:^{
+                         RiveFile* file =
+                             [[RiveFile alloc] initWithData:data
+                                                    loadCdn:false
+                                                      error:nil];
+                         for (int i = 0; i < 100; i++)
+                         {
+                             [file artboardNames];
+                         }
+                       }];
+}
+
+@end
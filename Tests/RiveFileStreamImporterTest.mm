@@ -0,0 +1,304 @@
+//
+//  RiveFileStreamImporterTest.mm
+//  RiveRuntimeTests
+//
+//  Tests that RiveFileStreamImporter surfaces the header and first artboard
+//  of a file before it has finished downloading, using a local HTTP stand-in
+//  that throttles bandwidth.
+//
+
+#import <XCTest/XCTest.h>
+#import "Rive.h"
+#import "util.h"
+
+/// A URL protocol that serves test assets from the test bundle in small
+/// chunks, with a delay between each chunk, to simulate a slow connection.
+/// Requests are of the form throttled://host/<asset name>.
+@interface ThrottledURLProtocol : NSURLProtocol
+@end
+
+@implementation ThrottledURLProtocol
+{
+    BOOL _stopped;
+}
+
+static const NSUInteger kThrottledChunkSize = 512;
+static const int64_t kThrottledChunkDelay = 2 * NSEC_PER_MSEC;
+
++ (BOOL)canInitWithRequest:(NSURLRequest*)request
+{
+    return [request.URL.scheme isEqualToString:@"throttled"];
+}
+
++ (NSURLRequest*)canonicalRequestForRequest:(NSURLRequest*)request
+{
+    return request;
+}
+
+- (void)startLoading
+{
+    NSData* data = [Util loadTestData:self.request.URL.lastPathComponent];
+    if (data == nil)
+    {
+        NSHTTPURLResponse* response =
+            [[NSHTTPURLResponse alloc] initWithURL:self.request.URL
+                                        statusCode:404
+                                       HTTPVersion:@"HTTP/1.1"
+                                      headerFields:nil];
+        [self.client URLProtocol:self
+              didReceiveResponse:response
+              cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+        [self.client URLProtocolDidFinishLoading:self];
+        return;
+    }
+
+    NSHTTPURLResponse* response = [[NSHTTPURLResponse alloc]
+         initWithURL:self.request.URL
+          statusCode:200
+         HTTPVersion:@"HTTP/1.1"
+        headerFields:@{
+            @"Content-Length" :
+                [NSString stringWithFormat:@"%lu", (unsigned long)data.length]
+        }];
+    [self.client URLProtocol:self
+          didReceiveResponse:response
+          cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+    [self sendData:data fromOffset:0];
+}
+
+- (void)sendData:(NSData*)data fromOffset:(NSUInteger)offset
+{
+    if (_stopped)
+    {
+        return;
+    }
+    if (offset >= data.length)
+    {
+        [self.client URLProtocolDidFinishLoading:self];
+        return;
+    }
+    NSUInteger length = MIN(kThrottledChunkSize, data.length - offset);
+    [self.client URLProtocol:self
+                 didLoadData:[data subdataWithRange:NSMakeRange(offset,
+                                                                length)]];
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, kThrottledChunkDelay),
+                   dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0),
+                   ^{
+                     [self sendData:data fromOffset:offset + length];
+                   });
+}
+
+- (void)stopLoading
+{
+    _stopped = YES;
+}
+
+@end
+
+@interface StreamImporterRecorder : NSObject <RiveFileStreamImporterDelegate>
+@property(nonatomic, strong) NSMutableArray<NSString*>* events;
+@property(nonatomic, strong) RiveFile* provisionalFile;
+@property(nonatomic, strong) RiveFile* file;
+@property(nonatomic, strong) NSError* error;
+@property(nonatomic, strong) XCTestExpectation* done;
+@end
+
+@implementation StreamImporterRecorder
+
+- (instancetype)init
+{
+    if (self = [super init])
+    {
+        _events = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (void)riveFileStreamImporter:(RiveFileStreamImporter*)importer
+    didReadHeaderWithMajorVersion:(uint)majorVersion
+                     minorVersion:(uint)minorVersion
+{
+    [_events addObject:@"header"];
+}
+
+- (void)riveFileStreamImporter:(RiveFileStreamImporter*)importer
+      didImportProvisionalFile:(RiveFile*)file
+{
+    [_events addObject:@"provisional"];
+    _provisionalFile = file;
+}
+
+- (void)riveFileStreamImporter:(RiveFileStreamImporter*)importer
+                 didImportFile:(RiveFile*)file
+{
+    [_events addObject:@"file"];
+    _file = file;
+    [_done fulfill];
+}
+
+- (void)riveFileStreamImporter:(RiveFileStreamImporter*)importer
+              didFailWithError:(NSError*)error
+{
+    [_events addObject:@"error"];
+    _error = error;
+    [_done fulfill];
+}
+
+@end
+
+@interface RiveFileStreamImporterTest : XCTestCase
+@end
+
+@implementation RiveFileStreamImporterTest
+
+- (NSURLSession*)throttledSessionWithDelegate:(id<NSURLSessionDelegate>)delegate
+{
+    NSURLSessionConfiguration* configuration =
+        [NSURLSessionConfiguration ephemeralSessionConfiguration];
+    configuration.protocolClasses = @[ [ThrottledURLProtocol class] ];
+    return [NSURLSession sessionWithConfiguration:configuration
+                                         delegate:delegate
+                                    delegateQueue:nil];
+}
+
+/// A multi-artboard file streamed over a throttled connection surfaces its
+/// header, then a provisional file with the first artboard, then the
+/// complete file.
+- (void)testThrottledDownloadSignalsFirstArtboardBeforeCompletion
+{
+    RiveFileStreamImporter* importer =
+        [[RiveFileStreamImporter alloc] initWithLoadCdn:false];
+    StreamImporterRecorder* recorder = [[StreamImporterRecorder alloc] init];
+    recorder.done = [self expectationWithDescription:@"import finished"];
+    importer.delegate = recorder;
+
+    NSURLSession* session = [self throttledSessionWithDelegate:importer];
+    [[session dataTaskWithURL:[NSURL URLWithString:
+                                         @"throttled://host/multipleartboards"]]
+        resume];
+    [self waitForExpectations:@[ recorder.done ] timeout:10];
+    [session invalidateAndCancel];
+
+    NSArray* expected = @[ @"header", @"provisional", @"file" ];
+    XCTAssertEqualObjects(recorder.events, expected);
+    XCTAssertNil(recorder.error);
+    XCTAssertGreaterThan([recorder.file artboardCount], 1);
+    XCTAssertGreaterThanOrEqual([recorder.provisionalFile artboardCount], 1);
+    XCTAssertLessThan([recorder.provisionalFile artboardCount],
+                      [recorder.file artboardCount]);
+    XCTAssertEqual(importer.artboardsReceived,
+                   (NSUInteger)[recorder.file artboardCount]);
+
+    RiveFile* direct = [Util loadTestFile:@"multipleartboards" error:nil];
+    XCTAssertEqualObjects([recorder.file artboardNames],
+                          [direct artboardNames]);
+    XCTAssertEqualObjects([recorder.provisionalFile artboardNames][0],
+                          [direct artboardNames][0]);
+}
+
+/// Every byte-at-a-time split of the stream yields the same file as a
+/// direct import.
+- (void)testByteByByteAppendMatchesDirectImport
+{
+    NSData* data = [Util loadTestData:@"multipleartboards"];
+    RiveFileStreamImporter* importer =
+        [[RiveFileStreamImporter alloc] initWithLoadCdn:false];
+    StreamImporterRecorder* recorder = [[StreamImporterRecorder alloc] init];
+    recorder.done = [self expectationWithDescription:@"import finished"];
+    importer.delegate = recorder;
+
+    const uint8_t* bytes = (const uint8_t*)data.bytes;
+    for (NSUInteger i = 0; i < data.length; i++)
+    {
+        XCTAssertTrue([importer appendData:[NSData dataWithBytes:bytes + i
+                                                          length:1]]);
+    }
+    XCTAssertEqual(importer.bytesReceived, data.length);
+    [importer finish];
+    [self waitForExpectations:@[ recorder.done ] timeout:5];
+
+    RiveFile* direct = [Util loadTestFile:@"multipleartboards" error:nil];
+    XCTAssertEqualObjects([recorder.file artboardNames],
+                          [direct artboardNames]);
+}
+
+/// Files can be imported from an NSInputStream on a background queue.
+- (void)testImportFromInputStream
+{
+    RiveFileStreamImporter* importer =
+        [[RiveFileStreamImporter alloc] initWithLoadCdn:false];
+    StreamImporterRecorder* recorder = [[StreamImporterRecorder alloc] init];
+    recorder.done = [self expectationWithDescription:@"import finished"];
+    importer.delegate = recorder;
+
+    NSInputStream* stream = [NSInputStream
+        inputStreamWithData:[Util loadTestData:@"flux_capacitor"]];
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+      [importer importFromInputStream:stream];
+    });
+    [self waitForExpectations:@[ recorder.done ] timeout:5];
+
+    XCTAssertNil(recorder.error);
+    XCTAssertNotNil(recorder.file);
+    XCTAssertEqual([recorder.file artboardCount], 1);
+}
+
+/// A file with a single artboard has no provisional file, and an importer
+/// released right after finishing still delivers the complete file.
+- (void)testSingleArtboardFileFromReleasedImporter
+{
+    StreamImporterRecorder* recorder = [[StreamImporterRecorder alloc] init];
+    recorder.done = [self expectationWithDescription:@"import finished"];
+    @autoreleasepool
+    {
+        RiveFileStreamImporter* importer =
+            [[RiveFileStreamImporter alloc] initWithLoadCdn:false];
+        importer.delegate = recorder;
+        XCTAssertTrue(
+            [importer appendData:[Util loadTestData:@"flux_capacitor"]]);
+        [importer finish];
+    }
+    [self waitForExpectations:@[ recorder.done ] timeout:5];
+
+    NSArray* expected = @[ @"header", @"file" ];
+    XCTAssertEqualObjects(recorder.events, expected);
+    XCTAssertEqual([recorder.file artboardCount], 1);
+}
+
+/// A file that is not a Rive file fails as soon as its header arrives.
+- (void)testMalformedHeaderFailsEarly
+{
+    RiveFileStreamImporter* importer =
+        [[RiveFileStreamImporter alloc] initWithLoadCdn:false];
+    StreamImporterRecorder* recorder = [[StreamImporterRecorder alloc] init];
+    recorder.done = [self expectationWithDescription:@"import failed"];
+    importer.delegate = recorder;
+
+    NSData* junk = [@"NOT A RIVE FILE" dataUsingEncoding:NSUTF8StringEncoding];
+    XCTAssertFalse([importer appendData:junk]);
+    [self waitForExpectations:@[ recorder.done ] timeout:5];
+
+    XCTAssertEqual(recorder.error.code, RiveMalformedFile);
+    XCTAssertNil(recorder.file);
+}
+
+/// A missing file reported by the server fails the import.
+- (void)testHTTPErrorFails
+{
+    RiveFileStreamImporter* importer =
+        [[RiveFileStreamImporter alloc] initWithLoadCdn:false];
+    StreamImporterRecorder* recorder = [[StreamImporterRecorder alloc] init];
+    recorder.done = [self expectationWithDescription:@"import failed"];
+    importer.delegate = recorder;
+
+    NSURLSession* session = [self throttledSessionWithDelegate:importer];
+    [[session dataTaskWithURL:[NSURL URLWithString:@"throttled://host/missing"]]
+        resume];
+    [self waitForExpectations:@[ recorder.done ] timeout:5];
+    [session invalidateAndCancel];
+
+    XCTAssertNotNil(recorder.error);
+    XCTAssertNil(recorder.file);
+}
+
+@end
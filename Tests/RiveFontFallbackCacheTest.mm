@@ -0,0 +1,107 @@
+//
+//  RiveFontFallbackCacheTest.mm
+//  RiveRuntimeTests
+//
+//  Tests that fallback fonts resolved while shaping are cached, and that the
+//  cache is reset when the fallbacks change.
+//
+
+#import <XCTest/XCTest.h>
+#import "Rive.h"
+#import "util.h"
+
+@interface RiveFont (Testing)
++ (NSUInteger)cachedFallbackFontCount;
+@end
+
+static NSString* const kCJKText =
+    @"日本語のテキストと中文文本，한국어 텍스트도 함께 표시します。";
+static NSString* const kEmojiText = @"😀😃😄😁😆😅🤣😂🙂🙃😉😊😇🥰😍🤩";
+
+@interface RiveFontFallbackCacheTest : XCTestCase
+@end
+
+@implementation RiveFontFallbackCacheTest
+
+- (void)setUp
+{
+    RiveFont.fallbackFonts = @[];
+}
+
+- (RiveTextValueRun*)textRunInArtboard:(RiveArtboard* __strong*)artboard
+{
+    RiveFile* file = [Util loadTestFile:@"testtext" error:nil];
+    *artboard = [file artboardFromName:@"New Artboard" error:nil];
+    return [*artboard textRun:@"MyRun"];
+}
+
+/// Shaping text with missing glyphs fills the cache, and shaping it again
+/// resolves nothing new.
+- (void)testFallbacksAreCached
+{
+    RiveArtboard* artboard = nil;
+    RiveTextValueRun* textRun = [self textRunInArtboard:&artboard];
+    XCTAssertEqual([RiveFont cachedFallbackFontCount], 0);
+
+    [textRun setText:kCJKText];
+    [artboard advanceBy:0];
+    NSUInteger count = [RiveFont cachedFallbackFontCount];
+    XCTAssertGreaterThan(count, 0);
+
+    [textRun setText:[kCJKText stringByAppendingString:kCJKText]];
+    [artboard advanceBy:0];
+    XCTAssertEqual([RiveFont cachedFallbackFontCount], count);
+}
+
+/// Changing the fallbacks, by array or by callback, resets the cache and
+/// consults the new providers.
+- (void)testChangingFallbacksResetsCache
+{
+    RiveArtboard* artboard = nil;
+    RiveTextValueRun* textRun = [self textRunInArtboard:&artboard];
+    [textRun setText:kEmojiText];
+    [artboard advanceBy:0];
+    XCTAssertGreaterThan([RiveFont cachedFallbackFontCount], 0);
+
+    NSArray* defaults = RiveFont.fallbackFonts;
+    RiveFont.fallbackFonts = defaults;
+    XCTAssertEqual([RiveFont cachedFallbackFontCount], 0);
+
+    __block NSUInteger calls = 0;
+    RiveFont.fallbackFontsCallback = ^(RiveFontStyle* style) {
+      calls++;
+      return defaults;
+    };
+    XCTAssertEqual([RiveFont cachedFallbackFontCount], 0);
+
+    [textRun setText:[kEmojiText stringByAppendingString:kEmojiText]];
+    [artboard advanceBy:0];
+    XCTAssertGreaterThan(calls, 0);
+    NSUInteger callsAfterFirstShape = calls;
+
+    [textRun setText:kEmojiText];
+    [artboard advanceBy:0];
+    XCTAssertEqual(calls, callsAfterFirstShape);
+}
+
+/// Shaping CJK and emoji strings that need fallbacks for most glyphs.
+- (void)testShapingCJKAndEmojiPerformance
+{
+    RiveArtboard* artboard = nil;
+    RiveTextValueRun* textRun = [self textRunInArtboard:&artboard];
+    NSArray<NSString*>* strings = @[
+        kCJKText,
+        kEmojiText,
+        [kCJKText stringByAppendingString:kEmojiText],
+    ];
+    [self measureWithMetrics:@[ [[XCTClockMetric alloc] init] ]
+                       block:^{
+                         for (int i = 0; i < 50; i++)
+                         {
+                             [textRun setText:strings[i % strings.count]];
+                             [artboard advanceBy:0];
+                         }
+                       }];
+}
+
+@end
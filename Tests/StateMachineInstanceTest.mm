@@ -9,6 +9,7 @@
 #import <XCTest/XCTest.h>
 #import "Rive.h"
 #import "util.h"
+#import <malloc/malloc.h>
 
 @interface RiveStateMachineInstanceTest : XCTestCase
 
@@ -198,4 +199,295 @@
                    true);
 }
 
+/*
+ * Test resolving input names to indices
+ */
+- (void)testInputIndexForName
+{
+    RiveFile* file = [Util loadTestFile:@"state_machine_configurations"
+                                  error:nil];
+
+    RiveArtboard* artboard = [file artboard:nil];
+    RiveStateMachineInstance* stateMachineInstance =
+        [artboard stateMachineFromName:@"mixed" error:nil];
+
+    NSArray* names = [stateMachineInstance inputNames];
+    for (NSInteger i = 0; i < names.count; i++)
+    {
+        XCTAssertEqual([stateMachineInstance inputIndexForName:names[i]], i);
+    }
+    XCTAssertEqual([stateMachineInstance inputIndexForName:@"missing"],
+                   NSNotFound);
+}
+
+/*
+ * Test setting and getting inputs by index
+ */
+- (void)testIndexedInputs
+{
+    RiveFile* file = [Util loadTestFile:@"state_machine_configurations"
+                                  error:nil];
+
+    RiveArtboard* artboard = [file artboard:nil];
+    RiveStateMachineInstance* stateMachineInstance =
+        [artboard stateMachineFromName:@"mixed" error:nil];
+
+    NSInteger three = [stateMachineInstance inputIndexForName:@"three"];
+    NSInteger on = [stateMachineInstance inputIndexForName:@"on"];
+    NSInteger trigger = [stateMachineInstance inputIndexForName:@"trigger"];
+
+    XCTAssertEqual([stateMachineInstance numberAtIndex:three], 3);
+    XCTAssertTrue([stateMachineInstance setNumber:15 atIndex:three]);
+    XCTAssertEqual([stateMachineInstance numberAtIndex:three], 15);
+    XCTAssertEqual([[stateMachineInstance getNumber:@"three"] value], 15);
+
+    XCTAssertTrue([stateMachineInstance boolAtIndex:on]);
+    XCTAssertTrue([stateMachineInstance setBool:false atIndex:on]);
+    XCTAssertFalse([stateMachineInstance boolAtIndex:on]);
+    XCTAssertFalse([[stateMachineInstance getBool:@"on"] value]);
+
+    XCTAssertTrue([stateMachineInstance fireTriggerAtIndex:trigger]);
+
+    // Indices of other types, and out of range, are rejected.
+    XCTAssertFalse([stateMachineInstance setNumber:1 atIndex:on]);
+    XCTAssertFalse([stateMachineInstance setBool:true atIndex:three]);
+    XCTAssertFalse([stateMachineInstance fireTriggerAtIndex:three]);
+    XCTAssertFalse([stateMachineInstance setNumber:1 atIndex:-1]);
+    XCTAssertFalse([stateMachineInstance setNumber:1 atIndex:NSNotFound]);
+    XCTAssertEqual([stateMachineInstance numberAtIndex:NSNotFound], 0);
+    XCTAssertFalse([stateMachineInstance boolAtIndex:NSNotFound]);
+}
+
+/*
+ * Test that indexed inputs do not allocate
+ */
+- (void)testIndexedInputsDoNotAllocate
+{
+    RiveFile* file = [Util loadTestFile:@"state_machine_configurations"
+                                  error:nil];
+
+    RiveArtboard* artboard = [file artboard:nil];
+    RiveStateMachineInstance* stateMachineInstance =
+        [artboard stateMachineFromName:@"mixed" error:nil];
+    NSInteger three = [stateMachineInstance inputIndexForName:@"three"];
+    NSInteger on = [stateMachineInstance inputIndexForName:@"on"];
+
+    // Anything allocated per call, and left to the autorelease pool, would
+    // be in use until the pool drains.
+    const int iterations = 10000;
+    @autoreleasepool
+    {
+        malloc_statistics_t before;
+        malloc_zone_statistics(NULL, &before);
+        for (int i = 0; i < iterations; i++)
+        {
+            [stateMachineInstance setNumber:i atIndex:three];
+            [stateMachineInstance setBool:i % 2 atIndex:on];
+            [stateMachineInstance numberAtIndex:three];
+        }
+        malloc_statistics_t after;
+        malloc_zone_statistics(NULL, &after);
+        // Allow for allocations made by other threads meanwhile.
+        XCTAssertLessThan((long)after.blocks_in_use - (long)before.blocks_in_use,
+                          iterations / 100);
+    }
+}
+
+/*
+ * Benchmark setting a number input by name, 120 times a second for a minute
+ */
+- (void)testSetNumberByNamePerformance
+{
+    RiveFile* file = [Util loadTestFile:@"state_machine_configurations"
+                                  error:nil];
+
+    RiveArtboard* artboard = [file artboard:nil];
+    RiveStateMachineInstance* stateMachineInstance =
+        [artboard stateMachineFromName:@"mixed" error:nil];
+
+    [self measureWithMetrics:@[
+        [[XCTClockMetric alloc] init], [[XCTMemoryMetric alloc] init]
+    ]
+                       block:^{
+                         for (int i = 0; i < 120 * 60; i++)
+                         {
+                             [[stateMachineInstance getNumber:@"three"]
+                                 setValue:i];
+                         }
+                       }];
+}
+
+/*
+ * Benchmark setting a number input by index, 120 times a second for a minute
+ */
+- (void)testSetNumberByIndexPerformance
+{
+    RiveFile* file = [Util loadTestFile:@"state_machine_configurations"
+                                  error:nil];
+
+    RiveArtboard* artboard = [file artboard:nil];
+    RiveStateMachineInstance* stateMachineInstance =
+        [artboard stateMachineFromName:@"mixed" error:nil];
+    NSInteger three = [stateMachineInstance inputIndexForName:@"three"];
+
+    [self measureWithMetrics:@[
+        [[XCTClockMetric alloc] init], [[XCTMemoryMetric alloc] init]
+    ]
+                       block:^{
+                         for (int i = 0; i < 120 * 60; i++)
+                         {
+                             [stateMachineInstance setNumber:i atIndex:three];
+                         }
+                       }];
+}
+
+/*
+ * Test reading state changes from the report channel
+ */
+- (void)testReadStateChangeReports
+{
+    RiveFile* file = [Util loadTestFile:@"what_a_state" error:nil];
+    RiveArtboard* artboard = [file artboard:nil];
+    RiveStateMachineInstance* stateMachineInstance =
+        [artboard stateMachineFromName:@"State Machine 2" error:nil];
+
+    [stateMachineInstance advanceBy:0.1];
+    NSArray* stateChanges = [stateMachineInstance stateChanges];
+    XCTAssertTrue([stateChanges containsObject:@"go right"]);
+
+    RiveStateMachineReport reports[8];
+    NSUInteger count =
+        [stateMachineInstance readReportsAfter:0
+                                         kinds:RiveStateMachineReportKindEvent |
+                                               RiveStateMachineReportKindStateChange
+                                          into:reports
+                                      capacity:8];
+    XCTAssertEqual(count, stateChanges.count);
+    NSMutableArray* names = [NSMutableArray array];
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        XCTAssertEqual(reports[i].kind, RiveStateMachineReportKindStateChange);
+        XCTAssertNil([stateMachineInstance eventForReport:reports[i].identifier]);
+        [names addObject:[stateMachineInstance
+                             stateNameForReport:reports[i].identifier]];
+    }
+    XCTAssertEqualObjects(names, stateChanges);
+
+    // Reports outlive the advance that made them, and are read once.
+    uint64_t last = reports[count - 1].identifier;
+    [stateMachineInstance advanceBy:0];
+    XCTAssertEqual([[stateMachineInstance stateChanges] count], 0);
+    XCTAssertNotNil([stateMachineInstance stateNameForReport:last]);
+    XCTAssertEqual([stateMachineInstance lastReportIdentifier], last);
+    XCTAssertEqual([stateMachineInstance
+                       readReportsAfter:last
+                                  kinds:RiveStateMachineReportKindStateChange
+                                   into:reports
+                               capacity:8],
+                   0);
+}
+
+/*
+ * Test that reading after the report before the latest advance yields what the
+ * state machine itself still reports
+ */
+- (void)testReadReportsSinceLatestAdvance
+{
+    RiveFile* file = [Util loadTestFile:@"what_a_state" error:nil];
+    RiveArtboard* artboard = [file artboard:nil];
+    RiveStateMachineInstance* stateMachineInstance =
+        [artboard stateMachineFromName:@"State Machine 2" error:nil];
+    XCTAssertEqual([stateMachineInstance reportIdentifierBeforeLatestAdvance],
+                   0);
+
+    [stateMachineInstance advanceBy:0.1];
+    uint64_t first = [stateMachineInstance lastReportIdentifier];
+    XCTAssertGreaterThan(first, 0);
+    [stateMachineInstance advanceBy:0.1];
+    NSArray* stateChanges = [stateMachineInstance stateChanges];
+
+    // Reports of the first advance are still held, but are not read.
+    uint64_t cursor = [stateMachineInstance reportIdentifierBeforeLatestAdvance];
+    XCTAssertGreaterThanOrEqual(cursor, first);
+    XCTAssertNotNil([stateMachineInstance stateNameForReport:first]);
+    RiveStateMachineReport reports[8];
+    NSUInteger count = [stateMachineInstance
+        readReportsAfter:cursor
+                   kinds:RiveStateMachineReportKindStateChange
+                    into:reports
+                capacity:8];
+    XCTAssertEqual(count, stateChanges.count);
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        XCTAssertEqualObjects([stateMachineInstance
+                                  stateNameForReport:reports[i].identifier],
+                              stateChanges[i]);
+    }
+}
+
+/*
+ * Test reading events from the report channel
+ */
+- (void)testReadEventReports
+{
+    RiveFile* file = [Util loadTestFile:@"rating_animation" error:nil];
+    RiveArtboard* artboard = [file artboard:nil];
+    RiveStateMachineInstance* stateMachineInstance =
+        [artboard stateMachineFromName:@"State Machine 1" error:nil];
+
+    [[stateMachineInstance getNumber:@"rating"] setValue:2];
+    [stateMachineInstance advanceBy:0];
+    [stateMachineInstance advanceBy:0.1];
+
+    RiveStateMachineReport reports[8];
+    NSUInteger count =
+        [stateMachineInstance readReportsAfter:0
+                                         kinds:RiveStateMachineReportKindEvent
+                                          into:reports
+                                      capacity:8];
+    XCTAssertEqual(count, 1);
+    RiveEvent* event = [stateMachineInstance eventForReport:reports[0].identifier];
+    XCTAssertEqualObjects([event name], @"rating2");
+    XCTAssertTrue([event isKindOfClass:[RiveGeneralEvent class]]);
+    XCTAssertNil([stateMachineInstance stateNameForReport:reports[0].identifier]);
+}
+
+/*
+ * Test that polling the report channel does not allocate when nothing is
+ * reported
+ */
+- (void)testReadReportsDoesNotAllocate
+{
+    RiveFile* file = [Util loadTestFile:@"what_a_state" error:nil];
+    RiveArtboard* artboard = [file artboard:nil];
+    RiveStateMachineInstance* stateMachineInstance =
+        [artboard stateMachineFromName:@"State Machine 2" error:nil];
+    [stateMachineInstance advanceBy:0.1];
+    uint64_t last = [stateMachineInstance lastReportIdentifier];
+
+    RiveStateMachineReport reports[8];
+    long allocated = 0;
+    @autoreleasepool
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            [stateMachineInstance advanceBy:0];
+            malloc_statistics_t before;
+            malloc_zone_statistics(NULL, &before);
+            NSUInteger count = [stateMachineInstance
+                readReportsAfter:last
+                           kinds:RiveStateMachineReportKindEvent |
+                                 RiveStateMachineReportKindStateChange
+                            into:reports
+                        capacity:8];
+            malloc_statistics_t after;
+            malloc_zone_statistics(NULL, &after);
+            XCTAssertEqual(count, 0);
+            allocated += (long)after.blocks_in_use - (long)before.blocks_in_use;
+        }
+    }
+    // Allow for allocations made by other threads meanwhile.
+    XCTAssertLessThan(allocated, 10);
+}
+
 @end